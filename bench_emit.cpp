@@ -0,0 +1,148 @@
+//
+// bench_emit.cpp
+//
+// Benchmark for MidiWrite::emit() against writing the same channel events
+// one at a time with time() and noteon(), program() etc.  A list of random
+// events (every type of channel event, mostly short delays with the odd one
+// needing all four bytes, note offs with and without velocity) is written
+// both ways, with and without running status, and the two files must come
+// out the same.
+//
+//   $ make bench_emit && ./bench_emit [events] [runs]
+//
+// Exits with 0 if the output of both matched.
+//
+
+#include "midiio.hpp"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+
+// Default size of the benchmark
+#define BENCH_EVENTS  2000000
+#define BENCH_RUNS    5
+
+// Number of events passed to each emit() call
+#define BENCH_BATCH   4096
+
+static unsigned long nextrand(unsigned long* seed)
+{
+  *seed = *seed * 1103515245UL + 12345UL;
+  return (*seed >> 16) & 0x7FFF;
+}
+
+static void makeevents(std::vector<MIDIEVENT>& ev)
+{
+  unsigned long seed = 1;
+  for (size_t i = 0; i < ev.size(); i++)
+  {
+    unsigned long r = nextrand(&seed);
+    if (r & 0x3F00)
+      ev[i].ticks = r % 128;
+    else if (r & 0xF0)
+      ev[i].ticks = r * 4;
+    else
+      ev[i].ticks = 0x200000 + (r & 0x0F) * 0xE0000; // four byte delta
+    static const unsigned char type[] = {
+      0x90, 0x90, 0x90, 0x80, 0x80, 0x80, 0xE0, 0xE0, 0xB0, 0xC0, 0xA0, 0xD0
+    };
+    ev[i].code = type[nextrand(&seed) % sizeof(type)]
+      + (unsigned char)(nextrand(&seed) % 16);
+    ev[i].data[0] = (unsigned char)(nextrand(&seed) & 0x7F);
+    // A third of note offs have no velocity, so they can become note ons
+    ev[i].data[1] = (nextrand(&seed) % 3)
+      ? (unsigned char)(nextrand(&seed) & 0x7F) : 0;
+  }
+}
+
+// Write the events with emit(), BENCH_BATCH at a time
+static void writeemit(MidiWrite& write, const std::vector<MIDIEVENT>& ev)
+{
+  for (size_t i = 0; i < ev.size(); i += BENCH_BATCH)
+    write.emit(&ev[i], (int)std::min(ev.size() - i, (size_t)BENCH_BATCH));
+}
+
+// Write the events one call at a time
+static void writecalls(MidiWrite& write, const std::vector<MIDIEVENT>& ev)
+{
+  for (size_t i = 0; i < ev.size(); i++)
+  {
+    const MIDIEVENT& e = ev[i];
+    int channel = e.code & 0x0F;
+    write.time(e.ticks);
+    switch (e.code & 0xF0)
+    {
+      case 0x80: write.noteoff(channel, e.data[0], e.data[1]); break;
+      case 0x90: write.noteon(channel, e.data[0], e.data[1]); break;
+      case 0xA0: write.polyaftertouch(channel, e.data[0], e.data[1]); break;
+      case 0xB0: write.control(channel, e.data[0], e.data[1]); break;
+      case 0xC0: write.program(channel, e.data[0]); break;
+      case 0xD0: write.aftertouch(channel, e.data[0]); break;
+      case 0xE0: write.pitchbend(channel, e.data[0] | (e.data[1] << 7)); break;
+    }
+  }
+}
+
+// Write the events into a file kept in memory, returning the time taken in
+// seconds and the finished file in out
+static double writefile(const std::vector<MIDIEVENT>& ev, bool bEmit,
+  int compress, std::vector<unsigned char>& out)
+{
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  MidiWrite write(0);
+  write.setcompress(compress);
+  write.head(0, 0, 192);
+  write.track();
+  if (bEmit)
+    writeemit(write, ev);
+  else
+    writecalls(write, ev);
+  write.endtrack();
+  double secs = std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - start).count();
+  out.assign(write.getdata(), write.getdata() + write.getsize());
+  return secs;
+}
+
+int main(int argc, char** argv)
+{
+  int events = (argc > 1) ? atoi(argv[1]) : BENCH_EVENTS;
+  int runs = (argc > 2) ? atoi(argv[2]) : BENCH_RUNS;
+  if ((events <= 0) || (runs <= 0))
+  {
+    fprintf(stderr, "Usage: bench_emit [events] [runs]\n");
+    return 1;
+  }
+
+  std::vector<MIDIEVENT> ev(events);
+  makeevents(ev);
+
+  int failures = 0;
+  for (int compress = 1; compress >= 0; compress--)
+  {
+    std::vector<double> secs[2];
+    std::vector<unsigned char> out[2];
+    for (int run = 0; run < runs; run++)
+    {
+      for (int bEmit = 0; bEmit < 2; bEmit++)
+        secs[bEmit].push_back(writefile(ev, bEmit != 0, compress, out[bEmit]));
+      if (out[0] != out[1])
+      {
+        fprintf(stderr, "emit() output differs from the per-call output\n");
+        failures++;
+      }
+    }
+    for (int bEmit = 1; bEmit >= 0; bEmit--)
+    {
+      std::sort(secs[bEmit].begin(), secs[bEmit].end());
+      printf("%-8s running status %-3s: best %.3fs, median %.3fs over %d "
+        "runs (%d events, %lu bytes)\n", bEmit ? "emit()" : "per-call",
+        compress ? "on" : "off", secs[bEmit][0], secs[bEmit][runs / 2], runs,
+        events, (unsigned long)out[bEmit].size());
+    }
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,168 @@
+//
+// bench_instload.cpp
+//
+// Benchmark for loading the instrument mapping from the text files (as every
+// run does when there's no up to date inst.db.)  A synthetic inst.txt of the
+// given number of lines is written to dir, if there isn't one there already,
+// then the complete load - parsing and building the indices - is timed.  The
+// file is left behind so the same one can be used to time dro2midi itself.
+//
+//   $ make bench_instload && ./bench_instload <dir> [lines] [runs]
+//
+
+#include "libdro2midi.hpp"
+#include <stdlib.h>
+#include <stdio.h>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#define chdir _chdir
+#define NULL_FILE  "NUL"
+#else
+#include <unistd.h>
+#define NULL_FILE  "/dev/null"
+#endif
+
+// Default size of the benchmark
+#define BENCH_LINES  100000
+#define BENCH_RUNS   5
+
+static unsigned long nextrand(unsigned long* seed)
+{
+  *seed = *seed * 1103515245UL + 12345UL;
+  return (*seed >> 16) & 0x7FFF;
+}
+
+// Write a mapping file of lines lines to f, with the same mix of instrument
+// types, options, comments and blank lines as a real one
+static void writemapping(FILE* f, int lines)
+{
+  unsigned long seed = 1;
+  fprintf(f, "# Synthetic mapping file written by bench_instload\n");
+  for (int i = 1; i < lines; i++)
+  {
+    int r = (int)(nextrand(&seed) % 100);
+    if (r < 5)
+    {
+      fprintf(f, "\n");
+      continue;
+    }
+    if (r < 10)
+    {
+      fprintf(f, "# Comment line %d\n", i);
+      continue;
+    }
+    unsigned char reg[11];
+    for (int j = 0; j < 11; j++)
+      reg[j] = (unsigned char)nextrand(&seed);
+    if (r < 85)
+    {
+      fprintf(f, "NO %02X-%02X/%02X-%02X/%02X-%02X/%02X-%02X/%02X/%02X-%02X: ",
+        reg[0], reg[1], reg[2], reg[3], reg[4], reg[5], reg[6], reg[7],
+        reg[8] & 0x0F, reg[9] & 0x07, reg[10] & 0x07);
+    }
+    else if ((r & 1) == 0)
+    {
+      // Bass drum uses both operators
+      fprintf(f, "BD %02X-%02X/%02X-%02X/%02X-%02X/%02X-%02X/%02X/%02X-%02X: ",
+        reg[0], reg[1], reg[2], reg[3], reg[4], reg[5], reg[6], reg[7],
+        reg[8] & 0x0F, reg[9] & 0x07, reg[10] & 0x07);
+    }
+    else if (r & 2)
+    {
+      // Snare and top-cymbal
+      fprintf(f, "%s %02X/%02X/%02X/%02X/%02X: ", (r & 4) ? "SD" : "TC",
+        reg[0], reg[1], reg[2], reg[3], reg[4] & 0x07);
+    }
+    else
+    {
+      // Tom-tom and hi-hat, which also have the channel's feedback
+      fprintf(f, "%s %02X/%02X/%02X/%02X/%02X/%02X: ", (r & 4) ? "TT" : "HH",
+        reg[0], reg[1], reg[2], reg[3], reg[4] & 0x0F, reg[5] & 0x07);
+    }
+    if (r % 7 == 0)
+      fprintf(f, "drum=%d", 35 + (int)(nextrand(&seed) % 47));
+    else
+      fprintf(f, "patch=%d", 1 + (int)(nextrand(&seed) % 128));
+    if (r % 11 == 0)
+      fprintf(f, " transpose=%d", (int)(nextrand(&seed) % 25) - 12);
+    if (r % 3 == 0)
+      fprintf(f, "   # Instrument %d", i);
+    fprintf(f, "\n");
+  }
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    fprintf(stderr, "Usage: bench_instload <dir> [lines] [runs]\n");
+    return 1;
+  }
+  int lines = (argc > 2) ? atoi(argv[2]) : BENCH_LINES;
+  int runs = (argc > 3) ? atoi(argv[3]) : BENCH_RUNS;
+  if ((lines <= 0) || (runs <= 0))
+  {
+    fprintf(stderr, "The number of lines and runs must be positive\n");
+    return 1;
+  }
+  if (chdir(argv[1]) != 0)
+  {
+    perror(argv[1]);
+    return 1;
+  }
+
+  FILE* f = fopen(MAPPING_FILE, "r");
+  if (f)
+  {
+    printf("Using the existing " MAPPING_FILE " in %s\n", argv[1]);
+  }
+  else
+  {
+    f = fopen(MAPPING_FILE, "w");
+    if (!f)
+    {
+      perror(MAPPING_FILE);
+      return 1;
+    }
+    writemapping(f, lines);
+    printf("Wrote %d lines to " MAPPING_FILE " in %s\n", lines, argv[1]);
+  }
+  fclose(f);
+
+  // The warnings about patch.txt and drum.txt being missing aren't wanted
+  ConversionOptions opt;
+  opt.out = opt.err = fopen(NULL_FILE, "w");
+  if (!opt.out)
+  {
+    perror(NULL_FILE);
+    return 1;
+  }
+
+  std::vector<double> secs;
+  int count = 0;
+  for (int run = 0; run < runs; run++)
+  {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    ConversionContext* ctx = new ConversionContext(opt);
+    if (!ctx->loadInstruments(false))
+    {
+      fprintf(stderr, "The mapping file couldn't be loaded\n");
+      return 1;
+    }
+    secs.push_back(std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count());
+    count = ctx->instruments().count();
+    delete ctx;
+  }
+  fclose(opt.out);
+
+  std::sort(secs.begin(), secs.end());
+  double median = secs[secs.size() / 2];
+  printf("Loaded %d instruments, best %.3fs, median %.3fs over %d runs "
+    "(%.0f instruments/s)\n", count, secs[0], median, runs, count / median);
+  return 0;
+}
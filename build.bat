@@ -1 +1 @@
-cl midiio.cpp dro2midi.cpp /link /OUT:dro2midi.exe
+cl midiio.cpp dro2midi.cpp libdro2midi.cpp capture.cpp decoder.cpp instvec.cpp instdb.cpp eventlist.cpp server.cpp live.cpp ring.cpp /link /OUT:dro2midi.exe
@@ -0,0 +1,228 @@
+// capture.cpp - memory mapped access to OPL capture files
+#include "capture.hpp"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CAPTURE_USE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#define dup _dup
+#define dup2 _dup2
+#define fdopen _fdopen
+#endif
+
+CaptureReader::CaptureReader()
+{
+  data_ = pos_ = end_ = 0;
+  size_ = base_ = bufsize_ = 0;
+  buf_ = 0;
+  stream_ = 0;
+  mapped_ = false;
+  overrun_ = false;
+}
+
+CaptureReader::~CaptureReader()
+{
+  close();
+}
+
+bool CaptureReader::open(const char* filename)
+{
+  close();
+
+#ifdef CAPTURE_USE_MMAP
+  int fd = ::open(filename, O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+  {
+    void* p = mmap(0, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED)
+    {
+      ::close(fd);
+#ifdef MADV_SEQUENTIAL
+      madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+      data_ = (const unsigned char*)p;
+      size_ = (unsigned long)st.st_size;
+      mapped_ = true;
+      pos_ = data_;
+      end_ = data_ + size_;
+      return true;
+    }
+  }
+  ::close(fd);
+  // Fall through and read the file in the conventional way
+#endif
+
+  FILE* f = fopen(filename, "rb");
+  if (!f)
+    return false;
+  fseek(f, 0L, SEEK_END);
+  long len = ftell(f);
+  fseek(f, 0L, SEEK_SET);
+  if (len < 0)
+  {
+    fclose(f);
+    return false;
+  }
+  unsigned char* buf = (unsigned char*)malloc(len ? len : 1);
+  if (!buf)
+  {
+    fclose(f);
+    return false;
+  }
+  size_ = (unsigned long)fread(buf, 1, len, f);
+  fclose(f);
+  data_ = buf_ = buf;
+  bufsize_ = size_;
+  pos_ = data_;
+  end_ = data_ + size_;
+  return true;
+}
+
+bool CaptureReader::open(FILE* f)
+{
+  close();
+
+#ifdef _WIN32
+  _setmode(_fileno(f), _O_BINARY);
+#endif
+  buf_ = (unsigned char*)malloc(CAPTURE_CHUNK);
+  if (!buf_)
+    return false;
+  bufsize_ = CAPTURE_CHUNK;
+  stream_ = f;
+  data_ = pos_ = end_ = buf_;
+  // Only read a small amount to start with, so the format can be detected
+  // without waiting on a slow producer.
+  fill(CAPTURE_LOOKAHEAD);
+  if (ferror(f))
+  {
+    close();
+    return false;
+  }
+  return true;
+}
+
+bool CaptureReader::open(const void* data, unsigned long len)
+{
+  close();
+
+  data_ = pos_ = (const unsigned char*)data;
+  size_ = len;
+  end_ = data_ + size_;
+  return true;
+}
+
+void CaptureReader::close()
+{
+#ifdef CAPTURE_USE_MMAP
+  if (mapped_)
+    munmap((void*)data_, size_);
+#endif
+  free(buf_);
+  buf_ = 0;
+  data_ = pos_ = end_ = 0;
+  size_ = base_ = bufsize_ = 0;
+  stream_ = 0;
+  mapped_ = false;
+  overrun_ = false;
+}
+
+void CaptureReader::seek(unsigned long pos)
+{
+  if (pos < base_)
+  {
+    // Already discarded from a stream
+    pos_ = data_;
+    overrun_ = true;
+    return;
+  }
+  while (pos - base_ > (unsigned long)(end_ - data_))
+  {
+    pos_ = end_;
+    if (!fill(CAPTURE_CHUNK))
+    {
+      overrun_ = true;
+      return;
+    }
+  }
+  pos_ = data_ + (pos - base_);
+}
+
+// Pull up to len more bytes in from the input stream, discarding everything
+// before the cursor to make room.  Returns false if nothing more could be
+// read (or this isn't a stream.)
+bool CaptureReader::fill(unsigned long len)
+{
+  if (!stream_)
+    return false;
+  unsigned long keep = (unsigned long)(end_ - pos_);
+  if (pos_ != data_)
+  {
+    base_ += (unsigned long)(pos_ - data_);
+    memmove(buf_, pos_, keep);
+  }
+  if (keep + len > bufsize_)
+    len = bufsize_ - keep;
+  size_t got = fread(buf_ + keep, 1, len, stream_);
+  data_ = pos_ = buf_;
+  end_ = buf_ + keep + got;
+  return got > 0;
+}
+
+unsigned long CaptureReader::readUINT32LE()
+{
+  unsigned long v = readUINT16LE();
+  return v | ((unsigned long)readUINT16LE() << 16);
+}
+
+unsigned long CaptureReader::read(void* dest, unsigned long len)
+{
+  unsigned long avail = remaining();
+  if (avail > len)
+    avail = len;
+  if (avail)
+  {
+    memcpy(dest, pos_, avail);
+    pos_ += avail;
+  }
+  if (avail < len)
+  {
+    memset((unsigned char*)dest + avail, 0, len - avail);
+    overrun_ = true;
+  }
+  return avail;
+}
+
+FILE* detachstdout()
+{
+  // Anything already printed is still sitting in the stdout buffer, so it
+  // will end up going to stderr as well.
+  int fd = dup(fileno(stdout));
+  if (fd < 0)
+    return 0;
+  if (dup2(fileno(stderr), fileno(stdout)) < 0)
+  {
+#ifdef _WIN32
+    _close(fd);
+#else
+    ::close(fd);
+#endif
+    return 0;
+  }
+#ifdef _WIN32
+  _setmode(fd, _O_BINARY);
+#endif
+  return fdopen(fd, "wb");
+}
@@ -0,0 +1,100 @@
+#ifndef __CAPTURE__
+#define __CAPTURE__
+
+#include <stdio.h>
+
+// Amount read from a stream before the format is detected.  This has to
+// cover the largest header we parse (DRO v2 with a full codemap.)
+#define CAPTURE_LOOKAHEAD  256
+
+// Amount read from a stream each time the cursor runs dry
+#define CAPTURE_CHUNK      65536
+
+// CaptureReader gives the converter access to the raw bytes of an OPL
+// capture.  The whole file is mapped into memory where the platform allows it
+// (otherwise it's read into a single buffer) and then decoded through a
+// bounds-checked cursor, so reading a register pair no longer costs a couple
+// of stdio calls.
+//
+// A non-seekable stream (e.g. stdin) can be read instead of a file, in which
+// case the cursor runs over a window that is refilled as it's consumed.  Only
+// the start of the stream (up to CAPTURE_LOOKAHEAD bytes) can be revisited
+// with seek(), and the total size isn't known until the stream ends.
+//
+// Reading past the end of the data is not an error as such, it just returns
+// zero bytes and sets the overrun flag, which the caller can check once it's
+// finished with a block of reads.
+class CaptureReader
+{
+public:
+  CaptureReader();
+  ~CaptureReader();
+
+  // Returns false (with errno set) if the file couldn't be opened or read.
+  bool open(const char* filename);
+  // Read from an already open stream, which is not closed afterwards.
+  bool open(FILE* f);
+  // Read len bytes already in memory.  They're used in place, so they must
+  // stay put until the reader is closed.
+  bool open(const void* data, unsigned long len);
+  void close();
+
+  bool ismapped() { return mapped_; }
+  bool isstream() { return stream_ != 0; }
+  unsigned long size() { return size_; } // only valid when !isstream()
+  unsigned long tell() { return base_ + (unsigned long)(pos_ - data_); }
+  unsigned long remaining() { return (unsigned long)(end_ - pos_); }
+  bool eof() { return (pos_ >= end_) && !fill(CAPTURE_CHUNK); }
+  bool overrun() { return overrun_; }
+
+  void seek(unsigned long pos);
+
+  // Direct access to the bytes at the cursor, for decoders that work on a
+  // whole block at a time.  Only remaining() bytes may be looked at, and
+  // skip() must not go past them.
+  const unsigned char* peek() { return pos_; }
+  void skip(unsigned long len) { pos_ += len; }
+
+  unsigned char readByte()
+  {
+    if ((pos_ < end_) || fill(CAPTURE_CHUNK)) return *pos_++;
+    overrun_ = true;
+    return 0;
+  }
+  unsigned short readUINT16LE()
+  {
+    if (end_ - pos_ >= 2) {
+      unsigned short v = pos_[0] | (pos_[1] << 8);
+      pos_ += 2;
+      return v;
+    }
+    unsigned char c0 = readByte();
+    return c0 | (readByte() << 8);
+  }
+  unsigned long readUINT32LE();
+
+  // Copy up to len bytes into dest, zero filling anything past the end of
+  // the data.  Returns the number of bytes actually available.
+  unsigned long read(void* dest, unsigned long len);
+
+protected:
+  const unsigned char* data_;  // start of the current window
+  const unsigned char* pos_;
+  const unsigned char* end_;
+  unsigned long size_;
+  unsigned long base_;  // file offset of data_[0]
+  unsigned char* buf_;  // owned buffer (when the file isn't mapped)
+  unsigned long bufsize_;
+  FILE* stream_;
+  bool mapped_;
+  bool overrun_;
+
+  bool fill(unsigned long len);
+};
+
+// Take over the real stdout as a binary stream, and point the stdout used by
+// printf() etc. at stderr instead, so status messages can't end up mixed in
+// with data written to the returned stream.  Returns NULL on failure.
+FILE* detachstdout();
+
+#endif
@@ -0,0 +1,452 @@
+// decoder.cpp - turn the various OPL capture formats into register writes
+#include "decoder.hpp"
+#include <math.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define DECODE_SSE2
+#endif
+
+// DRO v2 data is a fixed stride of two byte pairs, so where SIMD is available
+// a whole block of pairs is checked for delay codes and out-of-range codemap
+// indices at once.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define DRO2_BLOCK  32
+#elif defined(DECODE_SSE2)
+#define DRO2_BLOCK  16
+#endif
+
+// Number of IMF records split up in one go by imfdeinterleave()
+#define IMF_BLOCK  16
+
+// Split IMF_BLOCK records at p into separate register, value and delay arrays
+static void imfdeinterleave(const unsigned char* p, unsigned char* regs,
+  unsigned char* vals, unsigned short* delays)
+{
+#ifdef DECODE_SSE2
+  const __m128i lowbyte = _mm_set1_epi16(0x00FF);
+  for (int i = 0; i < IMF_BLOCK; i += 8)
+  {
+    // Each load holds four records as 16-bit words: reg|val, delay, ...
+    // Shuffle them so the reg|val words end up in the low half and the
+    // delays in the high half.
+    __m128i a = _mm_loadu_si128((const __m128i*)(p + i*4));
+    __m128i b = _mm_loadu_si128((const __m128i*)(p + i*4 + 16));
+    a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(a, _MM_SHUFFLE(3,1,2,0)), _MM_SHUFFLE(3,1,2,0));
+    a = _mm_shuffle_epi32(a, _MM_SHUFFLE(3,1,2,0));
+    b = _mm_shufflehi_epi16(_mm_shufflelo_epi16(b, _MM_SHUFFLE(3,1,2,0)), _MM_SHUFFLE(3,1,2,0));
+    b = _mm_shuffle_epi32(b, _MM_SHUFFLE(3,1,2,0));
+    __m128i regval = _mm_unpacklo_epi64(a, b);
+    _mm_storeu_si128((__m128i*)(delays + i), _mm_unpackhi_epi64(a, b));
+    __m128i r = _mm_packus_epi16(_mm_and_si128(regval, lowbyte), _mm_setzero_si128());
+    __m128i v = _mm_packus_epi16(_mm_srli_epi16(regval, 8), _mm_setzero_si128());
+    _mm_storel_epi64((__m128i*)(regs + i), r);
+    _mm_storel_epi64((__m128i*)(vals + i), v);
+  }
+#else
+  for (int i = 0; i < IMF_BLOCK; i++, p += 4)
+  {
+    regs[i] = p[0];
+    vals[i] = p[1];
+    delays[i] = p[2] | (p[3] << 8);
+  }
+#endif
+}
+
+CaptureDecoder::CaptureDecoder(CaptureReader& in, unsigned long len)
+  : in_(in)
+{
+  len_ = size_ = len;
+  out_ = stdout;
+  err_ = stderr;
+}
+
+CaptureDecoder::~CaptureDecoder()
+{
+}
+
+// class ImfDecoder
+
+ImfDecoder::ImfDecoder(CaptureReader& in, unsigned long len)
+  : CaptureDecoder(in, len)
+{
+  delay_ = 0;
+}
+
+int ImfDecoder::decode(OPLEVENT* ev, int max)
+{
+  int n = 0;
+
+  unsigned char regs[IMF_BLOCK], vals[IMF_BLOCK];
+  unsigned short delays[IMF_BLOCK];
+  while ((n < max) && more(4))
+  {
+    if ((max - n >= IMF_BLOCK) && (len_ >= IMF_BLOCK * 4)
+      && (in_.remaining() >= IMF_BLOCK * 4))
+    {
+      // Split up a whole block of records straight from the input
+      imfdeinterleave(in_.peek(), regs, vals, delays);
+      in_.skip(IMF_BLOCK * 4);
+      len_ -= IMF_BLOCK * 4;
+      for (int i = 0; i < IMF_BLOCK; i++)
+      {
+        ev[n + i].ticks = delay_;
+        ev[n + i].reg = regs[i];
+        ev[n + i].val = vals[i];
+        delay_ = delays[i];
+      }
+      n += IMF_BLOCK;
+      continue;
+    }
+
+    // The delay in each record comes *after* the write, so attach it to the
+    // following event.  Any delay after the last write is dropped.
+    ev[n].ticks = delay_;
+    ev[n].reg = in_.readByte();
+    ev[n].val = in_.readByte();
+    delay_ = in_.readUINT16LE();
+    len_ -= 4;
+    n++;
+  }
+  return n;
+}
+
+// class DroDecoder
+
+DroDecoder::DroDecoder(CaptureReader& in, unsigned long len)
+  : CaptureDecoder(in, len)
+{
+  delay_ = 0;
+  chipwarning_ = false;
+}
+
+int DroDecoder::decode(OPLEVENT* ev, int max)
+{
+  int n = 0;
+  while (n < max)
+  {
+    if (chipwarning_)
+    {
+      if (n) break;
+      fprintf(err_, "Warning: This song uses multiple OPL chips - this isn't yet supported!\n");
+      chipwarning_ = false;
+    }
+    if (!more(2)) break;
+
+    unsigned char code = in_.readByte();
+    len_--;
+    switch (code)
+    {
+      case 0x00: // delay (byte)
+        delay_ += 1 + in_.readByte();
+        len_--;
+        continue;
+      case 0x01: // delay (int)
+        delay_ += 1 + in_.readUINT16LE();
+        len_ -= 2;
+        continue;
+      case 0x02: // use first OPL chip
+      case 0x03: // use second OPL chip
+        chipwarning_ = true;
+        continue;
+      case 0x04: // escape
+        code = in_.readByte();
+        len_--;
+        break;
+    }
+    ev[n].ticks = delay_;
+    ev[n].reg = code;
+    ev[n].val = in_.readByte();
+    len_--;
+    delay_ = 0;
+    n++;
+  }
+  return n;
+}
+
+// class Dro2Decoder
+
+Dro2Decoder::Dro2Decoder(CaptureReader& in, const DRO2HEADER& hdr)
+  : CaptureDecoder(in, hdr.iLengthPairs * 2)
+{
+  hdr_ = hdr;
+  delay_ = 0;
+  corrupt_ = false;
+  for (int i = 0; i < 256; i++)
+  {
+    // Entries past the end of the codemap are never used as they're caught
+    // as corrupt data first.
+    if ((i & 0x7f) < hdr_.iCodemapLength)
+      xlat_[i] = (i & 0x80) | hdr_.iCodemap[i & 0x7f];
+    else
+      xlat_[i] = 0;
+  }
+}
+
+#ifdef DRO2_BLOCK
+// Decode DRO2_BLOCK pairs from the cursor into ev.  Returns the number of
+// events written, or -1 (without consuming anything) if the block contains
+// corrupt data, in which case it must be decoded one pair at a time so the
+// error is reported in the right place.
+int Dro2Decoder::decodeblock(OPLEVENT* ev)
+{
+  unsigned char codes[DRO2_BLOCK], params[DRO2_BLOCK];
+  unsigned long delaymask, badmask;
+  const unsigned char* p = in_.peek();
+
+#if DRO2_BLOCK == 32
+  const __m256i lowbyte = _mm256_set1_epi16(0x00FF);
+  __m256i a = _mm256_loadu_si256((const __m256i*)p);
+  __m256i b = _mm256_loadu_si256((const __m256i*)(p + 32));
+  // packus works within each 128-bit lane, so put the quadwords back in order
+  __m256i c = _mm256_permute4x64_epi64(_mm256_packus_epi16(
+    _mm256_and_si256(a, lowbyte), _mm256_and_si256(b, lowbyte)), 0xD8);
+  __m256i v = _mm256_permute4x64_epi64(_mm256_packus_epi16(
+    _mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8)), 0xD8);
+  __m256i isdelay = _mm256_or_si256(
+    _mm256_cmpeq_epi8(c, _mm256_set1_epi8((char)hdr_.iShortDelayCode)),
+    _mm256_cmpeq_epi8(c, _mm256_set1_epi8((char)hdr_.iLongDelayCode)));
+  // index >= length is the same as max(index, length) == index
+  __m256i idx = _mm256_and_si256(c, _mm256_set1_epi8(0x7f));
+  __m256i bad = _mm256_cmpeq_epi8(_mm256_max_epu8(idx,
+    _mm256_set1_epi8((char)hdr_.iCodemapLength)), idx);
+  delaymask = (unsigned int)_mm256_movemask_epi8(isdelay);
+  badmask = (unsigned int)_mm256_movemask_epi8(_mm256_andnot_si256(isdelay, bad));
+  _mm256_storeu_si256((__m256i*)codes, c);
+  _mm256_storeu_si256((__m256i*)params, v);
+#else
+  const __m128i lowbyte = _mm_set1_epi16(0x00FF);
+  __m128i a = _mm_loadu_si128((const __m128i*)p);
+  __m128i b = _mm_loadu_si128((const __m128i*)(p + 16));
+  __m128i c = _mm_packus_epi16(_mm_and_si128(a, lowbyte), _mm_and_si128(b, lowbyte));
+  __m128i v = _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+  __m128i isdelay = _mm_or_si128(
+    _mm_cmpeq_epi8(c, _mm_set1_epi8((char)hdr_.iShortDelayCode)),
+    _mm_cmpeq_epi8(c, _mm_set1_epi8((char)hdr_.iLongDelayCode)));
+  // index >= length is the same as max(index, length) == index
+  __m128i idx = _mm_and_si128(c, _mm_set1_epi8(0x7f));
+  __m128i bad = _mm_cmpeq_epi8(_mm_max_epu8(idx,
+    _mm_set1_epi8((char)hdr_.iCodemapLength)), idx);
+  delaymask = (unsigned int)_mm_movemask_epi8(isdelay);
+  badmask = (unsigned int)_mm_movemask_epi8(_mm_andnot_si128(isdelay, bad));
+  _mm_storeu_si128((__m128i*)codes, c);
+  _mm_storeu_si128((__m128i*)params, v);
+#endif
+
+  if (badmask)
+    return -1;
+
+  int n = 0;
+  if (!delaymask)
+  {
+    // The usual case, nothing but register writes
+    ev[0].ticks = delay_;
+    for (int i = 0; i < DRO2_BLOCK; i++)
+    {
+      ev[i].reg = xlat_[codes[i]];
+      ev[i].val = params[i];
+    }
+    for (int i = 1; i < DRO2_BLOCK; i++)
+      ev[i].ticks = 0;
+    delay_ = 0;
+    n = DRO2_BLOCK;
+  }
+  else
+  {
+    for (int i = 0; i < DRO2_BLOCK; i++)
+    {
+      if (delaymask & (1UL << i))
+      {
+        if (codes[i] == hdr_.iShortDelayCode)
+          delay_ += params[i] + 1;
+        else
+          delay_ += (params[i] + 1) << 8;
+        continue;
+      }
+      ev[n].ticks = delay_;
+      ev[n].reg = xlat_[codes[i]];
+      ev[n].val = params[i];
+      delay_ = 0;
+      n++;
+    }
+  }
+  in_.skip(DRO2_BLOCK * 2);
+  len_ -= DRO2_BLOCK * 2;
+  return n;
+}
+#endif
+
+int Dro2Decoder::decode(OPLEVENT* ev, int max)
+{
+  int n = 0;
+  while (n < max)
+  {
+    if (corrupt_)
+    {
+      if (n) break;
+      fprintf(err_, "error: corrupt data encountered!\n");
+      return -1;
+    }
+#ifdef DRO2_BLOCK
+    if ((max - n >= DRO2_BLOCK) && (len_ >= DRO2_BLOCK * 2) && (len_ <= size_)
+      && (in_.remaining() >= DRO2_BLOCK * 2))
+    {
+      int got = decodeblock(&ev[n]);
+      if (got >= 0)
+      {
+        n += got;
+        continue;
+      }
+    }
+#endif
+    if (!more(2))
+    {
+      if (delay_)
+      {
+        // Delays at the end of the song still need to be written out
+        ev[n].ticks = delay_;
+        ev[n].reg = ev[n].val = 0;
+        delay_ = 0;
+        n++;
+      }
+      break;
+    }
+
+    unsigned char code = in_.readByte();
+    unsigned char param = in_.readByte();
+    len_ -= 2;
+    if (code == hdr_.iShortDelayCode)
+    {
+      delay_ += param + 1;
+      continue;
+    }
+    else if (code == hdr_.iLongDelayCode)
+    {
+      delay_ += (param + 1) << 8;
+      continue;
+    }
+    if ((code & 0x7f) >= hdr_.iCodemapLength)
+    {
+      corrupt_ = true;
+      continue;
+    }
+    ev[n].ticks = delay_;
+    ev[n].reg = xlat_[code];
+    ev[n].val = param;
+    delay_ = 0;
+    n++;
+  }
+  return n;
+}
+
+// class RawDecoder
+
+RawDecoder::RawDecoder(CaptureReader& in, unsigned long len, int initialspeed,
+  int speed)
+  : CaptureDecoder(in, len)
+{
+  initialspeed_ = initialspeed;
+  speed_ = speed;
+  delay_ = ticks_ = 0;
+  clockspeed_ = -1;
+  portwarning_ = false;
+}
+
+void RawDecoder::setspeed()
+{
+  if ((clockspeed_ == 0) || (clockspeed_ == 0xFFFF))
+  {
+    fprintf(out_, "Speed set to invalid value, ignoring speed change.\n");
+  }
+  else
+  {
+    speed_ = (int)floor(1193180.0 / clockspeed_ + 0.5);
+    fprintf(out_, "Speed changed to %dHz\n", speed_);
+  }
+  clockspeed_ = -1;
+}
+
+int RawDecoder::decode(OPLEVENT* ev, int max)
+{
+  int n = 0;
+  while (n < max)
+  {
+    if ((clockspeed_ >= 0) || portwarning_)
+    {
+      if (n) break;
+      if (clockspeed_ >= 0)
+        setspeed();
+      if (portwarning_)
+      {
+        fprintf(out_, "Switching OPL ports is not yet implemented!\n");
+        portwarning_ = false;
+      }
+    }
+    if (!more(2))
+    {
+      if (ticks_)
+      {
+        // Delay written out before a speed change at the end of the song
+        ev[n].ticks = ticks_;
+        ev[n].reg = ev[n].val = 0;
+        ticks_ = 0;
+        n++;
+      }
+      break;
+    }
+
+    unsigned char param = in_.readByte();
+    unsigned char code = in_.readByte();
+    len_ -= 2;
+    switch (code)
+    {
+      case 0x00: // delay
+        delay_ += param;
+        continue;
+      case 0x02: // control data
+        switch (param)
+        {
+          case 0x00:
+            // Any delay so far is at the old clock speed, so convert it before
+            // the speed changes
+            if (delay_ != 0)
+            {
+              ticks_ += delay_ * initialspeed_ / speed_;
+              delay_ = 0;
+            }
+            clockspeed_ = in_.readUINT16LE();
+            len_ -= 2;
+            break;
+          case 0x01:
+          case 0x02:
+            portwarning_ = true;
+            break;
+        }
+        continue;
+      case 0xFF:
+        if (param == 0xFF)
+        {
+          // End of song
+          len_ = 0;
+          continue;
+        }
+        break;
+    }
+
+    // Since our global clock speed is 1000Hz, we have to multiply this delay
+    // accordingly as the delay units are in the current clock speed.  This
+    // calculation converts them into 1000Hz delay units regardless of the
+    // current clock speed.
+    if (delay_ != 0)
+      ticks_ += delay_ * initialspeed_ / speed_;
+    delay_ = 0;
+
+    ev[n].ticks = ticks_;
+    ev[n].reg = code;
+    ev[n].val = param;
+    ticks_ = 0;
+    n++;
+  }
+  return n;
+}
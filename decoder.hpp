@@ -0,0 +1,131 @@
+#ifndef __DECODER__
+#define __DECODER__
+
+#include "capture.hpp"
+
+#include <stdint.h>
+
+// Number of events the main loop asks a decoder for at a time
+#define DECODE_BATCH  4096
+
+// A single OPL register write, normalised from whatever format it was stored
+// in.  The delay is already converted into MIDI ticks, so the consumer
+// doesn't need to know anything about the format's clock.
+//
+// Register 0 doesn't exist on the OPL, so a write to it is used to carry any
+// delay left over at the end of a song which must still be written out.
+typedef struct
+{
+  unsigned long ticks; // MIDI ticks to wait before this write
+  unsigned char reg;
+  unsigned char val;
+} OPLEVENT;
+
+// DOSBox DRO v2.0 header, following the signature and version
+typedef struct
+{
+  uint32_t iLengthPairs;
+  uint32_t iLengthMS;
+  uint8_t iHardwareType;
+  uint8_t iFormat;
+  uint8_t iCompression;
+  uint8_t iShortDelayCode;
+  uint8_t iLongDelayCode;
+  uint8_t iCodemapLength;
+  uint8_t iCodemap[128];
+} DRO2HEADER;
+
+// Base class for each input format.  The reader must already be positioned at
+// the start of the song data, and len is the length of that data in bytes (as
+// given by the file header, or ULONG_MAX to read until EOF.)
+//
+// Anything a decoder prints (warnings, speed changes) is held back until the
+// events before it have been handed over, so messages still come out in the
+// same order relative to the ones printed while converting those events.
+class CaptureDecoder
+{
+public:
+  CaptureDecoder(CaptureReader& in, unsigned long len);
+  virtual ~CaptureDecoder();
+
+  // Decode up to max events into ev.  Returns the number of events decoded,
+  // 0 at the end of the song, or -1 if the data is corrupt.
+  virtual int decode(OPLEVENT* ev, int max) = 0;
+
+  // Where messages go (stdout and stderr by default)
+  void setlog(FILE* out, FILE* err) { out_ = out; err_ = err; }
+
+protected:
+  CaptureReader& in_;
+  FILE* out_;
+  FILE* err_;
+  unsigned long len_; // bytes left in the song (can wrap around if corrupt)
+  unsigned long size_; // original value of len_
+
+  // True while there are at least minlen bytes of song data left
+  bool more(unsigned long minlen)
+  {
+    return (len_ >= minlen) && (len_ <= size_) && (!in_.eof());
+  }
+};
+
+// id Software Music Format (type-0 and type-1), 4 byte records of register,
+// value and a delay to wait *after* the write.
+class ImfDecoder : public CaptureDecoder
+{
+public:
+  ImfDecoder(CaptureReader& in, unsigned long len);
+  virtual int decode(OPLEVENT* ev, int max);
+
+protected:
+  unsigned long delay_; // delay following the previous record
+};
+
+// DOSBox DRO v1.0
+class DroDecoder : public CaptureDecoder
+{
+public:
+  DroDecoder(CaptureReader& in, unsigned long len);
+  virtual int decode(OPLEVENT* ev, int max);
+
+protected:
+  unsigned long delay_;
+  bool chipwarning_; // multiple chip warning waiting to be printed
+};
+
+// DOSBox DRO v2.0
+class Dro2Decoder : public CaptureDecoder
+{
+public:
+  Dro2Decoder(CaptureReader& in, const DRO2HEADER& hdr);
+  virtual int decode(OPLEVENT* ev, int max);
+
+protected:
+  DRO2HEADER hdr_;
+  unsigned char xlat_[256]; // codemap lookup covering the high (chip) bit too
+  unsigned long delay_;
+  bool corrupt_; // corrupt data found, error waiting to be reported
+
+  int decodeblock(OPLEVENT* ev);
+};
+
+// Rdos RAW capture.  Delays are in units of the current clock speed, which
+// can change during the song, so they're converted into MIDI ticks at the
+// initial clock speed as they're read.
+class RawDecoder : public CaptureDecoder
+{
+public:
+  RawDecoder(CaptureReader& in, unsigned long len, int initialspeed, int speed);
+  virtual int decode(OPLEVENT* ev, int max);
+
+protected:
+  int initialspeed_, speed_;
+  unsigned long delay_; // in units of the current clock speed
+  unsigned long ticks_; // converted delay not yet attached to an event
+  int clockspeed_; // new clock speed waiting to be applied, or -1
+  bool portwarning_; // OPL port switch message waiting to be printed
+
+  void setspeed();
+};
+
+#endif
@@ -0,0 +1,326 @@
+// eventlist.cpp - MIDI events held back for optimisation before writing
+#include "eventlist.hpp"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NOTEON(i)   ((code_[i] & 0xF0) == 0x90 && data2_[i] != 0)
+#define NOTEOFF(i)  ((code_[i] & 0xF0) == 0x80 || \
+                     ((code_[i] & 0xF0) == 0x90 && data2_[i] == 0))
+
+MidiEventList::MidiEventList()
+{
+  tick_ = 0;
+  code_ = data1_ = data2_ = 0;
+  count_ = size_ = 0;
+  now_ = last_ = 0;
+  passes_ = 0;
+  drums_ = 0;
+  failed_ = false;
+  dropped_ = droppedbends_ = bends_ = 0;
+  coalesce_ = false;
+  window_ = 0;
+  threshold_ = 0;
+  scanned_ = 0;
+  sink_ = 0;
+  sinkcontext_ = 0;
+  for (int c = 0; c < 16; c++)
+  {
+    bend_[c] = prog_[c] = -1;
+    winstart_[c] = 0;
+    pending_[c] = -1;
+  }
+}
+
+void MidiEventList::setbendfilter(unsigned long window, int threshold)
+{
+  coalesce_ = true;
+  window_ = window;
+  threshold_ = threshold;
+}
+
+MidiEventList::~MidiEventList()
+{
+  free(tick_);
+  free(code_);
+  free(data1_);
+  free(data2_);
+}
+
+void MidiEventList::add(int code, int data1, int data2)
+{
+  if (count_ == size_)
+  {
+    int newsize = size_ ? size_ * 2 : 1024;
+    unsigned long* tick = (unsigned long*)realloc(tick_, newsize * sizeof(unsigned long));
+    if (tick) tick_ = tick;
+    unsigned char* code = (unsigned char*)realloc(code_, newsize);
+    if (code) code_ = code;
+    unsigned char* data1 = (unsigned char*)realloc(data1_, newsize);
+    if (data1) data1_ = data1;
+    unsigned char* data2 = (unsigned char*)realloc(data2_, newsize);
+    if (data2) data2_ = data2;
+    if (!tick || !code || !data1 || !data2)
+    {
+      failed_ = true;
+      return;
+    }
+    size_ = newsize;
+  }
+  tick_[count_] = now_;
+  code_[count_] = (unsigned char)code;
+  data1_[count_] = (unsigned char)data1;
+  data2_[count_] = (unsigned char)data2;
+  count_++;
+}
+
+void MidiEventList::noteon(int channel, int note, int vel)
+{
+  assert(channel >= 0 && channel < 16);
+  add(0x90 + channel, note, vel);
+}
+
+void MidiEventList::noteoff(int channel, int note, int vel)
+{
+  assert(channel >= 0 && channel < 16);
+  add(0x80 + channel, note, vel);
+}
+
+void MidiEventList::program(int channel, int prg)
+{
+  assert(channel >= 0 && channel < 16);
+  add(0xC0 + channel, prg, 0);
+}
+
+void MidiEventList::pitchbend(int channel, int val)
+{
+  assert(channel >= 0 && channel < 16);
+  add(0xE0 + channel, val & 0x7F, (val >> 7) & 0x7F);
+  bends_++;
+}
+
+void MidiEventList::drop(int i)
+{
+  if (!code_[i])
+    return; // already gone
+  if ((code_[i] & 0xF0) == 0xE0)
+    droppedbends_++;
+  code_[i] = 0;
+  dropped_++;
+}
+
+// Go through the events added since last time, dropping each pitchbend that
+// is followed by another within the window.
+void MidiEventList::coalesce()
+{
+  for (int i = scanned_; i < count_; i++)
+  {
+    int c = code_[i] & 0x0F;
+    switch (code_[i] & 0xF0)
+    {
+    case 0xE0:
+      if (pending_[c] >= 0 && tick_[i] - winstart_[c] <= window_)
+      {
+        drop(pending_[c]);
+      }
+      else
+      {
+        winstart_[c] = tick_[i];
+      }
+      pending_[c] = i;
+      break;
+    case 0x90:
+      if (data2_[i] != 0)
+        pending_[c] = -1; // the note has to start with the right pitch
+      break;
+    }
+  }
+  scanned_ = count_;
+}
+
+// Run the passes that only need to look at the events within one tick, which
+// is everything from start to end.
+void MidiEventList::optimise(int start, int end)
+{
+  if (passes_ & EVPASS_EMPTYNOTES)
+  {
+    // Note on events not yet followed by anything else for the same note
+    int pending[16][128];
+    for (int i = start; i < end; i++)
+      if (NOTEON(i) || NOTEOFF(i))
+        pending[code_[i] & 0x0F][data1_[i] & 0x7F] = -1;
+    for (int i = start; i < end; i++)
+    {
+      if (drums_ & (1 << (code_[i] & 0x0F)))
+        continue;
+      int* p = &pending[code_[i] & 0x0F][data1_[i] & 0x7F];
+      if (NOTEON(i))
+      {
+        *p = i;
+      }
+      else if (NOTEOFF(i))
+      {
+        if (*p >= 0)
+        {
+          drop(*p);
+          drop(i);
+        }
+        *p = -1;
+      }
+    }
+  }
+
+  if (passes_ & (EVPASS_PITCHBEND | EVPASS_PROGRAM))
+  {
+    // A pitchbend or program change followed by another one before any note
+    // is played on the channel is never heard
+    int bend[16], prog[16];
+    for (int c = 0; c < 16; c++)
+      bend[c] = prog[c] = -1;
+    for (int i = start; i < end; i++)
+    {
+      int c = code_[i] & 0x0F;
+      switch (code_[i] & 0xF0)
+      {
+      case 0xE0:
+        if ((passes_ & EVPASS_PITCHBEND) && bend[c] >= 0)
+          drop(bend[c]);
+        bend[c] = i;
+        break;
+      case 0xC0:
+        if ((passes_ & EVPASS_PROGRAM) && prog[c] >= 0)
+          drop(prog[c]);
+        prog[c] = i;
+        break;
+      case 0x90:
+        if (data2_[i] != 0)
+          bend[c] = prog[c] = -1;
+        break;
+      }
+    }
+  }
+}
+
+void MidiEventList::flush(MidiWrite* dest, bool all)
+{
+  // Events at the current tick stay behind, unless this is the last flush
+  int end = count_;
+  if (!all)
+    while (end > 0 && tick_[end - 1] == now_)
+      end--;
+
+  if (coalesce_)
+  {
+    coalesce();
+    if (!all)
+    {
+      // A pitchbend that could still be replaced has to stay behind too,
+      // along with the rest of its tick and everything after it
+      for (int c = 0; c < 16; c++)
+      {
+        if (pending_[c] >= 0 && pending_[c] < end &&
+            now_ - winstart_[c] <= window_)
+        {
+          end = pending_[c];
+        }
+      }
+      while (end > 0 && end < count_ && tick_[end - 1] == tick_[end])
+        end--;
+    }
+  }
+
+  if (passes_)
+  {
+    int start = 0;
+    for (int i = 1; i <= end; i++)
+    {
+      if (i == end || tick_[i] != tick_[start])
+      {
+        optimise(start, i);
+        start = i;
+      }
+    }
+  }
+
+  MIDIEVENT ev[256];
+  int n = 0;
+  for (int i = 0; i < end; i++)
+  {
+    int code = code_[i];
+    if (!code)
+      continue;
+    int c = code & 0x0F;
+    if ((code & 0xF0) == 0xE0)
+    {
+      int val = data1_[i] | (data2_[i] << 7);
+      if (((passes_ & EVPASS_PITCHBEND) && val == bend_[c]) ||
+          (bend_[c] >= 0 && abs(val - bend_[c]) < threshold_))
+      {
+        drop(i);
+        continue;
+      }
+      bend_[c] = val;
+    }
+    else if ((code & 0xF0) == 0xC0)
+    {
+      if ((passes_ & EVPASS_PROGRAM) && data1_[i] == prog_[c])
+      {
+        drop(i);
+        continue;
+      }
+      prog_[c] = data1_[i];
+    }
+    ev[n].ticks = tick_[i] - last_;
+    ev[n].code = (unsigned char)code;
+    ev[n].data[0] = data1_[i];
+    ev[n].data[1] = data2_[i];
+    last_ = tick_[i];
+    if (++n == sizeof(ev) / sizeof(ev[0]))
+    {
+      if (sink_)
+        sink_(sinkcontext_, ev, n);
+      else
+        dest->emit(ev, n);
+      n = 0;
+    }
+  }
+  if (n)
+  {
+    if (sink_)
+      sink_(sinkcontext_, ev, n);
+    else
+      dest->emit(ev, n);
+  }
+
+  count_ -= end;
+  scanned_ -= end;
+  for (int c = 0; c < 16; c++)
+  {
+    if (pending_[c] >= end)
+      pending_[c] -= end;
+    else
+      pending_[c] = -1; // written, so its window is over
+  }
+  if (count_)
+  {
+    memmove(tick_, tick_ + end, count_ * sizeof(unsigned long));
+    memmove(code_, code_ + end, count_);
+    memmove(data1_, data1_ + end, count_);
+    memmove(data2_, data2_ + end, count_);
+  }
+
+  if (all && now_ != last_)
+  {
+    if (sink_)
+    {
+      ev[0].ticks = now_ - last_;
+      ev[0].code = 0;
+      sink_(sinkcontext_, ev, 1);
+    }
+    else
+    {
+      dest->time(now_ - last_);
+    }
+    last_ = now_;
+  }
+}
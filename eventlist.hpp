@@ -0,0 +1,111 @@
+#ifndef __EVENTLIST__
+#define __EVENTLIST__
+
+#include "midiio.hpp"
+
+// Optional passes run over the events before they're written (see
+// MidiEventList::setpasses())
+#define EVPASS_EMPTYNOTES  1  // drop notes switched off at the tick they start
+#define EVPASS_PITCHBEND   2  // drop pitchbends that are overridden straight
+                              // away or don't change anything
+#define EVPASS_PROGRAM     4  // same for program changes
+#define EVPASS_ALL         7
+
+// Receives the events from MidiEventList::flush() in place of a MidiWrite
+// (see setsink().)  An event with a code of zero only carries a delay.
+typedef void (*MidiEventSink)(void* context, const MIDIEVENT* ev, int n);
+
+// The MIDI channel events produced by the conversion, held back in a list
+// (one array per field) until all the events at a given tick are known, so
+// that they can be tidied up before they're written out.  The methods for
+// adding events match MidiWrite's, and with no passes enabled the output is
+// exactly what calling them on the MidiWrite directly would give.
+class MidiEventList
+{
+public:
+  MidiEventList();
+  ~MidiEventList();
+
+  void setpasses(int passes) { passes_ = passes; }
+
+  // Channels (bit n for channel n) holding percussion, where a note sounds
+  // however short it is, so EVPASS_EMPTYNOTES leaves their notes alone
+  void setdrumchannels(unsigned mask) { drums_ = mask; }
+
+  // Thin out pitchbends.  A pitchbend on a channel opens a window of window
+  // ticks, and of all the pitchbends in it (up until a note is played) only
+  // the last is kept, so the pitch lags by at most that many ticks.  Any
+  // pitchbend less than threshold (in pitchbend units) from the value the
+  // channel already has is dropped as well.
+  void setbendfilter(unsigned long window, int threshold);
+
+  // Hand the events to sink when they're flushed, instead of writing them to
+  // the MidiWrite given to flush(), or go back to doing that if sink is NULL
+  void setsink(MidiEventSink sink, void* context)
+  {
+    sink_ = sink;
+    sinkcontext_ = context;
+  }
+
+  // Number of events removed by the passes and filter so far, and how many
+  // of those were pitchbends out of the number added
+  unsigned long dropped() { return dropped_; }
+  unsigned long droppedbends() { return droppedbends_; }
+  unsigned long bends() { return bends_; }
+
+  // Number of bytes allocated for events waiting to be written
+  unsigned long memused() { return size_ * (sizeof(unsigned long) + 3); }
+
+  // True once an event has been lost because there wasn't enough memory to
+  // store it, after which the output can't be trusted
+  bool failed() { return failed_; }
+
+  void time(unsigned long ticks) { now_ += ticks; }
+  void noteon(int channel, int note, int vel);
+  void noteoff(int channel, int note, int vel = 0);
+  void program(int channel, int prg);
+  void pitchbend(int channel, int val);
+
+  // Run the passes over every event before the current tick (more events
+  // may still be added at the current one) and write them out.  If all is
+  // set, everything is written, along with any time since the last event so
+  // that whatever is written next comes at the current tick.
+  void flush(MidiWrite* dest, bool all = false);
+
+protected:
+  unsigned long* tick_;  // absolute time of each event
+  unsigned char* code_;  // status byte, or 0 if the event has been dropped
+  unsigned char* data1_;
+  unsigned char* data2_;
+  int count_, size_;
+
+  unsigned long now_;   // time of the next event added
+  unsigned long last_;  // time of the last event written
+  int passes_;
+  unsigned drums_;
+  bool failed_;
+  unsigned long dropped_, droppedbends_, bends_;
+
+  // The value last written for each channel, or -1 if none has been
+  int bend_[16];
+  int prog_[16];
+
+  // Pitchbend filter
+  bool coalesce_;
+  unsigned long window_;
+  int threshold_;
+  int scanned_;  // events before this have been through coalesce()
+  unsigned long winstart_[16]; // when the current window on each channel began
+  int pending_[16];  // last pitchbend in the current window, or -1 if there's
+                     // no window open
+
+  MidiEventSink sink_;
+  void* sinkcontext_;
+
+  void add(int code, int data1, int data2);
+  void drop(int i);
+  void optimise(int start, int end);
+  void coalesce();
+};
+
+#endif
@@ -0,0 +1,4147 @@
+// Generated by gen_freqtable.cpp - do not edit
+//
+// To regenerate it after changing the formula: make freqtable.h
+//
+// MIDI key number (with fraction) for each OPL block and F-number, as
+// freqtable_X[block][fnum], for the conversion constant X.
+
+#ifndef __FREQTABLE__
+#define __FREQTABLE__
+
+#include <math.h>
+
+const double freqtable_49716[8][1024] = {
+{
+	-HUGE_VAL, -89.159245293891559, -77.159245293891559, -70.139695285237678,
+	-65.159245293891559, -61.296108155243218, -58.139695285237678, -55.470986229200307,
+	-53.159245293891559, -51.120145276583798, -49.296108155243218, -47.646065870244001,
+	-46.139695285237678, -44.75396867619844, -43.470986229200307, -42.276558146589338,
+	-41.159245293891559, -40.109691198887475, -39.120145276583798, -38.184115132568536,
+	-37.296108155243218, -36.451436220546441, -35.646065870244001, -34.876501821207398,
+	-34.139695285237678, -33.432971016594848, -32.75396867619844, -32.100595267929933,
+	-31.470986229200307, -30.8634733523607, -30.276558146589338, -29.708889569249052,
+	-29.159245293891559, -28.626515861590121, -28.109691198887475, -27.607849090551966,
+	-27.120145276583798, -26.645804906344154, -26.184115132568536, -25.734418667544574,
+	-25.296108155243218, -24.86862123847456, -24.451436220546441, -24.044068237466377,
+	-23.646065870243987, -23.257008137935458, -22.876501821207398, -22.504179073759914,
+	-22.139695285237678, -21.782727164509055, -21.432971016594863, -21.090141190233609,
+	-20.753968676198454, -20.424199839133166, -20.100595267929933, -19.782928731595646,
+	-19.470986229200307, -19.164565123914656, -18.863473352360685, -18.567528701549463,
+	-18.276558146589338, -17.990397243136925, -17.708889569249052, -17.431886211892561,
+	-17.159245293891559, -16.890831537550099, -16.626515861590107, -16.366175008398287,
+	-16.109691198887475, -15.856951812553532, -15.607849090551952, -15.362279859835382,
+	-15.120145276583798, -14.881350587331355, -14.645804906344154, -14.413421007940983,
+	-14.184115132568536, -13.957806805552735, -13.734418667544574, -13.513876315766325,
+	-13.296108155243218, -13.081045259276067, -12.86862123847456, -12.658772117728461,
+	-12.451436220546441, -12.246554060239134, -12.044068237466377, -11.84392334370682,
+	-11.646065870243987, -11.450444122294783, -11.257008137935458, -11.065709611507202,
+	-10.876501821207398, -10.689339560595187, -10.504179073759914, -10.320977993920181,
+	-10.139695285237678, -9.9602911876460212, -9.7827271645090548, -9.6069658529362414,
+	-9.4329710165948626, -9.2607075008700122, -9.0901411902336093, -8.9212389676929433,
+	-8.7539686761984541, -8.5882990818980858, -8.4241998391331663, -8.2616414570777863,
+	-8.1005952679299327, -7.941033396568443, -7.7829287315956464, -7.6262548976902877,
+	-7.4709862292003066, -7.3170977449093044, -7.1645651239146559, -7.0133646825590574,
+	-6.8634733523606855, -6.7148686588907083, -6.5675287015494632, -6.4214321341962375,
+	-6.2765581465893376, -6.1328864465964301, -5.9903972431369255, -5.8490712298206802,
+	-5.7088895692490524, -5.5698338779465075, -5.4318862118925608, -5.2950290526255657,
+	-5.1592452938915585, -5.0245182288124965, -4.890831537550099, -4.7581692754421567,
+	-4.6265158615901072, -4.4958560678772841, -4.3661750083982866, -4.2374581292815776,
+	-4.1096911988874751, -3.9828602983652388, -3.8569518125535325, -3.7319524212094706,
+	-3.6078490905519516, -3.4846290651060343, -3.3622798598353825, -3.2407892525508828,
+	-3.1201452765837985, -3.0003362137123304, -2.8813505873313545, -2.763177155855189,
+	-2.6458049063441536, -2.5292230483456137, -2.4134210079409826, -2.2983884219906088,
+	-2.184115132568536, -2.0705911815797435, -1.9578068055527353, -1.8457524306007116,
+	-1.7344186675445741, -1.6237963071920234, -1.5138763157663249, -1.4046498304792863,
+	-1.2961081552432177, -1.1882427565161464, -1.0810452592760669, -0.97450744311862536,
+	-0.86862123847456019, -0.76337872294176634, -0.65877211772846067, -0.55479378420292846,
+	-0.45143622054644084, -0.34869205850534968, -0.24655406023913429, -0.14501511526077593,
+	-0.044068237466376559, 0.056293437749147301, 0.15607665629318035, 0.25528804809638928,
+	0.35393412975601279, 0.45202130710441679, 0.54955587770521674, 0.64654403327952537,
+	0.74299186206454237, 0.83890535110690223, 0.93429038849279777, 1.0291527655169546,
+	1.1234981787926017, 1.2173322323041873, 1.3106604394048134, 1.4034882247600819,
+	1.4958209262400857, 1.5876637967613192, 1.6790220060798191, 1.7699006425374364,
+	1.8603047147623215, 1.9502391533254126, 2.0397088123539788, 2.128718471103781,
+	2.2172728354909452, 2.3053765395849553, 2.3930341470637586, 2.4802501526322374,
+	2.5670289834051374, 2.6533750002555792, 2.7392924991299878, 2.8247857123305522,
+	2.9098588097663907, 2.9945159001737949, 3.0787610323070567, 3.1625981961003475,
+	3.2460313238015459, 3.3290642910790353, 3.4117009181019142, 3.4939449705946686,
+	3.5758001608668337, 3.6572701488185118, 3.7383585429222137, 3.8190689011819643,
+	3.8994047320700673, 3.9793694954421994, 4.058966603431557, 4.1381994213225255,
+	4.2170712684043536, 4.2955854188056151, 4.3737451023097123, 4.4515535051521056,
+	4.5290137707996934, 4.6061290007128832, 4.6829022550906956, 4.759336553599411,
+	4.8354348760853441, 4.9112001632717721, 4.9866353174409426, 5.0617432031011305,
+	5.1365266476393145, 5.210988441959806, 5.2851313411092917, 5.3589580648884407,
+	5.4324712984505368, 5.5056736928875551, 5.5785678658037625, 5.6511564018774223,
+	5.7234418534106624, 5.7954267408679812, 5.8671135534035699, 5.9385047493778131,
+	6.0096027568630745, 6.0804099741392861, 6.1509287701793269, 6.2211614851245685,
+	6.2911104307509476, 6.3607778909254193, 6.4301661220534925, 6.4992773535177122,
+	6.5681137881074392, 6.6366776024401588, 6.7049709473744343, 6.7729959484147457,
+	6.8407547061084415, 6.9082492964349882, 6.9754817711874963, 7.0424541583470983,
+	7.109168462449901, 7.1756266649470604, 7.2418307245578504, 7.3077825776160736,
+	7.3734841384098928, 7.4389372995151888, 7.5041439321227159, 7.5691058863590968,
+	7.6338249916017134, 7.6983030567879354, 7.7625418707184224, 7.8265432023548982,
+	7.8903088011125178, 7.9538403971466778, 8.0171397016347612, 8.0802084070527087,
+	8.1430481874464675, 8.2056606986987077, 8.2680475787905294, 8.3302104480586934,
+	8.3921509094480484, 8.4538705487595536, 8.5153709348939657, 8.5766536200910366,
+	8.6377201401646246, 8.6985720147336991, 8.7592107474491172, 8.8196378262166988,
+	8.8798547234161944, 8.9398628961165869, 8.9996637862876625, 9.0592588210078588,
+	9.1186494126686455, 9.1778369591754227, 9.236822844144811, 9.2956084370988918,
+	9.3541950936558393, 9.4125841557176386, 9.4707769516543863, 9.5287747964857061,
+	9.5865789920590174, 9.6441908272248682, 9.7016115780093912, 9.7588425077838536,
+	9.8158848674314712, 9.8727398955114296, 9.9294088184202636, 9.9858928505505915,
+	10.042193194447265, 10.098311040960944, 10.154247569399288, 10.210003947675673,
+	10.265581332455426, 10.320980869299866, 10.376203692807977, 10.431250926755794,
+	10.486123684233675, 10.540823067781332, 10.595350169520707, 10.649706071286879,
+	10.703891844756789, 10.75790855157608, 10.811757243483854, 10.86543896243554,
+	10.91895474072394, 10.972305601098242, 11.025492556881375, 11.078516612085437,
+	11.13137876152544, 11.184079990931345, 11.236621277058234, 11.289003587795058,
+	11.341227882271539, 11.393295110963585, 11.445206215797072, 11.496962130250068,
+	11.548563779453566, 11.600012080290739, 11.65130794149465, 11.702452263744576,
+	11.753445939760859, 11.804289854398519, 11.854984884739217, 11.905531900182197,
+	11.955931762533623, 12.006185326094823, 12.056293437749147, 12.106256937047576,
+	12.15607665629318, 12.205753420624276, 12.255288048096389, 12.304681349763172,
+	12.353934129756013, 12.40304718536261, 12.45202130710441, 12.500857278812973,
+	12.549555877705217, 12.598117874457643, 12.646544033279525, 12.694835111985064,
+	12.742991862064535, 12.791015028754494, 12.838905351106902, 12.88666356205745,
+	12.934290388492798, 12.981786551317001, 13.029152765516955, 13.076389740227,
+	13.123498178792595, 13.1704787788332, 13.217332232304187, 13.264059225558078,
+	13.31066043940482, 13.357136549171294, 13.403488224760082, 13.449716130707365,
+	13.495820926240086, 13.541803265332412, 13.587663796761312, 13.63340316416155,
+	13.679022006079819, 13.724520956028307, 13.769900642537436, 13.815161689207933,
+	13.860304714762322, 13.905330333095613, 13.950239153325406, 13.995031779841369,
+	14.039708812353972, 14.084270845942754, 14.128718471103774, 14.173052273796671,
+	14.217272835490938, 14.261380733211723, 14.305376539584955, 14.34926082288203,
+	14.393034147063759, 14.436697071823936, 14.480250152632237, 14.523693940776589,
+	14.567028983405137, 14.610255823567485, 14.653375000255586, 14.696387048444052,
+	14.739292499129988, 14.782091879372288, 14.824785712330552, 14.867374517303404,
+	14.909858809766391, 14.952239101409432, 14.994515900173795, 15.036689710288641,
+	15.078761032307057, 15.120730363141789, 15.162598196100348, 15.20436502091988,
+	15.246031323801546, 15.287597587444402, 15.329064291079035, 15.370431910500656,
+	15.411700918101914, 15.452871782905206, 15.493944970594669, 15.534920943547846,
+	15.575800160866834, 15.616583078409207, 15.657270148818512, 15.697861821554326,
+	15.738358542922207, 15.77876075610299, 15.819068901181964, 15.859283415177629,
+	15.899404732070067, 15.939433282829143, 15.979369495442192, 16.019213794941535,
+	16.058966603431557, 16.098628340115624, 16.138199421322525, 16.177680260532746,
+	16.217071268404354, 16.256372852798691, 16.295585418805615, 16.334709368768664,
+	16.373745102309712, 16.412693016353558, 16.451553505152106, 16.490326960308252,
+	16.529013770799693, 16.567614323002203, 16.606129000712883, 16.644558185173011,
+	16.682902255090696, 16.721161586663264, 16.759336553599418, 16.797427527141146,
+	16.835434876085344, 16.873358966805284, 16.911200163271772, 16.948958827074136,
+	16.986635317440943, 17.024229991260498, 17.06174320310113, 17.099175305231277,
+	17.136526647639315, 17.173797578053168, 17.210988441959806, 17.248099582624384,
+	17.285131341109292, 17.322084056292958, 17.358958064888441, 17.395753701461842,
+	17.432471298450537, 17.469111186181181, 17.505673692887555, 17.54215914472816,
+	17.578567865803763, 17.61490017817458, 17.651156401877422, 17.687336854942608,
+	17.723441853410662, 17.759471711348951, 17.795426740867981, 17.831307252137719,
+	17.86711355340357, 17.90284595100232, 17.938504749377813, 17.974090251096548,
+	18.009602756863075, 18.045042565535248, 18.080409974139286, 18.115705277884757,
+	18.150928770179327, 18.186080742643384, 18.221161485124568, 18.256171285712099,
+	18.291110430750948, 18.325979204855884, 18.360777890925419, 18.395506770155571,
+	18.430166122053492, 18.464756224450944, 18.499277353517712, 18.533729783774767,
+	18.568113788107439, 18.602429637778329, 18.636677602440159, 18.67085795014853,
+	18.704970947374434, 18.739016859016786, 18.772995948414746, 18.806908477359904,
+	18.840754706108441, 18.87453489339309, 18.908249296434988, 18.941898170955412,
+	18.975481771187496, 19.009000349887657, 19.042454158347098, 19.075843446403013,
+	19.109168462449901, 19.142429453450539, 19.17562666494706, 19.208760341071738,
+	19.24183072455785, 19.274838056750255, 19.307782577616074, 19.340664525755017,
+	19.373484138409893, 19.406241651476748, 19.438937299515189, 19.471571315758283,
+	19.504143932122716, 19.536655379218558, 19.569105886359097, 19.601495681570555,
+	19.633824991601713, 19.666094041933398, 19.698303056787935, 19.730452259138502,
+	19.762541870718422, 19.794572112030224, 19.826543202354898, 19.858455359760782,
+	19.890308801112518, 19.922103742079912, 19.953840397146678, 19.98551897961913,
+	20.017139701634761, 20.04870277417082, 20.080208407052709, 20.111656808962337,
+	20.143048187446468, 20.174382748924927, 20.205660698698708, 20.236882240958067,
+	20.268047578790529, 20.299156914188828, 20.330210448058693, 20.361208380226728,
+	20.392150909448048, 20.423038233413962, 20.453870548759554, 20.484648051071204,
+	20.515370934893966, 20.546039393739044, 20.576653620091037, 20.607213805415185,
+	20.637720140164625, 20.668172813787429, 20.698572014733699, 20.728917930462558,
+	20.759210747449117, 20.789450651191302, 20.819637826216699, 20.849772456089298,
+	20.879854723416194, 20.909884809854233, 20.939862896116587, 20.969789161979278,
+	20.999663786287663, 21.029486946962791, 21.059258821007852, 21.088979584514405,
+	21.118649412668645, 21.148268479757647, 21.177836959175423, 21.207355023429066,
+	21.236822844144818, 21.266240592073977, 21.295608437098892, 21.324926548238835,
+	21.354195093655839, 21.383414240660485, 21.412584155717639, 21.441705004452118,
+	21.470776951654386, 21.499800161286103, 21.528774796485699, 21.557701019573869,
+	21.586578992059017, 21.615408874642668, 21.644190827224868, 21.672925008909466,
+	21.701611578009391, 21.730250692051925, 21.758842507783854, 21.787387181176626,
+	21.815884867431471, 21.844335720984432, 21.872739895511423, 21.901097543933197,
+	21.929408818420271, 21.957673870397819, 21.985892850550599, 22.014065908827668,
+	22.042193194447265, 22.070274855901459, 22.098311040960937, 22.126301896679621,
+	22.154247569399296, 22.18214820475422, 22.210003947675673, 22.237814942396469,
+	22.265581332455426, 22.293303260701833, 22.320980869299866, 22.348614299732915,
+	22.37620369280797, 22.403749188659916, 22.431250926755787, 22.458709045899028,
+	22.486123684233682, 22.513494979248534, 22.540823067781332, 22.568108086022789,
+	22.595350169520707, 22.62254945318405, 22.649706071286872, 22.676820157472378,
+	22.703891844756797, 22.73092126553334, 22.75790855157608, 22.784853834043808,
+	22.811757243483854, 22.838618909835844, 22.86543896243554, 22.892217530018534,
+	22.91895474072394, 22.945650722098108, 22.972305601098249, 22.998919504096072,
+	23.025492556881375, 23.052024884665613, 23.078516612085437, 23.104967863206198,
+	23.131378761525447, 23.157749429976398, 23.184079990931345, 23.210370566205064,
+	23.236621277058234, 23.262832244200744, 23.289003587795051, 23.315135427459495,
+	23.341227882271539, 23.367281070771071, 23.393295110963592, 23.419270120323468,
+	23.445206215797072, 23.471103513805971, 23.496962130250061, 23.522782180510646,
+	23.548563779453566, 23.574307041432249, 23.600012080290739, 23.625679009366763,
+	23.651307941494657, 23.676898989008407, 23.702452263744568, 23.727967877045231,
+	23.753445939760866, 23.778886562253305, 23.804289854398519, 23.829655925589527,
+	23.854984884739217, 23.880276840283109, 23.905531900182197, 23.930750171925645,
+	23.955931762533616, 23.981076778559938, 24.006185326094823, 24.031257510767546,
+	24.05629343774914, 24.08129321175501, 24.106256937047576, 24.131184717438884,
+	24.15607665629318, 24.180932856529523, 24.205753420624269, 24.230538450613686,
+	24.255288048096389, 24.280002314235922, 24.304681349763172, 24.329325254978869,
+	24.353934129756013, 24.378508073542314, 24.40304718536261, 24.427551563821225,
+	24.45202130710441, 24.476456512982637, 24.500857278812973, 24.525223701541428,
+	24.549555877705217, 24.573853903435108, 24.598117874457643, 24.622347886097465,
+	24.646544033279518, 24.670706410531302, 24.694835111985057, 24.718930231380021,
+	24.742991862064542, 24.767020096998309, 24.791015028754501, 24.814976749521861,
+	24.838905351106902, 24.862800924936003, 24.88666356205745, 24.910493353143579,
+	24.934290388492798, 24.958054758031686, 24.981786551316993, 25.005485857537693,
+	25.029152765516955, 25.052787363714188, 25.076389740227, 25.099959982793166,
+	25.123498178792602, 25.147004415249285, 25.170478778833193, 25.193921355862251,
+	25.217332232304187, 25.240711493778448, 25.264059225558086, 25.2873755125716,
+	25.31066043940482, 25.333914090302734, 25.357136549171301, 25.380327899579285,
+	25.403488224760082, 25.426617607613458, 25.449716130707365, 25.472783876279706,
+	25.495820926240093, 25.518827362171578, 25.541803265332419, 25.564748716657739,
+	25.587663796761319, 25.610548585937224, 25.633403164161543, 25.656227611094039,
+	25.679022006079819, 25.701786428150989, 25.724520956028307, 25.747225668122809,
+	25.769900642537429, 25.792545957068612, 25.815161689207926, 25.837747916143641,
+	25.860304714762322, 25.882832161650363, 25.905330333095606, 25.927799305088854,
+	25.950239153325406, 25.972649953206613, 25.995031779841369, 26.017384708047643,
+	26.039708812353979, 26.062004167000964, 26.084270845942747, 26.106508922848477,
+	26.128718471103774, 26.150899563812189, 26.173052273796671, 26.195176673600926,
+	26.217272835490945, 26.239340831456317, 26.261380733211716, 26.283392612198284,
+	26.305376539584962, 26.327332586269947, 26.34926082288203, 26.371161319781947,
+	26.393034147063759, 26.414879374556186, 26.436697071823936, 26.458487308169055,
+	26.48025015263223, 26.501985673994106, 26.523693940776596, 26.545375021244162,
+	26.567028983405137, 26.588655895012963, 26.610255823567485, 26.631828836316217,
+	26.653375000255586, 26.674894382132194, 26.696387048444052, 26.717853065441808,
+	26.739292499129981, 26.760705415268177, 26.782091879372288, 26.803451956715719,
+	26.824785712330552, 26.846093211008778, 26.867374517303404, 26.888629695529723,
+	26.909858809766391, 26.931061923856646, 26.952239101409432, 26.973390405800551,
+	26.994515900173795, 27.015615647442104, 27.036689710288641, 27.057738151167953,
+	27.078761032307064, 27.099758415706582, 27.120730363141789, 27.141676936163741,
+	27.162598196100348, 27.183494204057446, 27.204365020919887, 27.225210707352574,
+	27.246031323801546, 27.266826930495014, 27.287597587444409, 27.308343354445419,
+	27.329064291079035, 27.349760456712573, 27.370431910500663, 27.391078711386328,
+	27.411700918101914, 27.432298589170173, 27.452871782905198, 27.473420557413434,
+	27.493944970594669, 27.514445080143005, 27.534920943547839, 27.555372618094829,
+	27.575800160866834, 27.596203628744902, 27.616583078409207, 27.636938566339992,
+	27.657270148818505, 27.677577881927931, 27.697861821554326, 27.718122023387565,
+	27.738358542922207, 27.758571435458443, 27.77876075610299, 27.798926559770003,
+	27.819068901181971, 27.839187834870572, 27.859283415177622, 27.879355696255899,
+	27.899404732070067, 27.919430576397488, 27.939433282829143, 27.959412904770467,
+	27.979369495442192, 27.999303107881246, 28.019213794941528, 28.039101609294818,
+	28.058966603431557, 28.078808829661725, 28.098628340115624, 28.118425186744737,
+	28.138199421322525, 28.157951095445242, 28.177680260532739, 28.197386967829289,
+	28.217071268404354, 28.236733213153407, 28.256372852798691, 28.275990237890035,
+	28.295585418805622, 28.315158445752758, 28.334709368768664, 28.354238237721212,
+	28.373745102309719, 28.393230012065686, 28.412693016353565, 28.432134164371504,
+	28.451553505152098, 28.470951087563115, 28.490326960308252, 28.509681171927866,
+	28.529013770799693, 28.548324805139579, 28.567614323002211, 28.586882372281806,
+	28.606129000712883, 28.62535425587091, 28.644558185173018, 28.663740835878741,
+	28.682902255090696, 28.702042489755257, 28.721161586663264, 28.740259592450712,
+	28.759336553599425, 28.778392516437734, 28.797427527141146, 28.816441631733056,
+	28.835434876085344, 28.854407305919104, 28.873358966805284, 28.892289904165303,
+	28.911200163271772, 28.930089789249095, 28.948958827074136, 28.967807321576856,
+	28.986635317440943, 29.005442859204472, 29.024229991260498, 29.042996757857729,
+	29.06174320310113, 29.080469370952535, 29.099175305231284, 29.11786104961481,
+	29.136526647639307, 29.15517214270028, 29.173797578053168, 29.192402996813968,
+	29.210988441959806, 29.229553956329553, 29.248099582624391, 29.26662536340843,
+	29.285131341109292, 29.303617558018686, 29.322084056292965, 29.340530877953739,
+	29.358958064888441, 29.377365658850884, 29.395753701461842, 29.414122234209607,
+	29.432471298450537, 29.45080093540966, 29.469111186181188, 29.487402091729066,
+	29.505673692887555, 29.523926030361757, 29.54215914472816, 29.560373076435198,
+	29.57856786580377, 29.59674355302775, 29.61490017817458, 29.633037781185777,
+	29.651156401877429, 29.669256079940752, 29.687336854942608, 29.705398766326013,
+	29.723441853410669, 29.741466155393454, 29.759471711348944, 29.77745856022996,
+	29.795426740867981, 29.813376291973753, 29.831307252137719, 29.849219659830538,
+	29.867113553403577, 29.884988971089413, 29.90284595100232, 29.920684531138754,
+	29.938504749377813, 29.956306643481781, 29.974090251096548, 29.991855609752122,
+	30.009602756863075, 30.02733172972907, 30.045042565535248, 30.062735301352781,
+	30.080409974139286, 30.098066620739303, 30.115705277884764, 30.133325982195409,
+	30.15092877017932, 30.16851367823331, 30.186080742643384, 30.203629999585218,
+	30.221161485124576, 30.238675235217777, 30.256171285712107, 30.273649672346302,
+	30.291110430750948, 30.308553596448931, 30.325979204855884, 30.343387291280578,
+	30.360777890925419, 30.378151038886791, 30.395506770155571, 30.412845119617465,
+	30.430166122053485, 30.447469812140369, 30.464756224450944, 30.482025393454613,
+	30.499277353517705, 30.516512138903934, 30.533729783774767, 30.550930322189863,
+	30.568113788107439, 30.585280215384728, 30.602429637778329, 30.619562088944619,
+	30.636677602440166, 30.653776211722104, 30.67085795014853, 30.687922850978907,
+	30.704970947374434, 30.722002272398441, 30.739016859016786, 30.756014740098209,
+	30.772995948414746, 30.789960516642061, 30.806908477359897, 30.823839863052385,
+},
+{
+	-HUGE_VAL, -77.159245293891559, -65.159245293891559, -58.139695285237678,
+	-53.159245293891559, -49.296108155243218, -46.139695285237678, -43.470986229200307,
+	-41.159245293891559, -39.120145276583798, -37.296108155243218, -35.646065870244001,
+	-34.139695285237678, -32.75396867619844, -31.470986229200307, -30.276558146589338,
+	-29.159245293891559, -28.109691198887475, -27.120145276583798, -26.184115132568536,
+	-25.296108155243218, -24.451436220546441, -23.646065870243987, -22.876501821207398,
+	-22.139695285237678, -21.432971016594863, -20.753968676198454, -20.100595267929933,
+	-19.470986229200307, -18.863473352360685, -18.276558146589338, -17.708889569249052,
+	-17.159245293891559, -16.626515861590107, -16.109691198887475, -15.607849090551952,
+	-15.120145276583798, -14.645804906344154, -14.184115132568536, -13.734418667544574,
+	-13.296108155243218, -12.86862123847456, -12.451436220546441, -12.044068237466377,
+	-11.646065870243987, -11.257008137935458, -10.876501821207398, -10.504179073759914,
+	-10.139695285237678, -9.7827271645090548, -9.4329710165948626, -9.0901411902336093,
+	-8.7539686761984541, -8.4241998391331663, -8.1005952679299327, -7.7829287315956464,
+	-7.4709862292003066, -7.1645651239146559, -6.8634733523606855, -6.5675287015494632,
+	-6.2765581465893376, -5.9903972431369255, -5.7088895692490524, -5.4318862118925608,
+	-5.1592452938915585, -4.890831537550099, -4.6265158615901072, -4.3661750083982866,
+	-4.1096911988874751, -3.8569518125535325, -3.6078490905519516, -3.3622798598353825,
+	-3.1201452765837985, -2.8813505873313545, -2.6458049063441536, -2.4134210079409826,
+	-2.184115132568536, -1.9578068055527353, -1.7344186675445741, -1.5138763157663249,
+	-1.2961081552432177, -1.0810452592760669, -0.86862123847456019, -0.65877211772846067,
+	-0.45143622054644084, -0.24655406023913429, -0.044068237466376559, 0.15607665629318035,
+	0.35393412975601279, 0.54955587770521674, 0.74299186206454237, 0.93429038849279777,
+	1.1234981787926017, 1.3106604394048134, 1.4958209262400857, 1.6790220060798191,
+	1.8603047147623215, 2.0397088123539788, 2.2172728354909452, 2.3930341470637586,
+	2.5670289834051374, 2.7392924991299878, 2.9098588097663907, 3.0787610323070567,
+	3.2460313238015459, 3.4117009181019142, 3.5758001608668337, 3.7383585429222137,
+	3.8994047320700673, 4.058966603431557, 4.2170712684043536, 4.3737451023097123,
+	4.5290137707996934, 4.6829022550906956, 4.8354348760853441, 4.9866353174409426,
+	5.1365266476393145, 5.2851313411092917, 5.4324712984505368, 5.5785678658037625,
+	5.7234418534106624, 5.8671135534035699, 6.0096027568630745, 6.1509287701793269,
+	6.2911104307509476, 6.4301661220534925, 6.5681137881074392, 6.7049709473744343,
+	6.8407547061084415, 6.9754817711874963, 7.109168462449901, 7.2418307245578504,
+	7.3734841384098928, 7.5041439321227159, 7.6338249916017134, 7.7625418707184224,
+	7.8903088011125178, 8.0171397016347612, 8.1430481874464675, 8.2680475787905294,
+	8.3921509094480484, 8.5153709348939657, 8.6377201401646246, 8.7592107474491172,
+	8.8798547234161944, 8.9996637862876625, 9.1186494126686455, 9.236822844144811,
+	9.3541950936558393, 9.4707769516543863, 9.5865789920590174, 9.7016115780093912,
+	9.8158848674314712, 9.9294088184202636, 10.042193194447265, 10.154247569399288,
+	10.265581332455426, 10.376203692807977, 10.486123684233675, 10.595350169520707,
+	10.703891844756789, 10.811757243483854, 10.91895474072394, 11.025492556881375,
+	11.13137876152544, 11.236621277058234, 11.341227882271539, 11.445206215797072,
+	11.548563779453566, 11.65130794149465, 11.753445939760859, 11.854984884739217,
+	11.955931762533623, 12.056293437749147, 12.15607665629318, 12.255288048096389,
+	12.353934129756013, 12.45202130710441, 12.549555877705217, 12.646544033279525,
+	12.742991862064535, 12.838905351106902, 12.934290388492798, 13.029152765516955,
+	13.123498178792595, 13.217332232304187, 13.31066043940482, 13.403488224760082,
+	13.495820926240086, 13.587663796761312, 13.679022006079819, 13.769900642537436,
+	13.860304714762322, 13.950239153325406, 14.039708812353972, 14.128718471103774,
+	14.217272835490938, 14.305376539584955, 14.393034147063759, 14.480250152632237,
+	14.567028983405137, 14.653375000255586, 14.739292499129988, 14.824785712330552,
+	14.909858809766391, 14.994515900173795, 15.078761032307057, 15.162598196100348,
+	15.246031323801546, 15.329064291079035, 15.411700918101914, 15.493944970594669,
+	15.575800160866834, 15.657270148818512, 15.738358542922207, 15.819068901181964,
+	15.899404732070067, 15.979369495442192, 16.058966603431557, 16.138199421322525,
+	16.217071268404354, 16.295585418805615, 16.373745102309712, 16.451553505152106,
+	16.529013770799693, 16.606129000712883, 16.682902255090696, 16.759336553599418,
+	16.835434876085344, 16.911200163271772, 16.986635317440943, 17.06174320310113,
+	17.136526647639315, 17.210988441959806, 17.285131341109292, 17.358958064888441,
+	17.432471298450537, 17.505673692887555, 17.578567865803763, 17.651156401877422,
+	17.723441853410662, 17.795426740867981, 17.86711355340357, 17.938504749377813,
+	18.009602756863075, 18.080409974139286, 18.150928770179327, 18.221161485124568,
+	18.291110430750948, 18.360777890925419, 18.430166122053492, 18.499277353517712,
+	18.568113788107439, 18.636677602440159, 18.704970947374434, 18.772995948414746,
+	18.840754706108441, 18.908249296434988, 18.975481771187496, 19.042454158347098,
+	19.109168462449901, 19.17562666494706, 19.24183072455785, 19.307782577616074,
+	19.373484138409893, 19.438937299515189, 19.504143932122716, 19.569105886359097,
+	19.633824991601713, 19.698303056787935, 19.762541870718422, 19.826543202354898,
+	19.890308801112518, 19.953840397146678, 20.017139701634761, 20.080208407052709,
+	20.143048187446468, 20.205660698698708, 20.268047578790529, 20.330210448058693,
+	20.392150909448048, 20.453870548759554, 20.515370934893966, 20.576653620091037,
+	20.637720140164625, 20.698572014733699, 20.759210747449117, 20.819637826216699,
+	20.879854723416194, 20.939862896116587, 20.999663786287663, 21.059258821007852,
+	21.118649412668645, 21.177836959175423, 21.236822844144818, 21.295608437098892,
+	21.354195093655839, 21.412584155717639, 21.470776951654386, 21.528774796485699,
+	21.586578992059017, 21.644190827224868, 21.701611578009391, 21.758842507783854,
+	21.815884867431471, 21.872739895511423, 21.929408818420271, 21.985892850550599,
+	22.042193194447265, 22.098311040960937, 22.154247569399296, 22.210003947675673,
+	22.265581332455426, 22.320980869299866, 22.37620369280797, 22.431250926755787,
+	22.486123684233682, 22.540823067781332, 22.595350169520707, 22.649706071286872,
+	22.703891844756797, 22.75790855157608, 22.811757243483854, 22.86543896243554,
+	22.91895474072394, 22.972305601098249, 23.025492556881375, 23.078516612085437,
+	23.131378761525447, 23.184079990931345, 23.236621277058234, 23.289003587795051,
+	23.341227882271539, 23.393295110963592, 23.445206215797072, 23.496962130250061,
+	23.548563779453566, 23.600012080290739, 23.651307941494657, 23.702452263744568,
+	23.753445939760866, 23.804289854398519, 23.854984884739217, 23.905531900182197,
+	23.955931762533616, 24.006185326094823, 24.05629343774914, 24.106256937047576,
+	24.15607665629318, 24.205753420624269, 24.255288048096389, 24.304681349763172,
+	24.353934129756013, 24.40304718536261, 24.45202130710441, 24.500857278812973,
+	24.549555877705217, 24.598117874457643, 24.646544033279518, 24.694835111985057,
+	24.742991862064542, 24.791015028754501, 24.838905351106902, 24.88666356205745,
+	24.934290388492798, 24.981786551316993, 25.029152765516955, 25.076389740227,
+	25.123498178792602, 25.170478778833193, 25.217332232304187, 25.264059225558086,
+	25.31066043940482, 25.357136549171301, 25.403488224760082, 25.449716130707365,
+	25.495820926240093, 25.541803265332419, 25.587663796761319, 25.633403164161543,
+	25.679022006079819, 25.724520956028307, 25.769900642537429, 25.815161689207926,
+	25.860304714762322, 25.905330333095606, 25.950239153325406, 25.995031779841369,
+	26.039708812353979, 26.084270845942747, 26.128718471103774, 26.173052273796671,
+	26.217272835490945, 26.261380733211716, 26.305376539584962, 26.34926082288203,
+	26.393034147063759, 26.436697071823936, 26.48025015263223, 26.523693940776596,
+	26.567028983405137, 26.610255823567485, 26.653375000255586, 26.696387048444052,
+	26.739292499129981, 26.782091879372288, 26.824785712330552, 26.867374517303404,
+	26.909858809766391, 26.952239101409432, 26.994515900173795, 27.036689710288641,
+	27.078761032307064, 27.120730363141789, 27.162598196100348, 27.204365020919887,
+	27.246031323801546, 27.287597587444409, 27.329064291079035, 27.370431910500663,
+	27.411700918101914, 27.452871782905198, 27.493944970594669, 27.534920943547839,
+	27.575800160866834, 27.616583078409207, 27.657270148818505, 27.697861821554326,
+	27.738358542922207, 27.77876075610299, 27.819068901181971, 27.859283415177622,
+	27.899404732070067, 27.939433282829143, 27.979369495442192, 28.019213794941528,
+	28.058966603431557, 28.098628340115624, 28.138199421322525, 28.177680260532739,
+	28.217071268404354, 28.256372852798691, 28.295585418805622, 28.334709368768664,
+	28.373745102309719, 28.412693016353565, 28.451553505152098, 28.490326960308252,
+	28.529013770799693, 28.567614323002211, 28.606129000712883, 28.644558185173018,
+	28.682902255090696, 28.721161586663264, 28.759336553599425, 28.797427527141146,
+	28.835434876085344, 28.873358966805284, 28.911200163271772, 28.948958827074136,
+	28.986635317440943, 29.024229991260498, 29.06174320310113, 29.099175305231284,
+	29.136526647639307, 29.173797578053168, 29.210988441959806, 29.248099582624391,
+	29.285131341109292, 29.322084056292965, 29.358958064888441, 29.395753701461842,
+	29.432471298450537, 29.469111186181188, 29.505673692887555, 29.54215914472816,
+	29.57856786580377, 29.61490017817458, 29.651156401877429, 29.687336854942608,
+	29.723441853410669, 29.759471711348944, 29.795426740867981, 29.831307252137719,
+	29.867113553403577, 29.90284595100232, 29.938504749377813, 29.974090251096548,
+	30.009602756863075, 30.045042565535248, 30.080409974139286, 30.115705277884764,
+	30.15092877017932, 30.186080742643384, 30.221161485124576, 30.256171285712107,
+	30.291110430750948, 30.325979204855884, 30.360777890925419, 30.395506770155571,
+	30.430166122053485, 30.464756224450944, 30.499277353517705, 30.533729783774767,
+	30.568113788107439, 30.602429637778329, 30.636677602440166, 30.67085795014853,
+	30.704970947374434, 30.739016859016786, 30.772995948414746, 30.806908477359897,
+	30.840754706108441, 30.87453489339309, 30.908249296434981, 30.941898170955412,
+	30.975481771187489, 31.009000349887664, 31.042454158347091, 31.075843446403013,
+	31.109168462449894, 31.142429453450539, 31.17562666494706, 31.208760341071738,
+	31.24183072455785, 31.274838056750262, 31.307782577616074, 31.340664525755017,
+	31.373484138409886, 31.406241651476748, 31.438937299515182, 31.47157131575829,
+	31.504143932122723, 31.536655379218558, 31.569105886359097, 31.601495681570555,
+	31.633824991601713, 31.666094041933391, 31.698303056787935, 31.730452259138509,
+	31.762541870718415, 31.794572112030224, 31.826543202354905, 31.858455359760782,
+	31.890308801112518, 31.922103742079905, 31.953840397146671, 31.985518979619123,
+	32.017139701634761, 32.048702774170827, 32.080208407052709, 32.111656808962337,
+	32.143048187446475, 32.174382748924927, 32.205660698698708, 32.236882240958067,
+	32.268047578790537, 32.299156914188821, 32.330210448058693, 32.361208380226728,
+	32.392150909448041, 32.423038233413962, 32.453870548759554, 32.484648051071197,
+	32.515370934893966, 32.546039393739044, 32.576653620091029, 32.607213805415192,
+	32.637720140164632, 32.668172813787429, 32.698572014733692, 32.728917930462558,
+	32.759210747449117, 32.789450651191302, 32.819637826216699, 32.849772456089291,
+	32.879854723416187, 32.909884809854233, 32.939862896116587, 32.969789161979286,
+	32.999663786287655, 33.029486946962791, 33.059258821007852, 33.088979584514405,
+	33.118649412668645, 33.148268479757647, 33.177836959175423, 33.207355023429066,
+	33.236822844144818, 33.266240592073977, 33.295608437098892, 33.324926548238835,
+	33.354195093655839, 33.383414240660485, 33.412584155717639, 33.441705004452118,
+	33.470776951654386, 33.499800161286103, 33.528774796485699, 33.557701019573869,
+	33.586578992059017, 33.615408874642668, 33.644190827224868, 33.672925008909466,
+	33.701611578009391, 33.730250692051925, 33.758842507783854, 33.787387181176626,
+	33.815884867431471, 33.844335720984432, 33.872739895511423, 33.901097543933197,
+	33.929408818420271, 33.957673870397819, 33.985892850550599, 34.014065908827668,
+	34.042193194447265, 34.070274855901459, 34.098311040960937, 34.126301896679621,
+	34.154247569399296, 34.18214820475422, 34.210003947675673, 34.237814942396469,
+	34.265581332455426, 34.293303260701833, 34.320980869299866, 34.348614299732915,
+	34.37620369280797, 34.403749188659916, 34.431250926755787, 34.458709045899028,
+	34.486123684233682, 34.513494979248534, 34.540823067781332, 34.568108086022789,
+	34.595350169520707, 34.62254945318405, 34.649706071286872, 34.676820157472378,
+	34.703891844756797, 34.73092126553334, 34.75790855157608, 34.784853834043808,
+	34.811757243483854, 34.838618909835844, 34.86543896243554, 34.892217530018534,
+	34.91895474072394, 34.945650722098108, 34.972305601098249, 34.998919504096072,
+	35.025492556881375, 35.052024884665613, 35.078516612085437, 35.104967863206198,
+	35.131378761525447, 35.157749429976398, 35.184079990931345, 35.210370566205064,
+	35.236621277058234, 35.262832244200744, 35.289003587795051, 35.315135427459495,
+	35.341227882271539, 35.367281070771071, 35.393295110963592, 35.419270120323468,
+	35.445206215797072, 35.471103513805971, 35.496962130250061, 35.522782180510646,
+	35.548563779453566, 35.574307041432249, 35.600012080290739, 35.625679009366763,
+	35.651307941494657, 35.676898989008407, 35.702452263744568, 35.727967877045231,
+	35.753445939760866, 35.778886562253305, 35.804289854398519, 35.829655925589527,
+	35.854984884739217, 35.880276840283109, 35.905531900182197, 35.930750171925645,
+	35.955931762533616, 35.981076778559938, 36.006185326094823, 36.031257510767546,
+	36.05629343774914, 36.08129321175501, 36.106256937047576, 36.131184717438884,
+	36.15607665629318, 36.180932856529523, 36.205753420624269, 36.230538450613686,
+	36.255288048096389, 36.280002314235922, 36.304681349763172, 36.329325254978869,
+	36.353934129756013, 36.378508073542314, 36.40304718536261, 36.427551563821225,
+	36.45202130710441, 36.476456512982637, 36.500857278812973, 36.525223701541428,
+	36.549555877705217, 36.573853903435108, 36.598117874457643, 36.622347886097465,
+	36.646544033279518, 36.670706410531302, 36.694835111985057, 36.718930231380021,
+	36.742991862064542, 36.767020096998309, 36.791015028754501, 36.814976749521861,
+	36.838905351106902, 36.862800924936003, 36.88666356205745, 36.910493353143579,
+	36.934290388492798, 36.958054758031686, 36.981786551316993, 37.005485857537693,
+	37.029152765516955, 37.052787363714188, 37.076389740227, 37.099959982793166,
+	37.123498178792602, 37.147004415249285, 37.170478778833193, 37.193921355862251,
+	37.217332232304187, 37.240711493778448, 37.264059225558086, 37.2873755125716,
+	37.31066043940482, 37.333914090302734, 37.357136549171301, 37.380327899579285,
+	37.403488224760082, 37.426617607613458, 37.449716130707365, 37.472783876279706,
+	37.495820926240093, 37.518827362171578, 37.541803265332419, 37.564748716657739,
+	37.587663796761319, 37.610548585937224, 37.633403164161543, 37.656227611094039,
+	37.679022006079819, 37.701786428150989, 37.724520956028307, 37.747225668122809,
+	37.769900642537429, 37.792545957068612, 37.815161689207926, 37.837747916143641,
+	37.860304714762322, 37.882832161650363, 37.905330333095606, 37.927799305088854,
+	37.950239153325406, 37.972649953206613, 37.995031779841369, 38.017384708047643,
+	38.039708812353979, 38.062004167000964, 38.084270845942747, 38.106508922848477,
+	38.128718471103774, 38.150899563812189, 38.173052273796671, 38.195176673600926,
+	38.217272835490945, 38.239340831456317, 38.261380733211716, 38.283392612198284,
+	38.305376539584962, 38.327332586269947, 38.34926082288203, 38.371161319781947,
+	38.393034147063759, 38.414879374556186, 38.436697071823936, 38.458487308169055,
+	38.48025015263223, 38.501985673994106, 38.523693940776596, 38.545375021244162,
+	38.567028983405137, 38.588655895012963, 38.610255823567485, 38.631828836316217,
+	38.653375000255586, 38.674894382132194, 38.696387048444052, 38.717853065441808,
+	38.739292499129981, 38.760705415268177, 38.782091879372288, 38.803451956715719,
+	38.824785712330552, 38.846093211008778, 38.867374517303404, 38.888629695529723,
+	38.909858809766391, 38.931061923856646, 38.952239101409432, 38.973390405800551,
+	38.994515900173795, 39.015615647442104, 39.036689710288641, 39.057738151167953,
+	39.078761032307064, 39.099758415706582, 39.120730363141789, 39.141676936163741,
+	39.162598196100348, 39.183494204057446, 39.204365020919887, 39.225210707352574,
+	39.246031323801546, 39.266826930495014, 39.287597587444409, 39.308343354445419,
+	39.329064291079035, 39.349760456712573, 39.370431910500663, 39.391078711386328,
+	39.411700918101914, 39.432298589170173, 39.452871782905198, 39.473420557413434,
+	39.493944970594669, 39.514445080143005, 39.534920943547839, 39.555372618094829,
+	39.575800160866834, 39.596203628744902, 39.616583078409207, 39.636938566339992,
+	39.657270148818505, 39.677577881927931, 39.697861821554326, 39.718122023387565,
+	39.738358542922207, 39.758571435458443, 39.77876075610299, 39.798926559770003,
+	39.819068901181971, 39.839187834870572, 39.859283415177622, 39.879355696255899,
+	39.899404732070067, 39.919430576397488, 39.939433282829143, 39.959412904770467,
+	39.979369495442192, 39.999303107881246, 40.019213794941528, 40.039101609294818,
+	40.058966603431557, 40.078808829661725, 40.098628340115624, 40.118425186744737,
+	40.138199421322525, 40.157951095445242, 40.177680260532739, 40.197386967829289,
+	40.217071268404354, 40.236733213153407, 40.256372852798691, 40.275990237890035,
+	40.295585418805622, 40.315158445752758, 40.334709368768664, 40.354238237721212,
+	40.373745102309719, 40.393230012065686, 40.412693016353565, 40.432134164371504,
+	40.451553505152098, 40.470951087563115, 40.490326960308252, 40.509681171927866,
+	40.529013770799693, 40.548324805139579, 40.567614323002211, 40.586882372281806,
+	40.606129000712883, 40.62535425587091, 40.644558185173018, 40.663740835878741,
+	40.682902255090696, 40.702042489755257, 40.721161586663264, 40.740259592450712,
+	40.759336553599425, 40.778392516437734, 40.797427527141146, 40.816441631733056,
+	40.835434876085344, 40.854407305919104, 40.873358966805284, 40.892289904165303,
+	40.911200163271772, 40.930089789249095, 40.948958827074136, 40.967807321576856,
+	40.986635317440943, 41.005442859204472, 41.024229991260498, 41.042996757857729,
+	41.06174320310113, 41.080469370952535, 41.099175305231284, 41.11786104961481,
+	41.136526647639307, 41.15517214270028, 41.173797578053168, 41.192402996813968,
+	41.210988441959806, 41.229553956329553, 41.248099582624391, 41.26662536340843,
+	41.285131341109292, 41.303617558018686, 41.322084056292965, 41.340530877953739,
+	41.358958064888441, 41.377365658850884, 41.395753701461842, 41.414122234209607,
+	41.432471298450537, 41.45080093540966, 41.469111186181188, 41.487402091729066,
+	41.505673692887555, 41.523926030361757, 41.54215914472816, 41.560373076435198,
+	41.57856786580377, 41.59674355302775, 41.61490017817458, 41.633037781185777,
+	41.651156401877429, 41.669256079940752, 41.687336854942608, 41.705398766326013,
+	41.723441853410669, 41.741466155393454, 41.759471711348944, 41.77745856022996,
+	41.795426740867981, 41.813376291973753, 41.831307252137719, 41.849219659830538,
+	41.867113553403577, 41.884988971089413, 41.90284595100232, 41.920684531138754,
+	41.938504749377813, 41.956306643481781, 41.974090251096548, 41.991855609752122,
+	42.009602756863075, 42.02733172972907, 42.045042565535248, 42.062735301352781,
+	42.080409974139286, 42.098066620739303, 42.115705277884764, 42.133325982195409,
+	42.15092877017932, 42.16851367823331, 42.186080742643384, 42.203629999585218,
+	42.221161485124576, 42.238675235217777, 42.256171285712107, 42.273649672346302,
+	42.291110430750948, 42.308553596448931, 42.325979204855884, 42.343387291280578,
+	42.360777890925419, 42.378151038886791, 42.395506770155571, 42.412845119617465,
+	42.430166122053485, 42.447469812140369, 42.464756224450944, 42.482025393454613,
+	42.499277353517705, 42.516512138903934, 42.533729783774767, 42.550930322189863,
+	42.568113788107439, 42.585280215384728, 42.602429637778329, 42.619562088944619,
+	42.636677602440166, 42.653776211722104, 42.67085795014853, 42.687922850978907,
+	42.704970947374434, 42.722002272398441, 42.739016859016786, 42.756014740098209,
+	42.772995948414746, 42.789960516642061, 42.806908477359897, 42.823839863052385,
+},
+{
+	-HUGE_VAL, -65.159245293891559, -53.159245293891559, -46.139695285237678,
+	-41.159245293891559, -37.296108155243218, -34.139695285237678, -31.470986229200307,
+	-29.159245293891559, -27.120145276583798, -25.296108155243218, -23.646065870243987,
+	-22.139695285237678, -20.753968676198454, -19.470986229200307, -18.276558146589338,
+	-17.159245293891559, -16.109691198887475, -15.120145276583798, -14.184115132568536,
+	-13.296108155243218, -12.451436220546441, -11.646065870243987, -10.876501821207398,
+	-10.139695285237678, -9.4329710165948626, -8.7539686761984541, -8.1005952679299327,
+	-7.4709862292003066, -6.8634733523606855, -6.2765581465893376, -5.7088895692490524,
+	-5.1592452938915585, -4.6265158615901072, -4.1096911988874751, -3.6078490905519516,
+	-3.1201452765837985, -2.6458049063441536, -2.184115132568536, -1.7344186675445741,
+	-1.2961081552432177, -0.86862123847456019, -0.45143622054644084, -0.044068237466376559,
+	0.35393412975601279, 0.74299186206454237, 1.1234981787926017, 1.4958209262400857,
+	1.8603047147623215, 2.2172728354909452, 2.5670289834051374, 2.9098588097663907,
+	3.2460313238015459, 3.5758001608668337, 3.8994047320700673, 4.2170712684043536,
+	4.5290137707996934, 4.8354348760853441, 5.1365266476393145, 5.4324712984505368,
+	5.7234418534106624, 6.0096027568630745, 6.2911104307509476, 6.5681137881074392,
+	6.8407547061084415, 7.109168462449901, 7.3734841384098928, 7.6338249916017134,
+	7.8903088011125178, 8.1430481874464675, 8.3921509094480484, 8.6377201401646246,
+	8.8798547234161944, 9.1186494126686455, 9.3541950936558393, 9.5865789920590174,
+	9.8158848674314712, 10.042193194447265, 10.265581332455426, 10.486123684233675,
+	10.703891844756789, 10.91895474072394, 11.13137876152544, 11.341227882271539,
+	11.548563779453566, 11.753445939760859, 11.955931762533623, 12.15607665629318,
+	12.353934129756013, 12.549555877705217, 12.742991862064535, 12.934290388492798,
+	13.123498178792595, 13.31066043940482, 13.495820926240086, 13.679022006079819,
+	13.860304714762322, 14.039708812353972, 14.217272835490938, 14.393034147063759,
+	14.567028983405137, 14.739292499129988, 14.909858809766391, 15.078761032307057,
+	15.246031323801546, 15.411700918101914, 15.575800160866834, 15.738358542922207,
+	15.899404732070067, 16.058966603431557, 16.217071268404354, 16.373745102309712,
+	16.529013770799693, 16.682902255090696, 16.835434876085344, 16.986635317440943,
+	17.136526647639315, 17.285131341109292, 17.432471298450537, 17.578567865803763,
+	17.723441853410662, 17.86711355340357, 18.009602756863075, 18.150928770179327,
+	18.291110430750948, 18.430166122053492, 18.568113788107439, 18.704970947374434,
+	18.840754706108441, 18.975481771187496, 19.109168462449901, 19.24183072455785,
+	19.373484138409893, 19.504143932122716, 19.633824991601713, 19.762541870718422,
+	19.890308801112518, 20.017139701634761, 20.143048187446468, 20.268047578790529,
+	20.392150909448048, 20.515370934893966, 20.637720140164625, 20.759210747449117,
+	20.879854723416194, 20.999663786287663, 21.118649412668645, 21.236822844144818,
+	21.354195093655839, 21.470776951654386, 21.586578992059017, 21.701611578009391,
+	21.815884867431471, 21.929408818420271, 22.042193194447265, 22.154247569399296,
+	22.265581332455426, 22.37620369280797, 22.486123684233682, 22.595350169520707,
+	22.703891844756797, 22.811757243483854, 22.91895474072394, 23.025492556881375,
+	23.131378761525447, 23.236621277058234, 23.341227882271539, 23.445206215797072,
+	23.548563779453566, 23.651307941494657, 23.753445939760866, 23.854984884739217,
+	23.955931762533616, 24.05629343774914, 24.15607665629318, 24.255288048096389,
+	24.353934129756013, 24.45202130710441, 24.549555877705217, 24.646544033279518,
+	24.742991862064542, 24.838905351106902, 24.934290388492798, 25.029152765516955,
+	25.123498178792602, 25.217332232304187, 25.31066043940482, 25.403488224760082,
+	25.495820926240093, 25.587663796761319, 25.679022006079819, 25.769900642537429,
+	25.860304714762322, 25.950239153325406, 26.039708812353979, 26.128718471103774,
+	26.217272835490945, 26.305376539584962, 26.393034147063759, 26.48025015263223,
+	26.567028983405137, 26.653375000255586, 26.739292499129981, 26.824785712330552,
+	26.909858809766391, 26.994515900173795, 27.078761032307064, 27.162598196100348,
+	27.246031323801546, 27.329064291079035, 27.411700918101914, 27.493944970594669,
+	27.575800160866834, 27.657270148818505, 27.738358542922207, 27.819068901181971,
+	27.899404732070067, 27.979369495442192, 28.058966603431557, 28.138199421322525,
+	28.217071268404354, 28.295585418805622, 28.373745102309719, 28.451553505152098,
+	28.529013770799693, 28.606129000712883, 28.682902255090696, 28.759336553599425,
+	28.835434876085344, 28.911200163271772, 28.986635317440943, 29.06174320310113,
+	29.136526647639307, 29.210988441959806, 29.285131341109292, 29.358958064888441,
+	29.432471298450537, 29.505673692887555, 29.57856786580377, 29.651156401877429,
+	29.723441853410669, 29.795426740867981, 29.867113553403577, 29.938504749377813,
+	30.009602756863075, 30.080409974139286, 30.15092877017932, 30.221161485124576,
+	30.291110430750948, 30.360777890925419, 30.430166122053485, 30.499277353517705,
+	30.568113788107439, 30.636677602440166, 30.704970947374434, 30.772995948414746,
+	30.840754706108441, 30.908249296434981, 30.975481771187489, 31.042454158347091,
+	31.109168462449894, 31.17562666494706, 31.24183072455785, 31.307782577616074,
+	31.373484138409886, 31.438937299515182, 31.504143932122723, 31.569105886359097,
+	31.633824991601713, 31.698303056787935, 31.762541870718415, 31.826543202354905,
+	31.890308801112518, 31.953840397146671, 32.017139701634761, 32.080208407052709,
+	32.143048187446475, 32.205660698698708, 32.268047578790537, 32.330210448058693,
+	32.392150909448041, 32.453870548759554, 32.515370934893966, 32.576653620091029,
+	32.637720140164632, 32.698572014733692, 32.759210747449117, 32.819637826216699,
+	32.879854723416187, 32.939862896116587, 32.999663786287655, 33.059258821007852,
+	33.118649412668645, 33.177836959175423, 33.236822844144818, 33.295608437098892,
+	33.354195093655839, 33.412584155717639, 33.470776951654386, 33.528774796485699,
+	33.586578992059017, 33.644190827224868, 33.701611578009391, 33.758842507783854,
+	33.815884867431471, 33.872739895511423, 33.929408818420271, 33.985892850550599,
+	34.042193194447265, 34.098311040960937, 34.154247569399296, 34.210003947675673,
+	34.265581332455426, 34.320980869299866, 34.37620369280797, 34.431250926755787,
+	34.486123684233682, 34.540823067781332, 34.595350169520707, 34.649706071286872,
+	34.703891844756797, 34.75790855157608, 34.811757243483854, 34.86543896243554,
+	34.91895474072394, 34.972305601098249, 35.025492556881375, 35.078516612085437,
+	35.131378761525447, 35.184079990931345, 35.236621277058234, 35.289003587795051,
+	35.341227882271539, 35.393295110963592, 35.445206215797072, 35.496962130250061,
+	35.548563779453566, 35.600012080290739, 35.651307941494657, 35.702452263744568,
+	35.753445939760866, 35.804289854398519, 35.854984884739217, 35.905531900182197,
+	35.955931762533616, 36.006185326094823, 36.05629343774914, 36.106256937047576,
+	36.15607665629318, 36.205753420624269, 36.255288048096389, 36.304681349763172,
+	36.353934129756013, 36.40304718536261, 36.45202130710441, 36.500857278812973,
+	36.549555877705217, 36.598117874457643, 36.646544033279518, 36.694835111985057,
+	36.742991862064542, 36.791015028754501, 36.838905351106902, 36.88666356205745,
+	36.934290388492798, 36.981786551316993, 37.029152765516955, 37.076389740227,
+	37.123498178792602, 37.170478778833193, 37.217332232304187, 37.264059225558086,
+	37.31066043940482, 37.357136549171301, 37.403488224760082, 37.449716130707365,
+	37.495820926240093, 37.541803265332419, 37.587663796761319, 37.633403164161543,
+	37.679022006079819, 37.724520956028307, 37.769900642537429, 37.815161689207926,
+	37.860304714762322, 37.905330333095606, 37.950239153325406, 37.995031779841369,
+	38.039708812353979, 38.084270845942747, 38.128718471103774, 38.173052273796671,
+	38.217272835490945, 38.261380733211716, 38.305376539584962, 38.34926082288203,
+	38.393034147063759, 38.436697071823936, 38.48025015263223, 38.523693940776596,
+	38.567028983405137, 38.610255823567485, 38.653375000255586, 38.696387048444052,
+	38.739292499129981, 38.782091879372288, 38.824785712330552, 38.867374517303404,
+	38.909858809766391, 38.952239101409432, 38.994515900173795, 39.036689710288641,
+	39.078761032307064, 39.120730363141789, 39.162598196100348, 39.204365020919887,
+	39.246031323801546, 39.287597587444409, 39.329064291079035, 39.370431910500663,
+	39.411700918101914, 39.452871782905198, 39.493944970594669, 39.534920943547839,
+	39.575800160866834, 39.616583078409207, 39.657270148818505, 39.697861821554326,
+	39.738358542922207, 39.77876075610299, 39.819068901181971, 39.859283415177622,
+	39.899404732070067, 39.939433282829143, 39.979369495442192, 40.019213794941528,
+	40.058966603431557, 40.098628340115624, 40.138199421322525, 40.177680260532739,
+	40.217071268404354, 40.256372852798691, 40.295585418805622, 40.334709368768664,
+	40.373745102309719, 40.412693016353565, 40.451553505152098, 40.490326960308252,
+	40.529013770799693, 40.567614323002211, 40.606129000712883, 40.644558185173018,
+	40.682902255090696, 40.721161586663264, 40.759336553599425, 40.797427527141146,
+	40.835434876085344, 40.873358966805284, 40.911200163271772, 40.948958827074136,
+	40.986635317440943, 41.024229991260498, 41.06174320310113, 41.099175305231284,
+	41.136526647639307, 41.173797578053168, 41.210988441959806, 41.248099582624391,
+	41.285131341109292, 41.322084056292965, 41.358958064888441, 41.395753701461842,
+	41.432471298450537, 41.469111186181188, 41.505673692887555, 41.54215914472816,
+	41.57856786580377, 41.61490017817458, 41.651156401877429, 41.687336854942608,
+	41.723441853410669, 41.759471711348944, 41.795426740867981, 41.831307252137719,
+	41.867113553403577, 41.90284595100232, 41.938504749377813, 41.974090251096548,
+	42.009602756863075, 42.045042565535248, 42.080409974139286, 42.115705277884764,
+	42.15092877017932, 42.186080742643384, 42.221161485124576, 42.256171285712107,
+	42.291110430750948, 42.325979204855884, 42.360777890925419, 42.395506770155571,
+	42.430166122053485, 42.464756224450944, 42.499277353517705, 42.533729783774767,
+	42.568113788107439, 42.602429637778329, 42.636677602440166, 42.67085795014853,
+	42.704970947374434, 42.739016859016786, 42.772995948414746, 42.806908477359897,
+	42.840754706108441, 42.87453489339309, 42.908249296434981, 42.941898170955412,
+	42.975481771187489, 43.009000349887664, 43.042454158347091, 43.075843446403013,
+	43.109168462449894, 43.142429453450539, 43.17562666494706, 43.208760341071738,
+	43.24183072455785, 43.274838056750262, 43.307782577616074, 43.340664525755017,
+	43.373484138409886, 43.406241651476748, 43.438937299515182, 43.47157131575829,
+	43.504143932122723, 43.536655379218558, 43.569105886359097, 43.601495681570555,
+	43.633824991601713, 43.666094041933391, 43.698303056787935, 43.730452259138509,
+	43.762541870718415, 43.794572112030224, 43.826543202354905, 43.858455359760782,
+	43.890308801112518, 43.922103742079905, 43.953840397146671, 43.985518979619123,
+	44.017139701634761, 44.048702774170827, 44.080208407052709, 44.111656808962337,
+	44.143048187446475, 44.174382748924927, 44.205660698698708, 44.236882240958067,
+	44.268047578790537, 44.299156914188821, 44.330210448058693, 44.361208380226728,
+	44.392150909448041, 44.423038233413962, 44.453870548759554, 44.484648051071197,
+	44.515370934893966, 44.546039393739044, 44.576653620091029, 44.607213805415192,
+	44.637720140164632, 44.668172813787429, 44.698572014733692, 44.728917930462558,
+	44.759210747449117, 44.789450651191302, 44.819637826216699, 44.849772456089291,
+	44.879854723416187, 44.909884809854233, 44.939862896116587, 44.969789161979286,
+	44.999663786287655, 45.029486946962791, 45.059258821007852, 45.088979584514405,
+	45.118649412668645, 45.148268479757647, 45.177836959175423, 45.207355023429074,
+	45.236822844144818, 45.26624059207397, 45.295608437098892, 45.324926548238835,
+	45.354195093655839, 45.383414240660485, 45.412584155717639, 45.441705004452118,
+	45.470776951654386, 45.499800161286103, 45.528774796485706, 45.557701019573869,
+	45.586578992059017, 45.615408874642668, 45.644190827224868, 45.672925008909459,
+	45.701611578009391, 45.730250692051925, 45.758842507783854, 45.787387181176626,
+	45.815884867431471, 45.844335720984432, 45.87273989551143, 45.901097543933197,
+	45.929408818420271, 45.957673870397826, 45.985892850550599, 46.014065908827675,
+	46.042193194447258, 46.070274855901459, 46.098311040960937, 46.126301896679621,
+	46.154247569399296, 46.18214820475422, 46.210003947675673, 46.237814942396469,
+	46.265581332455426, 46.293303260701833, 46.320980869299866, 46.348614299732915,
+	46.37620369280797, 46.403749188659916, 46.431250926755787, 46.458709045899035,
+	46.486123684233682, 46.513494979248534, 46.540823067781332, 46.568108086022782,
+	46.595350169520714, 46.62254945318405, 46.649706071286872, 46.676820157472378,
+	46.703891844756797, 46.73092126553334, 46.75790855157608, 46.784853834043808,
+	46.811757243483854, 46.838618909835844, 46.865438962435547, 46.892217530018534,
+	46.91895474072394, 46.945650722098108, 46.972305601098249, 46.998919504096072,
+	47.025492556881375, 47.052024884665613, 47.078516612085437, 47.104967863206198,
+	47.131378761525447, 47.157749429976398, 47.184079990931338, 47.210370566205064,
+	47.236621277058234, 47.262832244200744, 47.289003587795051, 47.315135427459495,
+	47.341227882271539, 47.367281070771071, 47.393295110963592, 47.419270120323461,
+	47.445206215797072, 47.471103513805971, 47.496962130250061, 47.522782180510646,
+	47.548563779453573, 47.574307041432249, 47.600012080290746, 47.625679009366763,
+	47.65130794149465, 47.676898989008407, 47.702452263744568, 47.727967877045224,
+	47.753445939760866, 47.778886562253298, 47.804289854398519, 47.829655925589535,
+	47.854984884739217, 47.880276840283109, 47.905531900182197, 47.930750171925645,
+	47.955931762533616, 47.981076778559938, 48.006185326094823, 48.031257510767546,
+	48.05629343774914, 48.08129321175501, 48.106256937047576, 48.131184717438884,
+	48.15607665629318, 48.180932856529523, 48.205753420624269, 48.230538450613679,
+	48.255288048096389, 48.280002314235922, 48.304681349763172, 48.329325254978869,
+	48.353934129756013, 48.378508073542321, 48.40304718536261, 48.427551563821225,
+	48.452021307104417, 48.476456512982637, 48.500857278812973, 48.525223701541428,
+	48.549555877705217, 48.573853903435101, 48.598117874457643, 48.622347886097465,
+	48.646544033279518, 48.670706410531302, 48.694835111985057, 48.718930231380014,
+	48.742991862064542, 48.767020096998309, 48.791015028754501, 48.814976749521861,
+	48.838905351106909, 48.86280092493601, 48.88666356205745, 48.910493353143579,
+	48.934290388492798, 48.958054758031693, 48.981786551317001, 49.005485857537693,
+	49.029152765516955, 49.052787363714188, 49.076389740227, 49.099959982793166,
+	49.123498178792602, 49.147004415249285, 49.1704787788332, 49.193921355862258,
+	49.217332232304187, 49.240711493778448, 49.264059225558086, 49.2873755125716,
+	49.31066043940482, 49.333914090302727, 49.357136549171301, 49.380327899579285,
+	49.403488224760082, 49.426617607613451, 49.449716130707358, 49.472783876279706,
+	49.495820926240093, 49.518827362171578, 49.541803265332419, 49.564748716657739,
+	49.587663796761319, 49.610548585937224, 49.633403164161543, 49.656227611094039,
+	49.679022006079819, 49.701786428150989, 49.724520956028307, 49.747225668122809,
+	49.769900642537429, 49.792545957068612, 49.815161689207926, 49.837747916143641,
+	49.860304714762322, 49.882832161650363, 49.905330333095606, 49.927799305088854,
+	49.950239153325413, 49.972649953206613, 49.995031779841369, 50.017384708047643,
+	50.039708812353979, 50.062004167000964, 50.084270845942747, 50.106508922848477,
+	50.128718471103767, 50.150899563812196, 50.173052273796671, 50.195176673600933,
+	50.217272835490945, 50.239340831456317, 50.261380733211723, 50.283392612198284,
+	50.305376539584955, 50.327332586269947, 50.34926082288203, 50.371161319781947,
+	50.393034147063759, 50.414879374556186, 50.436697071823936, 50.458487308169055,
+	50.48025015263223, 50.501985673994106, 50.523693940776596, 50.545375021244162,
+	50.567028983405137, 50.588655895012963, 50.610255823567485, 50.631828836316217,
+	50.653375000255586, 50.674894382132194, 50.696387048444052, 50.717853065441808,
+	50.739292499129981, 50.760705415268177, 50.782091879372288, 50.803451956715719,
+	50.824785712330559, 50.846093211008778, 50.867374517303411, 50.888629695529723,
+	50.909858809766391, 50.931061923856646, 50.952239101409432, 50.973390405800544,
+	50.994515900173795, 51.015615647442104, 51.036689710288641, 51.057738151167953,
+	51.078761032307064, 51.099758415706582, 51.120730363141789, 51.141676936163741,
+	51.162598196100348, 51.183494204057446, 51.204365020919887, 51.225210707352574,
+	51.246031323801553, 51.266826930495014, 51.287597587444409, 51.308343354445419,
+	51.329064291079035, 51.349760456712573, 51.370431910500663, 51.391078711386321,
+	51.411700918101914, 51.432298589170173, 51.452871782905198, 51.473420557413434,
+	51.493944970594669, 51.514445080143005, 51.534920943547839, 51.555372618094829,
+	51.575800160866834, 51.596203628744902, 51.616583078409214, 51.636938566339992,
+	51.657270148818505, 51.677577881927924, 51.697861821554326, 51.718122023387565,
+	51.738358542922207, 51.758571435458443, 51.77876075610299, 51.79892655977001,
+	51.819068901181964, 51.839187834870572, 51.859283415177622, 51.879355696255899,
+	51.899404732070067, 51.919430576397488, 51.939433282829143, 51.95941290477046,
+	51.979369495442199, 51.999303107881246, 52.019213794941535, 52.039101609294818,
+	52.058966603431557, 52.078808829661725, 52.098628340115624, 52.118425186744737,
+	52.138199421322525, 52.157951095445242, 52.177680260532739, 52.197386967829289,
+	52.217071268404361, 52.236733213153407, 52.256372852798691, 52.275990237890042,
+	52.295585418805622, 52.315158445752758, 52.334709368768664, 52.354238237721212,
+	52.373745102309712, 52.393230012065686, 52.412693016353565, 52.432134164371504,
+	52.451553505152098, 52.470951087563122, 52.490326960308252, 52.509681171927866,
+	52.529013770799693, 52.548324805139579, 52.567614323002203, 52.586882372281814,
+	52.606129000712883, 52.62535425587091, 52.644558185173018, 52.663740835878741,
+	52.682902255090696, 52.702042489755257, 52.721161586663271, 52.740259592450712,
+	52.759336553599425, 52.778392516437727, 52.797427527141153, 52.816441631733056,
+	52.835434876085344, 52.854407305919111, 52.873358966805277, 52.892289904165303,
+	52.911200163271772, 52.930089789249095, 52.948958827074136, 52.967807321576856,
+	52.986635317440943, 53.005442859204472, 53.024229991260498, 53.042996757857736,
+	53.06174320310113, 53.080469370952535, 53.099175305231284, 53.11786104961481,
+	53.136526647639307, 53.15517214270028, 53.173797578053168, 53.192402996813968,
+	53.210988441959806, 53.229553956329553, 53.248099582624391, 53.26662536340843,
+	53.285131341109299, 53.303617558018686, 53.322084056292965, 53.340530877953739,
+	53.358958064888441, 53.377365658850884, 53.395753701461842, 53.4141222342096,
+	53.432471298450537, 53.45080093540966, 53.469111186181188, 53.487402091729066,
+	53.505673692887555, 53.523926030361757, 53.542159144728167, 53.560373076435205,
+	53.57856786580377, 53.59674355302775, 53.61490017817458, 53.633037781185777,
+	53.651156401877429, 53.669256079940752, 53.687336854942608, 53.705398766326013,
+	53.723441853410662, 53.741466155393454, 53.759471711348951, 53.77745856022996,
+	53.795426740867981, 53.813376291973753, 53.831307252137719, 53.849219659830538,
+	53.867113553403577, 53.884988971089413, 53.902845951002327, 53.920684531138754,
+	53.938504749377813, 53.956306643481781, 53.974090251096555, 53.991855609752122,
+	54.009602756863075, 54.02733172972907, 54.045042565535248, 54.062735301352788,
+	54.080409974139286, 54.09806662073931, 54.115705277884757, 54.133325982195409,
+	54.15092877017932, 54.16851367823331, 54.186080742643384, 54.203629999585218,
+	54.221161485124576, 54.238675235217777, 54.256171285712107, 54.273649672346302,
+	54.291110430750948, 54.308553596448931, 54.325979204855877, 54.343387291280578,
+	54.360777890925412, 54.378151038886799, 54.395506770155571, 54.412845119617465,
+	54.430166122053485, 54.447469812140369, 54.464756224450944, 54.482025393454613,
+	54.499277353517705, 54.516512138903934, 54.533729783774767, 54.550930322189863,
+	54.568113788107439, 54.585280215384728, 54.602429637778329, 54.619562088944619,
+	54.636677602440166, 54.653776211722104, 54.67085795014853, 54.687922850978907,
+	54.704970947374434, 54.722002272398441, 54.739016859016786, 54.756014740098209,
+	54.772995948414739, 54.789960516642061, 54.806908477359897, 54.823839863052385,
+},
+{
+	-HUGE_VAL, -53.159245293891559, -41.159245293891559, -34.139695285237678,
+	-29.159245293891559, -25.296108155243218, -22.139695285237678, -19.470986229200307,
+	-17.159245293891559, -15.120145276583798, -13.296108155243218, -11.646065870243987,
+	-10.139695285237678, -8.7539686761984541, -7.4709862292003066, -6.2765581465893376,
+	-5.1592452938915585, -4.1096911988874751, -3.1201452765837985, -2.184115132568536,
+	-1.2961081552432177, -0.45143622054644084, 0.35393412975601279, 1.1234981787926017,
+	1.8603047147623215, 2.5670289834051374, 3.2460313238015459, 3.8994047320700673,
+	4.5290137707996934, 5.1365266476393145, 5.7234418534106624, 6.2911104307509476,
+	6.8407547061084415, 7.3734841384098928, 7.8903088011125178, 8.3921509094480484,
+	8.8798547234161944, 9.3541950936558393, 9.8158848674314712, 10.265581332455426,
+	10.703891844756789, 11.13137876152544, 11.548563779453566, 11.955931762533623,
+	12.353934129756013, 12.742991862064535, 13.123498178792595, 13.495820926240086,
+	13.860304714762322, 14.217272835490938, 14.567028983405137, 14.909858809766391,
+	15.246031323801546, 15.575800160866834, 15.899404732070067, 16.217071268404354,
+	16.529013770799693, 16.835434876085344, 17.136526647639315, 17.432471298450537,
+	17.723441853410662, 18.009602756863075, 18.291110430750948, 18.568113788107439,
+	18.840754706108441, 19.109168462449901, 19.373484138409893, 19.633824991601713,
+	19.890308801112518, 20.143048187446468, 20.392150909448048, 20.637720140164625,
+	20.879854723416194, 21.118649412668645, 21.354195093655839, 21.586578992059017,
+	21.815884867431471, 22.042193194447265, 22.265581332455426, 22.486123684233682,
+	22.703891844756797, 22.91895474072394, 23.131378761525447, 23.341227882271539,
+	23.548563779453566, 23.753445939760866, 23.955931762533616, 24.15607665629318,
+	24.353934129756013, 24.549555877705217, 24.742991862064542, 24.934290388492798,
+	25.123498178792602, 25.31066043940482, 25.495820926240093, 25.679022006079819,
+	25.860304714762322, 26.039708812353979, 26.217272835490945, 26.393034147063759,
+	26.567028983405137, 26.739292499129981, 26.909858809766391, 27.078761032307064,
+	27.246031323801546, 27.411700918101914, 27.575800160866834, 27.738358542922207,
+	27.899404732070067, 28.058966603431557, 28.217071268404354, 28.373745102309719,
+	28.529013770799693, 28.682902255090696, 28.835434876085344, 28.986635317440943,
+	29.136526647639307, 29.285131341109292, 29.432471298450537, 29.57856786580377,
+	29.723441853410669, 29.867113553403577, 30.009602756863075, 30.15092877017932,
+	30.291110430750948, 30.430166122053485, 30.568113788107439, 30.704970947374434,
+	30.840754706108441, 30.975481771187489, 31.109168462449894, 31.24183072455785,
+	31.373484138409886, 31.504143932122723, 31.633824991601713, 31.762541870718415,
+	31.890308801112518, 32.017139701634761, 32.143048187446475, 32.268047578790537,
+	32.392150909448041, 32.515370934893966, 32.637720140164632, 32.759210747449117,
+	32.879854723416187, 32.999663786287655, 33.118649412668645, 33.236822844144818,
+	33.354195093655839, 33.470776951654386, 33.586578992059017, 33.701611578009391,
+	33.815884867431471, 33.929408818420271, 34.042193194447265, 34.154247569399296,
+	34.265581332455426, 34.37620369280797, 34.486123684233682, 34.595350169520707,
+	34.703891844756797, 34.811757243483854, 34.91895474072394, 35.025492556881375,
+	35.131378761525447, 35.236621277058234, 35.341227882271539, 35.445206215797072,
+	35.548563779453566, 35.651307941494657, 35.753445939760866, 35.854984884739217,
+	35.955931762533616, 36.05629343774914, 36.15607665629318, 36.255288048096389,
+	36.353934129756013, 36.45202130710441, 36.549555877705217, 36.646544033279518,
+	36.742991862064542, 36.838905351106902, 36.934290388492798, 37.029152765516955,
+	37.123498178792602, 37.217332232304187, 37.31066043940482, 37.403488224760082,
+	37.495820926240093, 37.587663796761319, 37.679022006079819, 37.769900642537429,
+	37.860304714762322, 37.950239153325406, 38.039708812353979, 38.128718471103774,
+	38.217272835490945, 38.305376539584962, 38.393034147063759, 38.48025015263223,
+	38.567028983405137, 38.653375000255586, 38.739292499129981, 38.824785712330552,
+	38.909858809766391, 38.994515900173795, 39.078761032307064, 39.162598196100348,
+	39.246031323801546, 39.329064291079035, 39.411700918101914, 39.493944970594669,
+	39.575800160866834, 39.657270148818505, 39.738358542922207, 39.819068901181971,
+	39.899404732070067, 39.979369495442192, 40.058966603431557, 40.138199421322525,
+	40.217071268404354, 40.295585418805622, 40.373745102309719, 40.451553505152098,
+	40.529013770799693, 40.606129000712883, 40.682902255090696, 40.759336553599425,
+	40.835434876085344, 40.911200163271772, 40.986635317440943, 41.06174320310113,
+	41.136526647639307, 41.210988441959806, 41.285131341109292, 41.358958064888441,
+	41.432471298450537, 41.505673692887555, 41.57856786580377, 41.651156401877429,
+	41.723441853410669, 41.795426740867981, 41.867113553403577, 41.938504749377813,
+	42.009602756863075, 42.080409974139286, 42.15092877017932, 42.221161485124576,
+	42.291110430750948, 42.360777890925419, 42.430166122053485, 42.499277353517705,
+	42.568113788107439, 42.636677602440166, 42.704970947374434, 42.772995948414746,
+	42.840754706108441, 42.908249296434981, 42.975481771187489, 43.042454158347091,
+	43.109168462449894, 43.17562666494706, 43.24183072455785, 43.307782577616074,
+	43.373484138409886, 43.438937299515182, 43.504143932122723, 43.569105886359097,
+	43.633824991601713, 43.698303056787935, 43.762541870718415, 43.826543202354905,
+	43.890308801112518, 43.953840397146671, 44.017139701634761, 44.080208407052709,
+	44.143048187446475, 44.205660698698708, 44.268047578790537, 44.330210448058693,
+	44.392150909448041, 44.453870548759554, 44.515370934893966, 44.576653620091029,
+	44.637720140164632, 44.698572014733692, 44.759210747449117, 44.819637826216699,
+	44.879854723416187, 44.939862896116587, 44.999663786287655, 45.059258821007852,
+	45.118649412668645, 45.177836959175423, 45.236822844144818, 45.295608437098892,
+	45.354195093655839, 45.412584155717639, 45.470776951654386, 45.528774796485706,
+	45.586578992059017, 45.644190827224868, 45.701611578009391, 45.758842507783854,
+	45.815884867431471, 45.87273989551143, 45.929408818420271, 45.985892850550599,
+	46.042193194447258, 46.098311040960937, 46.154247569399296, 46.210003947675673,
+	46.265581332455426, 46.320980869299866, 46.37620369280797, 46.431250926755787,
+	46.486123684233682, 46.540823067781332, 46.595350169520714, 46.649706071286872,
+	46.703891844756797, 46.75790855157608, 46.811757243483854, 46.865438962435547,
+	46.91895474072394, 46.972305601098249, 47.025492556881375, 47.078516612085437,
+	47.131378761525447, 47.184079990931338, 47.236621277058234, 47.289003587795051,
+	47.341227882271539, 47.393295110963592, 47.445206215797072, 47.496962130250061,
+	47.548563779453573, 47.600012080290746, 47.65130794149465, 47.702452263744568,
+	47.753445939760866, 47.804289854398519, 47.854984884739217, 47.905531900182197,
+	47.955931762533616, 48.006185326094823, 48.05629343774914, 48.106256937047576,
+	48.15607665629318, 48.205753420624269, 48.255288048096389, 48.304681349763172,
+	48.353934129756013, 48.40304718536261, 48.452021307104417, 48.500857278812973,
+	48.549555877705217, 48.598117874457643, 48.646544033279518, 48.694835111985057,
+	48.742991862064542, 48.791015028754501, 48.838905351106909, 48.88666356205745,
+	48.934290388492798, 48.981786551317001, 49.029152765516955, 49.076389740227,
+	49.123498178792602, 49.1704787788332, 49.217332232304187, 49.264059225558086,
+	49.31066043940482, 49.357136549171301, 49.403488224760082, 49.449716130707358,
+	49.495820926240093, 49.541803265332419, 49.587663796761319, 49.633403164161543,
+	49.679022006079819, 49.724520956028307, 49.769900642537429, 49.815161689207926,
+	49.860304714762322, 49.905330333095606, 49.950239153325413, 49.995031779841369,
+	50.039708812353979, 50.084270845942747, 50.128718471103767, 50.173052273796671,
+	50.217272835490945, 50.261380733211723, 50.305376539584955, 50.34926082288203,
+	50.393034147063759, 50.436697071823936, 50.48025015263223, 50.523693940776596,
+	50.567028983405137, 50.610255823567485, 50.653375000255586, 50.696387048444052,
+	50.739292499129981, 50.782091879372288, 50.824785712330559, 50.867374517303411,
+	50.909858809766391, 50.952239101409432, 50.994515900173795, 51.036689710288641,
+	51.078761032307064, 51.120730363141789, 51.162598196100348, 51.204365020919887,
+	51.246031323801553, 51.287597587444409, 51.329064291079035, 51.370431910500663,
+	51.411700918101914, 51.452871782905198, 51.493944970594669, 51.534920943547839,
+	51.575800160866834, 51.616583078409214, 51.657270148818505, 51.697861821554326,
+	51.738358542922207, 51.77876075610299, 51.819068901181964, 51.859283415177622,
+	51.899404732070067, 51.939433282829143, 51.979369495442199, 52.019213794941535,
+	52.058966603431557, 52.098628340115624, 52.138199421322525, 52.177680260532739,
+	52.217071268404361, 52.256372852798691, 52.295585418805622, 52.334709368768664,
+	52.373745102309712, 52.412693016353565, 52.451553505152098, 52.490326960308252,
+	52.529013770799693, 52.567614323002203, 52.606129000712883, 52.644558185173018,
+	52.682902255090696, 52.721161586663271, 52.759336553599425, 52.797427527141153,
+	52.835434876085344, 52.873358966805277, 52.911200163271772, 52.948958827074136,
+	52.986635317440943, 53.024229991260498, 53.06174320310113, 53.099175305231284,
+	53.136526647639307, 53.173797578053168, 53.210988441959806, 53.248099582624391,
+	53.285131341109299, 53.322084056292965, 53.358958064888441, 53.395753701461842,
+	53.432471298450537, 53.469111186181188, 53.505673692887555, 53.542159144728167,
+	53.57856786580377, 53.61490017817458, 53.651156401877429, 53.687336854942608,
+	53.723441853410662, 53.759471711348951, 53.795426740867981, 53.831307252137719,
+	53.867113553403577, 53.902845951002327, 53.938504749377813, 53.974090251096555,
+	54.009602756863075, 54.045042565535248, 54.080409974139286, 54.115705277884757,
+	54.15092877017932, 54.186080742643384, 54.221161485124576, 54.256171285712107,
+	54.291110430750948, 54.325979204855877, 54.360777890925412, 54.395506770155571,
+	54.430166122053485, 54.464756224450944, 54.499277353517705, 54.533729783774767,
+	54.568113788107439, 54.602429637778329, 54.636677602440166, 54.67085795014853,
+	54.704970947374434, 54.739016859016786, 54.772995948414739, 54.806908477359897,
+	54.840754706108441, 54.87453489339309, 54.908249296434981, 54.941898170955412,
+	54.975481771187489, 55.009000349887657, 55.042454158347091, 55.075843446403013,
+	55.109168462449901, 55.142429453450546, 55.17562666494706, 55.208760341071738,
+	55.241830724557843, 55.274838056750262, 55.307782577616074, 55.340664525755017,
+	55.373484138409886, 55.406241651476755, 55.438937299515182, 55.47157131575829,
+	55.504143932122716, 55.536655379218558, 55.56910588635909, 55.601495681570555,
+	55.633824991601713, 55.666094041933391, 55.698303056787935, 55.730452259138509,
+	55.762541870718415, 55.794572112030224, 55.826543202354905, 55.858455359760782,
+	55.890308801112511, 55.922103742079912, 55.953840397146671, 55.985518979619123,
+	56.017139701634761, 56.048702774170827, 56.080208407052709, 56.111656808962337,
+	56.143048187446475, 56.174382748924927, 56.205660698698708, 56.236882240958067,
+	56.268047578790537, 56.299156914188828, 56.330210448058693, 56.361208380226728,
+	56.392150909448041, 56.423038233413962, 56.453870548759554, 56.484648051071197,
+	56.515370934893966, 56.546039393739051, 56.576653620091029, 56.607213805415185,
+	56.637720140164632, 56.668172813787422, 56.698572014733692, 56.728917930462558,
+	56.759210747449117, 56.789450651191302, 56.819637826216692, 56.849772456089298,
+	56.879854723416187, 56.909884809854233, 56.939862896116594, 56.969789161979286,
+	56.999663786287655, 57.029486946962791, 57.059258821007852, 57.088979584514398,
+	57.118649412668645, 57.148268479757647, 57.177836959175423, 57.207355023429074,
+	57.236822844144811, 57.26624059207397, 57.295608437098892, 57.324926548238835,
+	57.354195093655839, 57.383414240660485, 57.412584155717639, 57.441705004452118,
+	57.470776951654386, 57.499800161286103, 57.528774796485706, 57.557701019573869,
+	57.586578992059017, 57.615408874642668, 57.644190827224868, 57.672925008909459,
+	57.701611578009391, 57.730250692051925, 57.758842507783854, 57.787387181176626,
+	57.815884867431471, 57.844335720984432, 57.87273989551143, 57.901097543933197,
+	57.929408818420271, 57.957673870397826, 57.985892850550599, 58.014065908827668,
+	58.042193194447258, 58.070274855901459, 58.098311040960937, 58.126301896679621,
+	58.154247569399296, 58.18214820475422, 58.210003947675673, 58.237814942396469,
+	58.265581332455426, 58.293303260701833, 58.320980869299866, 58.348614299732915,
+	58.37620369280797, 58.403749188659916, 58.431250926755787, 58.458709045899035,
+	58.486123684233675, 58.513494979248541, 58.540823067781332, 58.568108086022782,
+	58.595350169520714, 58.62254945318405, 58.649706071286872, 58.676820157472378,
+	58.703891844756797, 58.73092126553334, 58.75790855157608, 58.784853834043808,
+	58.811757243483846, 58.838618909835844, 58.865438962435547, 58.892217530018534,
+	58.91895474072394, 58.945650722098108, 58.972305601098249, 58.998919504096065,
+	59.025492556881375, 59.052024884665613, 59.078516612085437, 59.104967863206198,
+	59.131378761525447, 59.157749429976398, 59.184079990931345, 59.210370566205064,
+	59.236621277058234, 59.262832244200744, 59.289003587795051, 59.315135427459495,
+	59.341227882271539, 59.367281070771071, 59.393295110963592, 59.419270120323461,
+	59.445206215797072, 59.471103513805971, 59.496962130250061, 59.522782180510646,
+	59.548563779453573, 59.574307041432249, 59.600012080290746, 59.625679009366763,
+	59.65130794149465, 59.676898989008407, 59.702452263744568, 59.727967877045224,
+	59.753445939760866, 59.778886562253298, 59.804289854398512, 59.829655925589527,
+	59.854984884739217, 59.880276840283109, 59.90553190018219, 59.930750171925645,
+	59.955931762533616, 59.981076778559938, 60.006185326094823, 60.031257510767546,
+	60.05629343774914, 60.08129321175501, 60.106256937047576, 60.131184717438884,
+	60.15607665629318, 60.180932856529523, 60.205753420624269, 60.230538450613679,
+	60.255288048096389, 60.280002314235922, 60.304681349763172, 60.329325254978869,
+	60.353934129756013, 60.378508073542314, 60.40304718536261, 60.427551563821225,
+	60.45202130710441, 60.476456512982637, 60.50085727881298, 60.525223701541428,
+	60.549555877705217, 60.573853903435101, 60.598117874457643, 60.622347886097465,
+	60.646544033279518, 60.670706410531295, 60.694835111985057, 60.718930231380014,
+	60.742991862064542, 60.767020096998309, 60.791015028754501, 60.814976749521861,
+	60.838905351106909, 60.862800924936003, 60.88666356205745, 60.910493353143579,
+	60.934290388492798, 60.958054758031693, 60.981786551317001, 61.005485857537693,
+	61.029152765516955, 61.052787363714188, 61.076389740227, 61.099959982793166,
+	61.123498178792602, 61.147004415249285, 61.1704787788332, 61.193921355862258,
+	61.217332232304187, 61.240711493778448, 61.264059225558086, 61.2873755125716,
+	61.31066043940482, 61.333914090302734, 61.357136549171301, 61.380327899579285,
+	61.403488224760082, 61.426617607613451, 61.449716130707365, 61.472783876279706,
+	61.495820926240093, 61.518827362171578, 61.541803265332419, 61.564748716657739,
+	61.587663796761319, 61.610548585937224, 61.633403164161543, 61.656227611094039,
+	61.679022006079819, 61.701786428150989, 61.724520956028307, 61.747225668122809,
+	61.769900642537429, 61.792545957068612, 61.815161689207926, 61.837747916143641,
+	61.860304714762322, 61.882832161650363, 61.905330333095606, 61.927799305088854,
+	61.950239153325406, 61.972649953206613, 61.995031779841369, 62.017384708047643,
+	62.039708812353972, 62.062004167000964, 62.084270845942747, 62.106508922848477,
+	62.128718471103774, 62.150899563812196, 62.173052273796671, 62.195176673600933,
+	62.217272835490945, 62.239340831456317, 62.261380733211723, 62.283392612198284,
+	62.305376539584955, 62.327332586269947, 62.34926082288203, 62.371161319781947,
+	62.393034147063759, 62.414879374556186, 62.436697071823936, 62.458487308169055,
+	62.48025015263223, 62.501985673994106, 62.523693940776596, 62.545375021244162,
+	62.567028983405137, 62.588655895012963, 62.610255823567485, 62.631828836316217,
+	62.653375000255586, 62.674894382132194, 62.696387048444052, 62.717853065441808,
+	62.739292499129981, 62.760705415268177, 62.782091879372288, 62.803451956715719,
+	62.824785712330559, 62.846093211008778, 62.867374517303411, 62.888629695529723,
+	62.909858809766391, 62.931061923856646, 62.952239101409432, 62.973390405800551,
+	62.994515900173795, 63.015615647442104, 63.036689710288641, 63.057738151167953,
+	63.078761032307064, 63.099758415706582, 63.120730363141789, 63.141676936163741,
+	63.162598196100348, 63.183494204057446, 63.204365020919887, 63.225210707352574,
+	63.246031323801553, 63.266826930495014, 63.287597587444409, 63.308343354445419,
+	63.329064291079035, 63.349760456712573, 63.370431910500663, 63.391078711386321,
+	63.411700918101914, 63.432298589170173, 63.452871782905198, 63.473420557413434,
+	63.493944970594669, 63.514445080143005, 63.534920943547846, 63.555372618094829,
+	63.575800160866834, 63.596203628744902, 63.616583078409214, 63.63693856634,
+	63.657270148818505, 63.677577881927924, 63.697861821554326, 63.718122023387565,
+	63.738358542922207, 63.758571435458443, 63.77876075610299, 63.798926559770003,
+	63.819068901181964, 63.839187834870572, 63.859283415177622, 63.879355696255899,
+	63.899404732070067, 63.919430576397488, 63.939433282829143, 63.95941290477046,
+	63.979369495442192, 63.999303107881246, 64.019213794941535, 64.039101609294818,
+	64.058966603431557, 64.078808829661725, 64.098628340115624, 64.118425186744744,
+	64.138199421322525, 64.157951095445242, 64.177680260532739, 64.197386967829289,
+	64.217071268404354, 64.2367332131534, 64.256372852798691, 64.275990237890042,
+	64.295585418805615, 64.315158445752758, 64.334709368768657, 64.354238237721205,
+	64.373745102309712, 64.393230012065686, 64.412693016353558, 64.432134164371504,
+	64.451553505152106, 64.470951087563122, 64.490326960308252, 64.509681171927866,
+	64.529013770799693, 64.548324805139572, 64.567614323002203, 64.586882372281806,
+	64.606129000712883, 64.625354255870903, 64.644558185173011, 64.663740835878741,
+	64.682902255090696, 64.702042489755257, 64.721161586663271, 64.740259592450712,
+	64.759336553599425, 64.778392516437734, 64.797427527141153, 64.816441631733056,
+	64.835434876085344, 64.854407305919111, 64.873358966805284, 64.892289904165295,
+	64.911200163271772, 64.930089789249095, 64.948958827074136, 64.967807321576856,
+	64.986635317440943, 65.005442859204464, 65.024229991260498, 65.042996757857736,
+	65.06174320310113, 65.080469370952542, 65.099175305231284, 65.117861049614817,
+	65.136526647639315, 65.15517214270028, 65.173797578053168, 65.192402996813968,
+	65.210988441959813, 65.229553956329553, 65.248099582624391, 65.266625363408437,
+	65.285131341109292, 65.303617558018686, 65.322084056292965, 65.340530877953739,
+	65.358958064888441, 65.377365658850891, 65.395753701461842, 65.4141222342096,
+	65.432471298450537, 65.45080093540966, 65.469111186181181, 65.487402091729066,
+	65.505673692887555, 65.52392603036175, 65.54215914472816, 65.560373076435198,
+	65.578567865803763, 65.59674355302775, 65.61490017817458, 65.633037781185777,
+	65.651156401877429, 65.669256079940752, 65.6873368549426, 65.705398766326013,
+	65.723441853410662, 65.741466155393454, 65.759471711348951, 65.77745856022996,
+	65.795426740867981, 65.813376291973753, 65.831307252137719, 65.849219659830538,
+	65.867113553403584, 65.884988971089413, 65.90284595100232, 65.920684531138747,
+	65.938504749377813, 65.956306643481781, 65.974090251096555, 65.991855609752122,
+	66.009602756863075, 66.02733172972907, 66.045042565535255, 66.062735301352788,
+	66.080409974139286, 66.098066620739303, 66.115705277884757, 66.133325982195416,
+	66.15092877017932, 66.16851367823331, 66.186080742643384, 66.203629999585218,
+	66.221161485124583, 66.238675235217769, 66.256171285712114, 66.273649672346295,
+	66.291110430750948, 66.308553596448931, 66.325979204855884, 66.343387291280578,
+	66.360777890925419, 66.378151038886799, 66.395506770155578, 66.412845119617458,
+	66.430166122053492, 66.447469812140369, 66.464756224450952, 66.482025393454606,
+	66.499277353517712, 66.516512138903934, 66.533729783774774, 66.550930322189856,
+	66.568113788107439, 66.585280215384728, 66.602429637778329, 66.619562088944619,
+	66.636677602440159, 66.653776211722104, 66.67085795014853, 66.687922850978907,
+	66.704970947374434, 66.722002272398441, 66.739016859016786, 66.756014740098209,
+	66.772995948414746, 66.789960516642068, 66.806908477359897, 66.823839863052385,
+},
+{
+	-HUGE_VAL, -41.159245293891559, -29.159245293891559, -22.139695285237678,
+	-17.159245293891559, -13.296108155243218, -10.139695285237678, -7.4709862292003066,
+	-5.1592452938915585, -3.1201452765837985, -1.2961081552432177, 0.35393412975601279,
+	1.8603047147623215, 3.2460313238015459, 4.5290137707996934, 5.7234418534106624,
+	6.8407547061084415, 7.8903088011125178, 8.8798547234161944, 9.8158848674314712,
+	10.703891844756789, 11.548563779453566, 12.353934129756013, 13.123498178792595,
+	13.860304714762322, 14.567028983405137, 15.246031323801546, 15.899404732070067,
+	16.529013770799693, 17.136526647639315, 17.723441853410662, 18.291110430750948,
+	18.840754706108441, 19.373484138409893, 19.890308801112518, 20.392150909448048,
+	20.879854723416194, 21.354195093655839, 21.815884867431471, 22.265581332455426,
+	22.703891844756797, 23.131378761525447, 23.548563779453566, 23.955931762533616,
+	24.353934129756013, 24.742991862064542, 25.123498178792602, 25.495820926240093,
+	25.860304714762322, 26.217272835490945, 26.567028983405137, 26.909858809766391,
+	27.246031323801546, 27.575800160866834, 27.899404732070067, 28.217071268404354,
+	28.529013770799693, 28.835434876085344, 29.136526647639307, 29.432471298450537,
+	29.723441853410669, 30.009602756863075, 30.291110430750948, 30.568113788107439,
+	30.840754706108441, 31.109168462449894, 31.373484138409886, 31.633824991601713,
+	31.890308801112518, 32.143048187446475, 32.392150909448041, 32.637720140164632,
+	32.879854723416187, 33.118649412668645, 33.354195093655839, 33.586578992059017,
+	33.815884867431471, 34.042193194447265, 34.265581332455426, 34.486123684233682,
+	34.703891844756797, 34.91895474072394, 35.131378761525447, 35.341227882271539,
+	35.548563779453566, 35.753445939760866, 35.955931762533616, 36.15607665629318,
+	36.353934129756013, 36.549555877705217, 36.742991862064542, 36.934290388492798,
+	37.123498178792602, 37.31066043940482, 37.495820926240093, 37.679022006079819,
+	37.860304714762322, 38.039708812353979, 38.217272835490945, 38.393034147063759,
+	38.567028983405137, 38.739292499129981, 38.909858809766391, 39.078761032307064,
+	39.246031323801546, 39.411700918101914, 39.575800160866834, 39.738358542922207,
+	39.899404732070067, 40.058966603431557, 40.217071268404354, 40.373745102309719,
+	40.529013770799693, 40.682902255090696, 40.835434876085344, 40.986635317440943,
+	41.136526647639307, 41.285131341109292, 41.432471298450537, 41.57856786580377,
+	41.723441853410669, 41.867113553403577, 42.009602756863075, 42.15092877017932,
+	42.291110430750948, 42.430166122053485, 42.568113788107439, 42.704970947374434,
+	42.840754706108441, 42.975481771187489, 43.109168462449894, 43.24183072455785,
+	43.373484138409886, 43.504143932122723, 43.633824991601713, 43.762541870718415,
+	43.890308801112518, 44.017139701634761, 44.143048187446475, 44.268047578790537,
+	44.392150909448041, 44.515370934893966, 44.637720140164632, 44.759210747449117,
+	44.879854723416187, 44.999663786287655, 45.118649412668645, 45.236822844144818,
+	45.354195093655839, 45.470776951654386, 45.586578992059017, 45.701611578009391,
+	45.815884867431471, 45.929408818420271, 46.042193194447258, 46.154247569399296,
+	46.265581332455426, 46.37620369280797, 46.486123684233682, 46.595350169520714,
+	46.703891844756797, 46.811757243483854, 46.91895474072394, 47.025492556881375,
+	47.131378761525447, 47.236621277058234, 47.341227882271539, 47.445206215797072,
+	47.548563779453573, 47.65130794149465, 47.753445939760866, 47.854984884739217,
+	47.955931762533616, 48.05629343774914, 48.15607665629318, 48.255288048096389,
+	48.353934129756013, 48.452021307104417, 48.549555877705217, 48.646544033279518,
+	48.742991862064542, 48.838905351106909, 48.934290388492798, 49.029152765516955,
+	49.123498178792602, 49.217332232304187, 49.31066043940482, 49.403488224760082,
+	49.495820926240093, 49.587663796761319, 49.679022006079819, 49.769900642537429,
+	49.860304714762322, 49.950239153325413, 50.039708812353979, 50.128718471103767,
+	50.217272835490945, 50.305376539584955, 50.393034147063759, 50.48025015263223,
+	50.567028983405137, 50.653375000255586, 50.739292499129981, 50.824785712330559,
+	50.909858809766391, 50.994515900173795, 51.078761032307064, 51.162598196100348,
+	51.246031323801553, 51.329064291079035, 51.411700918101914, 51.493944970594669,
+	51.575800160866834, 51.657270148818505, 51.738358542922207, 51.819068901181964,
+	51.899404732070067, 51.979369495442199, 52.058966603431557, 52.138199421322525,
+	52.217071268404361, 52.295585418805622, 52.373745102309712, 52.451553505152098,
+	52.529013770799693, 52.606129000712883, 52.682902255090696, 52.759336553599425,
+	52.835434876085344, 52.911200163271772, 52.986635317440943, 53.06174320310113,
+	53.136526647639307, 53.210988441959806, 53.285131341109299, 53.358958064888441,
+	53.432471298450537, 53.505673692887555, 53.57856786580377, 53.651156401877429,
+	53.723441853410662, 53.795426740867981, 53.867113553403577, 53.938504749377813,
+	54.009602756863075, 54.080409974139286, 54.15092877017932, 54.221161485124576,
+	54.291110430750948, 54.360777890925412, 54.430166122053485, 54.499277353517705,
+	54.568113788107439, 54.636677602440166, 54.704970947374434, 54.772995948414739,
+	54.840754706108441, 54.908249296434981, 54.975481771187489, 55.042454158347091,
+	55.109168462449901, 55.17562666494706, 55.241830724557843, 55.307782577616074,
+	55.373484138409886, 55.438937299515182, 55.504143932122716, 55.56910588635909,
+	55.633824991601713, 55.698303056787935, 55.762541870718415, 55.826543202354905,
+	55.890308801112511, 55.953840397146671, 56.017139701634761, 56.080208407052709,
+	56.143048187446475, 56.205660698698708, 56.268047578790537, 56.330210448058693,
+	56.392150909448041, 56.453870548759554, 56.515370934893966, 56.576653620091029,
+	56.637720140164632, 56.698572014733692, 56.759210747449117, 56.819637826216692,
+	56.879854723416187, 56.939862896116594, 56.999663786287655, 57.059258821007852,
+	57.118649412668645, 57.177836959175423, 57.236822844144811, 57.295608437098892,
+	57.354195093655839, 57.412584155717639, 57.470776951654386, 57.528774796485706,
+	57.586578992059017, 57.644190827224868, 57.701611578009391, 57.758842507783854,
+	57.815884867431471, 57.87273989551143, 57.929408818420271, 57.985892850550599,
+	58.042193194447258, 58.098311040960937, 58.154247569399296, 58.210003947675673,
+	58.265581332455426, 58.320980869299866, 58.37620369280797, 58.431250926755787,
+	58.486123684233675, 58.540823067781332, 58.595350169520714, 58.649706071286872,
+	58.703891844756797, 58.75790855157608, 58.811757243483846, 58.865438962435547,
+	58.91895474072394, 58.972305601098249, 59.025492556881375, 59.078516612085437,
+	59.131378761525447, 59.184079990931345, 59.236621277058234, 59.289003587795051,
+	59.341227882271539, 59.393295110963592, 59.445206215797072, 59.496962130250061,
+	59.548563779453573, 59.600012080290746, 59.65130794149465, 59.702452263744568,
+	59.753445939760866, 59.804289854398512, 59.854984884739217, 59.90553190018219,
+	59.955931762533616, 60.006185326094823, 60.05629343774914, 60.106256937047576,
+	60.15607665629318, 60.205753420624269, 60.255288048096389, 60.304681349763172,
+	60.353934129756013, 60.40304718536261, 60.45202130710441, 60.50085727881298,
+	60.549555877705217, 60.598117874457643, 60.646544033279518, 60.694835111985057,
+	60.742991862064542, 60.791015028754501, 60.838905351106909, 60.88666356205745,
+	60.934290388492798, 60.981786551317001, 61.029152765516955, 61.076389740227,
+	61.123498178792602, 61.1704787788332, 61.217332232304187, 61.264059225558086,
+	61.31066043940482, 61.357136549171301, 61.403488224760082, 61.449716130707365,
+	61.495820926240093, 61.541803265332419, 61.587663796761319, 61.633403164161543,
+	61.679022006079819, 61.724520956028307, 61.769900642537429, 61.815161689207926,
+	61.860304714762322, 61.905330333095606, 61.950239153325406, 61.995031779841369,
+	62.039708812353972, 62.084270845942747, 62.128718471103774, 62.173052273796671,
+	62.217272835490945, 62.261380733211723, 62.305376539584955, 62.34926082288203,
+	62.393034147063759, 62.436697071823936, 62.48025015263223, 62.523693940776596,
+	62.567028983405137, 62.610255823567485, 62.653375000255586, 62.696387048444052,
+	62.739292499129981, 62.782091879372288, 62.824785712330559, 62.867374517303411,
+	62.909858809766391, 62.952239101409432, 62.994515900173795, 63.036689710288641,
+	63.078761032307064, 63.120730363141789, 63.162598196100348, 63.204365020919887,
+	63.246031323801553, 63.287597587444409, 63.329064291079035, 63.370431910500663,
+	63.411700918101914, 63.452871782905198, 63.493944970594669, 63.534920943547846,
+	63.575800160866834, 63.616583078409214, 63.657270148818505, 63.697861821554326,
+	63.738358542922207, 63.77876075610299, 63.819068901181964, 63.859283415177622,
+	63.899404732070067, 63.939433282829143, 63.979369495442192, 64.019213794941535,
+	64.058966603431557, 64.098628340115624, 64.138199421322525, 64.177680260532739,
+	64.217071268404354, 64.256372852798691, 64.295585418805615, 64.334709368768657,
+	64.373745102309712, 64.412693016353558, 64.451553505152106, 64.490326960308252,
+	64.529013770799693, 64.567614323002203, 64.606129000712883, 64.644558185173011,
+	64.682902255090696, 64.721161586663271, 64.759336553599425, 64.797427527141153,
+	64.835434876085344, 64.873358966805284, 64.911200163271772, 64.948958827074136,
+	64.986635317440943, 65.024229991260498, 65.06174320310113, 65.099175305231284,
+	65.136526647639315, 65.173797578053168, 65.210988441959813, 65.248099582624391,
+	65.285131341109292, 65.322084056292965, 65.358958064888441, 65.395753701461842,
+	65.432471298450537, 65.469111186181181, 65.505673692887555, 65.54215914472816,
+	65.578567865803763, 65.61490017817458, 65.651156401877429, 65.6873368549426,
+	65.723441853410662, 65.759471711348951, 65.795426740867981, 65.831307252137719,
+	65.867113553403584, 65.90284595100232, 65.938504749377813, 65.974090251096555,
+	66.009602756863075, 66.045042565535255, 66.080409974139286, 66.115705277884757,
+	66.15092877017932, 66.186080742643384, 66.221161485124583, 66.256171285712114,
+	66.291110430750948, 66.325979204855884, 66.360777890925419, 66.395506770155578,
+	66.430166122053492, 66.464756224450952, 66.499277353517712, 66.533729783774774,
+	66.568113788107439, 66.602429637778329, 66.636677602440159, 66.67085795014853,
+	66.704970947374434, 66.739016859016786, 66.772995948414746, 66.806908477359897,
+	66.840754706108441, 66.87453489339309, 66.908249296434974, 66.941898170955412,
+	66.975481771187489, 67.009000349887657, 67.042454158347084, 67.075843446403013,
+	67.109168462449901, 67.142429453450546, 67.17562666494706, 67.208760341071738,
+	67.241830724557843, 67.274838056750269, 67.307782577616067, 67.340664525755017,
+	67.373484138409879, 67.406241651476748, 67.438937299515175, 67.471571315758283,
+	67.504143932122716, 67.536655379218558, 67.569105886359097, 67.601495681570555,
+	67.633824991601713, 67.666094041933391, 67.698303056787935, 67.730452259138502,
+	67.762541870718422, 67.794572112030224, 67.826543202354898, 67.858455359760782,
+	67.890308801112511, 67.922103742079912, 67.953840397146678, 67.98551897961913,
+	68.017139701634761, 68.048702774170835, 68.080208407052709, 68.111656808962337,
+	68.143048187446468, 68.174382748924927, 68.205660698698708, 68.236882240958067,
+	68.268047578790529, 68.299156914188828, 68.330210448058693, 68.361208380226728,
+	68.392150909448034, 68.423038233413962, 68.453870548759554, 68.484648051071204,
+	68.515370934893966, 68.546039393739051, 68.576653620091037, 68.607213805415185,
+	68.637720140164632, 68.668172813787422, 68.698572014733699, 68.728917930462558,
+	68.759210747449117, 68.789450651191302, 68.819637826216692, 68.849772456089298,
+	68.879854723416187, 68.909884809854233, 68.939862896116594, 68.969789161979278,
+	68.999663786287655, 69.029486946962791, 69.059258821007845, 69.088979584514405,
+	69.118649412668645, 69.148268479757647, 69.177836959175423, 69.207355023429074,
+	69.236822844144811, 69.26624059207397, 69.295608437098892, 69.324926548238835,
+	69.354195093655846, 69.383414240660485, 69.412584155717639, 69.441705004452118,
+	69.470776951654386, 69.499800161286103, 69.528774796485706, 69.557701019573869,
+	69.586578992059017, 69.615408874642668, 69.644190827224861, 69.672925008909459,
+	69.701611578009391, 69.730250692051925, 69.758842507783854, 69.787387181176626,
+	69.815884867431464, 69.844335720984432, 69.87273989551143, 69.90109754393319,
+	69.929408818420271, 69.957673870397826, 69.985892850550599, 70.014065908827675,
+	70.042193194447265, 70.070274855901459, 70.098311040960937, 70.126301896679621,
+	70.154247569399288, 70.182148204754213, 70.210003947675673, 70.237814942396469,
+	70.265581332455426, 70.293303260701833, 70.320980869299859, 70.348614299732915,
+	70.376203692807962, 70.403749188659916, 70.431250926755794, 70.458709045899028,
+	70.486123684233675, 70.513494979248534, 70.540823067781332, 70.568108086022789,
+	70.595350169520714, 70.62254945318405, 70.649706071286872, 70.676820157472378,
+	70.703891844756797, 70.73092126553334, 70.75790855157608, 70.784853834043815,
+	70.811757243483854, 70.838618909835844, 70.865438962435547, 70.892217530018527,
+	70.918954740723933, 70.945650722098108, 70.972305601098242, 70.998919504096065,
+	71.025492556881375, 71.052024884665613, 71.078516612085437, 71.104967863206198,
+	71.131378761525454, 71.157749429976391, 71.184079990931338, 71.210370566205071,
+	71.236621277058234, 71.262832244200737, 71.289003587795051, 71.315135427459495,
+	71.341227882271539, 71.367281070771071, 71.393295110963592, 71.419270120323461,
+	71.445206215797072, 71.471103513805971, 71.496962130250054, 71.522782180510646,
+	71.548563779453573, 71.574307041432249, 71.600012080290739, 71.625679009366763,
+	71.65130794149465, 71.676898989008407, 71.702452263744576, 71.727967877045231,
+	71.753445939760866, 71.778886562253305, 71.804289854398519, 71.829655925589535,
+	71.854984884739224, 71.880276840283116, 71.905531900182197, 71.930750171925652,
+	71.955931762533623, 71.981076778559938, 72.006185326094823, 72.031257510767546,
+	72.056293437749133, 72.08129321175501, 72.106256937047576, 72.131184717438884,
+	72.15607665629318, 72.180932856529523, 72.205753420624262, 72.230538450613679,
+	72.255288048096389, 72.280002314235929, 72.304681349763172, 72.329325254978869,
+	72.353934129756013, 72.378508073542321, 72.40304718536261, 72.427551563821225,
+	72.452021307104417, 72.476456512982637, 72.500857278812973, 72.525223701541421,
+	72.549555877705217, 72.573853903435108, 72.598117874457643, 72.622347886097458,
+	72.646544033279525, 72.670706410531295, 72.694835111985057, 72.718930231380014,
+	72.742991862064542, 72.767020096998309, 72.791015028754501, 72.814976749521861,
+	72.838905351106902, 72.86280092493601, 72.88666356205745, 72.910493353143579,
+	72.934290388492798, 72.958054758031693, 72.981786551317001, 73.005485857537693,
+	73.029152765516955, 73.052787363714188, 73.076389740227, 73.099959982793166,
+	73.123498178792602, 73.147004415249285, 73.1704787788332, 73.193921355862258,
+	73.217332232304187, 73.240711493778448, 73.264059225558086, 73.2873755125716,
+	73.310660439404813, 73.333914090302727, 73.357136549171301, 73.380327899579285,
+	73.403488224760082, 73.426617607613451, 73.449716130707358, 73.472783876279706,
+	73.495820926240086, 73.518827362171578, 73.541803265332419, 73.564748716657732,
+	73.587663796761319, 73.610548585937224, 73.633403164161535, 73.656227611094039,
+	73.679022006079819, 73.701786428150996, 73.7245209560283, 73.747225668122809,
+	73.769900642537436, 73.792545957068612, 73.815161689207926, 73.837747916143641,
+	73.860304714762322, 73.882832161650356, 73.905330333095606, 73.927799305088854,
+	73.950239153325413, 73.972649953206613, 73.995031779841369, 74.017384708047643,
+	74.039708812353979, 74.062004167000964, 74.084270845942754, 74.106508922848477,
+	74.128718471103767, 74.150899563812189, 74.173052273796671, 74.195176673600926,
+	74.217272835490945, 74.239340831456317, 74.261380733211723, 74.283392612198284,
+	74.305376539584955, 74.327332586269947, 74.34926082288203, 74.371161319781947,
+	74.393034147063759, 74.414879374556179, 74.436697071823943, 74.458487308169055,
+	74.480250152632237, 74.501985673994099, 74.523693940776596, 74.545375021244169,
+	74.567028983405137, 74.588655895012963, 74.610255823567485, 74.631828836316217,
+	74.653375000255579, 74.674894382132194, 74.696387048444052, 74.717853065441801,
+	74.739292499129974, 74.760705415268177, 74.782091879372288, 74.803451956715719,
+	74.824785712330552, 74.846093211008778, 74.867374517303404, 74.888629695529715,
+	74.909858809766391, 74.931061923856646, 74.952239101409432, 74.973390405800544,
+	74.994515900173795, 75.015615647442104, 75.036689710288641, 75.057738151167953,
+	75.078761032307071, 75.099758415706589, 75.120730363141789, 75.141676936163734,
+	75.162598196100348, 75.183494204057453, 75.204365020919894, 75.225210707352574,
+	75.246031323801546, 75.266826930495014, 75.287597587444409, 75.308343354445412,
+	75.329064291079035, 75.349760456712573, 75.370431910500656, 75.391078711386328,
+	75.411700918101914, 75.432298589170173, 75.452871782905191, 75.473420557413434,
+	75.493944970594669, 75.514445080143005, 75.534920943547846, 75.555372618094822,
+	75.575800160866834, 75.596203628744902, 75.616583078409207, 75.636938566339992,
+	75.657270148818498, 75.677577881927931, 75.697861821554326, 75.718122023387565,
+	75.738358542922214, 75.758571435458435, 75.778760756102997, 75.79892655977001,
+	75.819068901181964, 75.839187834870572, 75.859283415177629, 75.879355696255899,
+	75.899404732070067, 75.919430576397488, 75.939433282829143, 75.95941290477046,
+	75.979369495442199, 75.999303107881246, 76.019213794941535, 76.039101609294818,
+	76.058966603431557, 76.078808829661725, 76.098628340115624, 76.11842518674473,
+	76.138199421322525, 76.157951095445242, 76.177680260532739, 76.197386967829289,
+	76.217071268404354, 76.2367332131534, 76.256372852798691, 76.275990237890042,
+	76.295585418805615, 76.315158445752758, 76.334709368768657, 76.354238237721205,
+	76.373745102309712, 76.393230012065686, 76.412693016353558, 76.432134164371504,
+	76.451553505152106, 76.470951087563122, 76.490326960308252, 76.509681171927866,
+	76.529013770799693, 76.548324805139572, 76.567614323002203, 76.586882372281806,
+	76.606129000712883, 76.625354255870903, 76.644558185173011, 76.663740835878741,
+	76.682902255090696, 76.702042489755257, 76.721161586663271, 76.740259592450712,
+	76.759336553599425, 76.778392516437734, 76.797427527141153, 76.816441631733056,
+	76.835434876085344, 76.854407305919111, 76.873358966805284, 76.892289904165295,
+	76.911200163271772, 76.930089789249095, 76.948958827074136, 76.967807321576856,
+	76.986635317440943, 77.005442859204464, 77.024229991260498, 77.042996757857736,
+	77.06174320310113, 77.080469370952542, 77.099175305231284, 77.117861049614817,
+	77.1365266476393, 77.15517214270028, 77.173797578053168, 77.192402996813968,
+	77.210988441959813, 77.229553956329553, 77.248099582624391, 77.266625363408437,
+	77.285131341109292, 77.303617558018686, 77.322084056292965, 77.340530877953739,
+	77.358958064888441, 77.377365658850891, 77.395753701461842, 77.4141222342096,
+	77.432471298450537, 77.45080093540966, 77.469111186181181, 77.487402091729066,
+	77.505673692887555, 77.523926030361764, 77.54215914472816, 77.560373076435212,
+	77.578567865803763, 77.59674355302775, 77.61490017817458, 77.633037781185777,
+	77.651156401877429, 77.669256079940752, 77.6873368549426, 77.705398766326013,
+	77.723441853410662, 77.741466155393454, 77.759471711348951, 77.77745856022996,
+	77.795426740867981, 77.813376291973753, 77.831307252137719, 77.849219659830538,
+	77.867113553403584, 77.884988971089413, 77.90284595100232, 77.920684531138747,
+	77.938504749377813, 77.956306643481781, 77.974090251096555, 77.991855609752122,
+	78.009602756863075, 78.02733172972907, 78.045042565535255, 78.062735301352788,
+	78.080409974139286, 78.098066620739303, 78.115705277884757, 78.133325982195416,
+	78.15092877017932, 78.16851367823331, 78.186080742643384, 78.203629999585218,
+	78.221161485124583, 78.238675235217769, 78.256171285712099, 78.273649672346295,
+	78.291110430750948, 78.308553596448931, 78.325979204855884, 78.343387291280578,
+	78.360777890925419, 78.378151038886799, 78.395506770155578, 78.412845119617458,
+	78.430166122053492, 78.447469812140369, 78.464756224450952, 78.48202539345462,
+	78.499277353517712, 78.516512138903934, 78.533729783774774, 78.550930322189856,
+	78.568113788107439, 78.585280215384728, 78.602429637778329, 78.619562088944619,
+	78.636677602440159, 78.653776211722104, 78.67085795014853, 78.687922850978907,
+	78.704970947374434, 78.722002272398441, 78.739016859016786, 78.756014740098209,
+	78.772995948414746, 78.789960516642054, 78.806908477359897, 78.823839863052385,
+},
+{
+	-HUGE_VAL, -29.159245293891559, -17.159245293891559, -10.139695285237678,
+	-5.1592452938915585, -1.2961081552432177, 1.8603047147623215, 4.5290137707996934,
+	6.8407547061084415, 8.8798547234161944, 10.703891844756789, 12.353934129756013,
+	13.860304714762322, 15.246031323801546, 16.529013770799693, 17.723441853410662,
+	18.840754706108441, 19.890308801112518, 20.879854723416194, 21.815884867431471,
+	22.703891844756797, 23.548563779453566, 24.353934129756013, 25.123498178792602,
+	25.860304714762322, 26.567028983405137, 27.246031323801546, 27.899404732070067,
+	28.529013770799693, 29.136526647639307, 29.723441853410669, 30.291110430750948,
+	30.840754706108441, 31.373484138409886, 31.890308801112518, 32.392150909448041,
+	32.879854723416187, 33.354195093655839, 33.815884867431471, 34.265581332455426,
+	34.703891844756797, 35.131378761525447, 35.548563779453566, 35.955931762533616,
+	36.353934129756013, 36.742991862064542, 37.123498178792602, 37.495820926240093,
+	37.860304714762322, 38.217272835490945, 38.567028983405137, 38.909858809766391,
+	39.246031323801546, 39.575800160866834, 39.899404732070067, 40.217071268404354,
+	40.529013770799693, 40.835434876085344, 41.136526647639307, 41.432471298450537,
+	41.723441853410669, 42.009602756863075, 42.291110430750948, 42.568113788107439,
+	42.840754706108441, 43.109168462449894, 43.373484138409886, 43.633824991601713,
+	43.890308801112518, 44.143048187446475, 44.392150909448041, 44.637720140164632,
+	44.879854723416187, 45.118649412668645, 45.354195093655839, 45.586578992059017,
+	45.815884867431471, 46.042193194447258, 46.265581332455426, 46.486123684233682,
+	46.703891844756797, 46.91895474072394, 47.131378761525447, 47.341227882271539,
+	47.548563779453573, 47.753445939760866, 47.955931762533616, 48.15607665629318,
+	48.353934129756013, 48.549555877705217, 48.742991862064542, 48.934290388492798,
+	49.123498178792602, 49.31066043940482, 49.495820926240093, 49.679022006079819,
+	49.860304714762322, 50.039708812353979, 50.217272835490945, 50.393034147063759,
+	50.567028983405137, 50.739292499129981, 50.909858809766391, 51.078761032307064,
+	51.246031323801553, 51.411700918101914, 51.575800160866834, 51.738358542922207,
+	51.899404732070067, 52.058966603431557, 52.217071268404361, 52.373745102309712,
+	52.529013770799693, 52.682902255090696, 52.835434876085344, 52.986635317440943,
+	53.136526647639307, 53.285131341109299, 53.432471298450537, 53.57856786580377,
+	53.723441853410662, 53.867113553403577, 54.009602756863075, 54.15092877017932,
+	54.291110430750948, 54.430166122053485, 54.568113788107439, 54.704970947374434,
+	54.840754706108441, 54.975481771187489, 55.109168462449901, 55.241830724557843,
+	55.373484138409886, 55.504143932122716, 55.633824991601713, 55.762541870718415,
+	55.890308801112511, 56.017139701634761, 56.143048187446475, 56.268047578790537,
+	56.392150909448041, 56.515370934893966, 56.637720140164632, 56.759210747449117,
+	56.879854723416187, 56.999663786287655, 57.118649412668645, 57.236822844144811,
+	57.354195093655839, 57.470776951654386, 57.586578992059017, 57.701611578009391,
+	57.815884867431471, 57.929408818420271, 58.042193194447258, 58.154247569399296,
+	58.265581332455426, 58.37620369280797, 58.486123684233675, 58.595350169520714,
+	58.703891844756797, 58.811757243483846, 58.91895474072394, 59.025492556881375,
+	59.131378761525447, 59.236621277058234, 59.341227882271539, 59.445206215797072,
+	59.548563779453573, 59.65130794149465, 59.753445939760866, 59.854984884739217,
+	59.955931762533616, 60.05629343774914, 60.15607665629318, 60.255288048096389,
+	60.353934129756013, 60.45202130710441, 60.549555877705217, 60.646544033279518,
+	60.742991862064542, 60.838905351106909, 60.934290388492798, 61.029152765516955,
+	61.123498178792602, 61.217332232304187, 61.31066043940482, 61.403488224760082,
+	61.495820926240093, 61.587663796761319, 61.679022006079819, 61.769900642537429,
+	61.860304714762322, 61.950239153325406, 62.039708812353972, 62.128718471103774,
+	62.217272835490945, 62.305376539584955, 62.393034147063759, 62.48025015263223,
+	62.567028983405137, 62.653375000255586, 62.739292499129981, 62.824785712330559,
+	62.909858809766391, 62.994515900173795, 63.078761032307064, 63.162598196100348,
+	63.246031323801553, 63.329064291079035, 63.411700918101914, 63.493944970594669,
+	63.575800160866834, 63.657270148818505, 63.738358542922207, 63.819068901181964,
+	63.899404732070067, 63.979369495442192, 64.058966603431557, 64.138199421322525,
+	64.217071268404354, 64.295585418805615, 64.373745102309712, 64.451553505152106,
+	64.529013770799693, 64.606129000712883, 64.682902255090696, 64.759336553599425,
+	64.835434876085344, 64.911200163271772, 64.986635317440943, 65.06174320310113,
+	65.136526647639315, 65.210988441959813, 65.285131341109292, 65.358958064888441,
+	65.432471298450537, 65.505673692887555, 65.578567865803763, 65.651156401877429,
+	65.723441853410662, 65.795426740867981, 65.867113553403584, 65.938504749377813,
+	66.009602756863075, 66.080409974139286, 66.15092877017932, 66.221161485124583,
+	66.291110430750948, 66.360777890925419, 66.430166122053492, 66.499277353517712,
+	66.568113788107439, 66.636677602440159, 66.704970947374434, 66.772995948414746,
+	66.840754706108441, 66.908249296434974, 66.975481771187489, 67.042454158347084,
+	67.109168462449901, 67.17562666494706, 67.241830724557843, 67.307782577616067,
+	67.373484138409879, 67.438937299515175, 67.504143932122716, 67.569105886359097,
+	67.633824991601713, 67.698303056787935, 67.762541870718422, 67.826543202354898,
+	67.890308801112511, 67.953840397146678, 68.017139701634761, 68.080208407052709,
+	68.143048187446468, 68.205660698698708, 68.268047578790529, 68.330210448058693,
+	68.392150909448034, 68.453870548759554, 68.515370934893966, 68.576653620091037,
+	68.637720140164632, 68.698572014733699, 68.759210747449117, 68.819637826216692,
+	68.879854723416187, 68.939862896116594, 68.999663786287655, 69.059258821007845,
+	69.118649412668645, 69.177836959175423, 69.236822844144811, 69.295608437098892,
+	69.354195093655846, 69.412584155717639, 69.470776951654386, 69.528774796485706,
+	69.586578992059017, 69.644190827224861, 69.701611578009391, 69.758842507783854,
+	69.815884867431464, 69.87273989551143, 69.929408818420271, 69.985892850550599,
+	70.042193194447265, 70.098311040960937, 70.154247569399288, 70.210003947675673,
+	70.265581332455426, 70.320980869299859, 70.376203692807962, 70.431250926755794,
+	70.486123684233675, 70.540823067781332, 70.595350169520714, 70.649706071286872,
+	70.703891844756797, 70.75790855157608, 70.811757243483854, 70.865438962435547,
+	70.918954740723933, 70.972305601098242, 71.025492556881375, 71.078516612085437,
+	71.131378761525454, 71.184079990931338, 71.236621277058234, 71.289003587795051,
+	71.341227882271539, 71.393295110963592, 71.445206215797072, 71.496962130250054,
+	71.548563779453573, 71.600012080290739, 71.65130794149465, 71.702452263744576,
+	71.753445939760866, 71.804289854398519, 71.854984884739224, 71.905531900182197,
+	71.955931762533623, 72.006185326094823, 72.056293437749133, 72.106256937047576,
+	72.15607665629318, 72.205753420624262, 72.255288048096389, 72.304681349763172,
+	72.353934129756013, 72.40304718536261, 72.452021307104417, 72.500857278812973,
+	72.549555877705217, 72.598117874457643, 72.646544033279525, 72.694835111985057,
+	72.742991862064542, 72.791015028754501, 72.838905351106902, 72.88666356205745,
+	72.934290388492798, 72.981786551317001, 73.029152765516955, 73.076389740227,
+	73.123498178792602, 73.1704787788332, 73.217332232304187, 73.264059225558086,
+	73.310660439404813, 73.357136549171301, 73.403488224760082, 73.449716130707358,
+	73.495820926240086, 73.541803265332419, 73.587663796761319, 73.633403164161535,
+	73.679022006079819, 73.7245209560283, 73.769900642537436, 73.815161689207926,
+	73.860304714762322, 73.905330333095606, 73.950239153325413, 73.995031779841369,
+	74.039708812353979, 74.084270845942754, 74.128718471103767, 74.173052273796671,
+	74.217272835490945, 74.261380733211723, 74.305376539584955, 74.34926082288203,
+	74.393034147063759, 74.436697071823943, 74.480250152632237, 74.523693940776596,
+	74.567028983405137, 74.610255823567485, 74.653375000255579, 74.696387048444052,
+	74.739292499129974, 74.782091879372288, 74.824785712330552, 74.867374517303404,
+	74.909858809766391, 74.952239101409432, 74.994515900173795, 75.036689710288641,
+	75.078761032307071, 75.120730363141789, 75.162598196100348, 75.204365020919894,
+	75.246031323801546, 75.287597587444409, 75.329064291079035, 75.370431910500656,
+	75.411700918101914, 75.452871782905191, 75.493944970594669, 75.534920943547846,
+	75.575800160866834, 75.616583078409207, 75.657270148818498, 75.697861821554326,
+	75.738358542922214, 75.778760756102997, 75.819068901181964, 75.859283415177629,
+	75.899404732070067, 75.939433282829143, 75.979369495442199, 76.019213794941535,
+	76.058966603431557, 76.098628340115624, 76.138199421322525, 76.177680260532739,
+	76.217071268404354, 76.256372852798691, 76.295585418805615, 76.334709368768657,
+	76.373745102309712, 76.412693016353558, 76.451553505152106, 76.490326960308252,
+	76.529013770799693, 76.567614323002203, 76.606129000712883, 76.644558185173011,
+	76.682902255090696, 76.721161586663271, 76.759336553599425, 76.797427527141153,
+	76.835434876085344, 76.873358966805284, 76.911200163271772, 76.948958827074136,
+	76.986635317440943, 77.024229991260498, 77.06174320310113, 77.099175305231284,
+	77.1365266476393, 77.173797578053168, 77.210988441959813, 77.248099582624391,
+	77.285131341109292, 77.322084056292965, 77.358958064888441, 77.395753701461842,
+	77.432471298450537, 77.469111186181181, 77.505673692887555, 77.54215914472816,
+	77.578567865803763, 77.61490017817458, 77.651156401877429, 77.6873368549426,
+	77.723441853410662, 77.759471711348951, 77.795426740867981, 77.831307252137719,
+	77.867113553403584, 77.90284595100232, 77.938504749377813, 77.974090251096555,
+	78.009602756863075, 78.045042565535255, 78.080409974139286, 78.115705277884757,
+	78.15092877017932, 78.186080742643384, 78.221161485124583, 78.256171285712099,
+	78.291110430750948, 78.325979204855884, 78.360777890925419, 78.395506770155578,
+	78.430166122053492, 78.464756224450952, 78.499277353517712, 78.533729783774774,
+	78.568113788107439, 78.602429637778329, 78.636677602440159, 78.67085795014853,
+	78.704970947374434, 78.739016859016786, 78.772995948414746, 78.806908477359897,
+	78.840754706108441, 78.87453489339309, 78.908249296434974, 78.941898170955412,
+	78.975481771187489, 79.009000349887657, 79.042454158347084, 79.075843446403013,
+	79.109168462449901, 79.142429453450546, 79.17562666494706, 79.208760341071738,
+	79.241830724557843, 79.274838056750269, 79.307782577616067, 79.340664525755017,
+	79.373484138409879, 79.406241651476748, 79.438937299515175, 79.471571315758283,
+	79.504143932122716, 79.536655379218558, 79.569105886359097, 79.601495681570555,
+	79.633824991601713, 79.666094041933391, 79.698303056787935, 79.730452259138502,
+	79.762541870718422, 79.794572112030224, 79.826543202354898, 79.858455359760782,
+	79.890308801112511, 79.922103742079912, 79.953840397146678, 79.985518979619115,
+	80.017139701634761, 80.048702774170835, 80.080208407052709, 80.111656808962337,
+	80.143048187446468, 80.174382748924927, 80.205660698698708, 80.236882240958067,
+	80.268047578790529, 80.299156914188828, 80.330210448058693, 80.361208380226728,
+	80.392150909448048, 80.423038233413962, 80.453870548759554, 80.484648051071204,
+	80.515370934893966, 80.546039393739051, 80.576653620091037, 80.607213805415185,
+	80.637720140164632, 80.668172813787422, 80.698572014733685, 80.728917930462558,
+	80.759210747449117, 80.789450651191302, 80.819637826216692, 80.849772456089298,
+	80.879854723416187, 80.909884809854233, 80.939862896116594, 80.969789161979278,
+	80.999663786287655, 81.029486946962791, 81.059258821007845, 81.088979584514405,
+	81.118649412668645, 81.148268479757647, 81.177836959175423, 81.207355023429074,
+	81.236822844144811, 81.26624059207397, 81.295608437098892, 81.324926548238835,
+	81.354195093655846, 81.383414240660485, 81.412584155717639, 81.441705004452118,
+	81.470776951654386, 81.499800161286103, 81.528774796485706, 81.557701019573869,
+	81.586578992059017, 81.615408874642668, 81.644190827224861, 81.672925008909459,
+	81.701611578009391, 81.730250692051925, 81.758842507783854, 81.787387181176626,
+	81.815884867431464, 81.844335720984432, 81.87273989551143, 81.90109754393319,
+	81.929408818420271, 81.957673870397826, 81.985892850550599, 82.014065908827675,
+	82.042193194447265, 82.070274855901459, 82.098311040960937, 82.126301896679621,
+	82.154247569399288, 82.182148204754213, 82.210003947675673, 82.237814942396469,
+	82.265581332455426, 82.293303260701833, 82.320980869299859, 82.348614299732915,
+	82.376203692807962, 82.403749188659916, 82.43125092675578, 82.458709045899042,
+	82.486123684233675, 82.513494979248534, 82.540823067781332, 82.568108086022789,
+	82.595350169520714, 82.62254945318405, 82.649706071286872, 82.676820157472378,
+	82.703891844756797, 82.73092126553334, 82.75790855157608, 82.784853834043815,
+	82.811757243483854, 82.838618909835844, 82.865438962435547, 82.892217530018542,
+	82.918954740723933, 82.945650722098108, 82.972305601098242, 82.998919504096065,
+	83.025492556881375, 83.052024884665613, 83.078516612085437, 83.104967863206198,
+	83.131378761525454, 83.157749429976406, 83.184079990931338, 83.210370566205057,
+	83.236621277058234, 83.262832244200737, 83.289003587795051, 83.315135427459495,
+	83.341227882271539, 83.367281070771071, 83.393295110963592, 83.419270120323461,
+	83.445206215797072, 83.471103513805971, 83.496962130250054, 83.522782180510646,
+	83.548563779453573, 83.574307041432249, 83.600012080290753, 83.625679009366763,
+	83.65130794149465, 83.676898989008407, 83.702452263744576, 83.727967877045216,
+	83.753445939760866, 83.778886562253291, 83.804289854398519, 83.829655925589535,
+	83.854984884739224, 83.880276840283116, 83.905531900182197, 83.930750171925638,
+	83.955931762533623, 83.981076778559938, 84.006185326094823, 84.031257510767546,
+	84.056293437749133, 84.08129321175501, 84.106256937047576, 84.131184717438884,
+	84.15607665629318, 84.180932856529523, 84.205753420624262, 84.230538450613679,
+	84.255288048096389, 84.280002314235929, 84.304681349763172, 84.329325254978869,
+	84.353934129756013, 84.378508073542321, 84.40304718536261, 84.427551563821225,
+	84.452021307104417, 84.476456512982637, 84.500857278812973, 84.525223701541421,
+	84.549555877705217, 84.573853903435094, 84.598117874457643, 84.622347886097458,
+	84.646544033279525, 84.670706410531295, 84.694835111985057, 84.718930231380014,
+	84.742991862064542, 84.767020096998309, 84.791015028754501, 84.814976749521861,
+	84.838905351106916, 84.86280092493601, 84.88666356205745, 84.910493353143579,
+	84.934290388492798, 84.958054758031693, 84.981786551317001, 85.005485857537693,
+	85.029152765516955, 85.052787363714188, 85.076389740227, 85.099959982793166,
+	85.123498178792602, 85.147004415249285, 85.1704787788332, 85.193921355862258,
+	85.217332232304187, 85.240711493778448, 85.264059225558086, 85.2873755125716,
+	85.310660439404813, 85.333914090302727, 85.357136549171301, 85.380327899579285,
+	85.403488224760082, 85.426617607613451, 85.449716130707358, 85.472783876279706,
+	85.4958209262401, 85.518827362171578, 85.541803265332419, 85.564748716657732,
+	85.587663796761319, 85.610548585937224, 85.633403164161535, 85.656227611094039,
+	85.679022006079819, 85.701786428150996, 85.7245209560283, 85.747225668122809,
+	85.769900642537436, 85.792545957068612, 85.815161689207926, 85.837747916143641,
+	85.860304714762322, 85.882832161650356, 85.905330333095606, 85.927799305088854,
+	85.950239153325413, 85.972649953206613, 85.995031779841369, 86.017384708047643,
+	86.039708812353979, 86.062004167000964, 86.08427084594274, 86.106508922848477,
+	86.128718471103767, 86.150899563812203, 86.173052273796671, 86.19517667360094,
+	86.217272835490945, 86.239340831456317, 86.261380733211723, 86.283392612198284,
+	86.305376539584955, 86.327332586269947, 86.34926082288203, 86.371161319781947,
+	86.393034147063759, 86.414879374556193, 86.436697071823943, 86.458487308169055,
+	86.480250152632237, 86.501985673994113, 86.523693940776596, 86.545375021244155,
+	86.567028983405137, 86.588655895012963, 86.610255823567485, 86.631828836316217,
+	86.653375000255579, 86.674894382132194, 86.696387048444052, 86.717853065441801,
+	86.739292499129988, 86.760705415268177, 86.782091879372288, 86.803451956715719,
+	86.824785712330566, 86.846093211008778, 86.867374517303404, 86.888629695529715,
+	86.909858809766391, 86.931061923856646, 86.952239101409432, 86.973390405800544,
+	86.994515900173795, 87.015615647442104, 87.036689710288641, 87.057738151167953,
+	87.078761032307057, 87.099758415706589, 87.120730363141789, 87.141676936163748,
+	87.162598196100348, 87.183494204057439, 87.20436502091988, 87.225210707352574,
+	87.24603132380156, 87.266826930495014, 87.287597587444409, 87.308343354445412,
+	87.329064291079035, 87.349760456712573, 87.370431910500656, 87.391078711386314,
+	87.411700918101914, 87.432298589170173, 87.452871782905191, 87.473420557413434,
+	87.493944970594669, 87.514445080143005, 87.534920943547831, 87.555372618094822,
+	87.575800160866834, 87.596203628744902, 87.616583078409207, 87.636938566339992,
+	87.657270148818498, 87.677577881927931, 87.697861821554326, 87.718122023387565,
+	87.738358542922214, 87.758571435458435, 87.778760756102997, 87.79892655977001,
+	87.819068901181964, 87.839187834870572, 87.859283415177629, 87.879355696255899,
+	87.899404732070067, 87.919430576397488, 87.939433282829143, 87.95941290477046,
+	87.979369495442199, 87.999303107881246, 88.019213794941535, 88.039101609294818,
+	88.058966603431557, 88.078808829661725, 88.098628340115624, 88.11842518674473,
+	88.138199421322525, 88.157951095445242, 88.177680260532739, 88.197386967829289,
+	88.217071268404368, 88.2367332131534, 88.256372852798691, 88.275990237890042,
+	88.295585418805615, 88.315158445752758, 88.334709368768671, 88.354238237721205,
+	88.373745102309712, 88.393230012065686, 88.412693016353558, 88.432134164371504,
+	88.451553505152106, 88.470951087563122, 88.490326960308252, 88.509681171927866,
+	88.529013770799693, 88.548324805139572, 88.567614323002203, 88.586882372281821,
+	88.606129000712883, 88.625354255870917, 88.644558185173025, 88.663740835878741,
+	88.682902255090696, 88.702042489755257, 88.721161586663271, 88.740259592450712,
+	88.759336553599425, 88.778392516437719, 88.797427527141153, 88.816441631733056,
+	88.835434876085344, 88.854407305919111, 88.873358966805284, 88.892289904165295,
+	88.911200163271772, 88.930089789249095, 88.948958827074136, 88.967807321576856,
+	88.986635317440943, 89.005442859204464, 89.024229991260498, 89.042996757857736,
+	89.06174320310113, 89.080469370952528, 89.099175305231284, 89.117861049614817,
+	89.1365266476393, 89.15517214270028, 89.173797578053168, 89.192402996813968,
+	89.210988441959813, 89.229553956329553, 89.248099582624391, 89.266625363408423,
+	89.285131341109292, 89.303617558018686, 89.322084056292965, 89.340530877953739,
+	89.358958064888441, 89.377365658850891, 89.395753701461842, 89.4141222342096,
+	89.432471298450537, 89.45080093540966, 89.469111186181181, 89.487402091729066,
+	89.505673692887555, 89.523926030361764, 89.542159144728174, 89.560373076435212,
+	89.578567865803763, 89.59674355302775, 89.61490017817458, 89.633037781185777,
+	89.651156401877429, 89.669256079940752, 89.6873368549426, 89.705398766326013,
+	89.723441853410662, 89.741466155393454, 89.759471711348951, 89.77745856022996,
+	89.795426740867981, 89.813376291973753, 89.831307252137719, 89.849219659830538,
+	89.867113553403584, 89.884988971089413, 89.90284595100232, 89.920684531138761,
+	89.938504749377813, 89.956306643481781, 89.974090251096555, 89.991855609752122,
+	90.009602756863075, 90.02733172972907, 90.045042565535255, 90.062735301352788,
+	90.080409974139286, 90.098066620739303, 90.115705277884757, 90.133325982195402,
+	90.15092877017932, 90.16851367823331, 90.186080742643384, 90.203629999585218,
+	90.221161485124583, 90.238675235217784, 90.256171285712099, 90.273649672346295,
+	90.291110430750948, 90.308553596448931, 90.325979204855884, 90.343387291280578,
+	90.360777890925419, 90.378151038886799, 90.395506770155578, 90.412845119617458,
+	90.430166122053492, 90.447469812140369, 90.464756224450952, 90.48202539345462,
+	90.499277353517698, 90.516512138903934, 90.53372978377476, 90.550930322189856,
+	90.568113788107439, 90.585280215384728, 90.602429637778329, 90.619562088944619,
+	90.636677602440159, 90.653776211722104, 90.67085795014853, 90.687922850978907,
+	90.704970947374434, 90.722002272398441, 90.739016859016786, 90.756014740098209,
+	90.772995948414746, 90.789960516642054, 90.806908477359897, 90.823839863052385,
+},
+{
+	-HUGE_VAL, -17.159245293891559, -5.1592452938915585, 1.8603047147623215,
+	6.8407547061084415, 10.703891844756789, 13.860304714762322, 16.529013770799693,
+	18.840754706108441, 20.879854723416194, 22.703891844756797, 24.353934129756013,
+	25.860304714762322, 27.246031323801546, 28.529013770799693, 29.723441853410669,
+	30.840754706108441, 31.890308801112518, 32.879854723416187, 33.815884867431471,
+	34.703891844756797, 35.548563779453566, 36.353934129756013, 37.123498178792602,
+	37.860304714762322, 38.567028983405137, 39.246031323801546, 39.899404732070067,
+	40.529013770799693, 41.136526647639307, 41.723441853410669, 42.291110430750948,
+	42.840754706108441, 43.373484138409886, 43.890308801112518, 44.392150909448041,
+	44.879854723416187, 45.354195093655839, 45.815884867431471, 46.265581332455426,
+	46.703891844756797, 47.131378761525447, 47.548563779453573, 47.955931762533616,
+	48.353934129756013, 48.742991862064542, 49.123498178792602, 49.495820926240093,
+	49.860304714762322, 50.217272835490945, 50.567028983405137, 50.909858809766391,
+	51.246031323801553, 51.575800160866834, 51.899404732070067, 52.217071268404361,
+	52.529013770799693, 52.835434876085344, 53.136526647639307, 53.432471298450537,
+	53.723441853410662, 54.009602756863075, 54.291110430750948, 54.568113788107439,
+	54.840754706108441, 55.109168462449901, 55.373484138409886, 55.633824991601713,
+	55.890308801112511, 56.143048187446475, 56.392150909448041, 56.637720140164632,
+	56.879854723416187, 57.118649412668645, 57.354195093655839, 57.586578992059017,
+	57.815884867431471, 58.042193194447258, 58.265581332455426, 58.486123684233675,
+	58.703891844756797, 58.91895474072394, 59.131378761525447, 59.341227882271539,
+	59.548563779453573, 59.753445939760866, 59.955931762533616, 60.15607665629318,
+	60.353934129756013, 60.549555877705217, 60.742991862064542, 60.934290388492798,
+	61.123498178792602, 61.31066043940482, 61.495820926240093, 61.679022006079819,
+	61.860304714762322, 62.039708812353972, 62.217272835490945, 62.393034147063759,
+	62.567028983405137, 62.739292499129981, 62.909858809766391, 63.078761032307064,
+	63.246031323801553, 63.411700918101914, 63.575800160866834, 63.738358542922207,
+	63.899404732070067, 64.058966603431557, 64.217071268404354, 64.373745102309712,
+	64.529013770799693, 64.682902255090696, 64.835434876085344, 64.986635317440943,
+	65.136526647639315, 65.285131341109292, 65.432471298450537, 65.578567865803763,
+	65.723441853410662, 65.867113553403584, 66.009602756863075, 66.15092877017932,
+	66.291110430750948, 66.430166122053492, 66.568113788107439, 66.704970947374434,
+	66.840754706108441, 66.975481771187489, 67.109168462449901, 67.241830724557843,
+	67.373484138409879, 67.504143932122716, 67.633824991601713, 67.762541870718422,
+	67.890308801112511, 68.017139701634761, 68.143048187446468, 68.268047578790529,
+	68.392150909448034, 68.515370934893966, 68.637720140164632, 68.759210747449117,
+	68.879854723416187, 68.999663786287655, 69.118649412668645, 69.236822844144811,
+	69.354195093655846, 69.470776951654386, 69.586578992059017, 69.701611578009391,
+	69.815884867431464, 69.929408818420271, 70.042193194447265, 70.154247569399288,
+	70.265581332455426, 70.376203692807962, 70.486123684233675, 70.595350169520714,
+	70.703891844756797, 70.811757243483854, 70.918954740723933, 71.025492556881375,
+	71.131378761525454, 71.236621277058234, 71.341227882271539, 71.445206215797072,
+	71.548563779453573, 71.65130794149465, 71.753445939760866, 71.854984884739224,
+	71.955931762533623, 72.056293437749133, 72.15607665629318, 72.255288048096389,
+	72.353934129756013, 72.452021307104417, 72.549555877705217, 72.646544033279525,
+	72.742991862064542, 72.838905351106902, 72.934290388492798, 73.029152765516955,
+	73.123498178792602, 73.217332232304187, 73.310660439404813, 73.403488224760082,
+	73.495820926240086, 73.587663796761319, 73.679022006079819, 73.769900642537436,
+	73.860304714762322, 73.950239153325413, 74.039708812353979, 74.128718471103767,
+	74.217272835490945, 74.305376539584955, 74.393034147063759, 74.480250152632237,
+	74.567028983405137, 74.653375000255579, 74.739292499129974, 74.824785712330552,
+	74.909858809766391, 74.994515900173795, 75.078761032307071, 75.162598196100348,
+	75.246031323801546, 75.329064291079035, 75.411700918101914, 75.493944970594669,
+	75.575800160866834, 75.657270148818498, 75.738358542922214, 75.819068901181964,
+	75.899404732070067, 75.979369495442199, 76.058966603431557, 76.138199421322525,
+	76.217071268404354, 76.295585418805615, 76.373745102309712, 76.451553505152106,
+	76.529013770799693, 76.606129000712883, 76.682902255090696, 76.759336553599425,
+	76.835434876085344, 76.911200163271772, 76.986635317440943, 77.06174320310113,
+	77.1365266476393, 77.210988441959813, 77.285131341109292, 77.358958064888441,
+	77.432471298450537, 77.505673692887555, 77.578567865803763, 77.651156401877429,
+	77.723441853410662, 77.795426740867981, 77.867113553403584, 77.938504749377813,
+	78.009602756863075, 78.080409974139286, 78.15092877017932, 78.221161485124583,
+	78.291110430750948, 78.360777890925419, 78.430166122053492, 78.499277353517712,
+	78.568113788107439, 78.636677602440159, 78.704970947374434, 78.772995948414746,
+	78.840754706108441, 78.908249296434974, 78.975481771187489, 79.042454158347084,
+	79.109168462449901, 79.17562666494706, 79.241830724557843, 79.307782577616067,
+	79.373484138409879, 79.438937299515175, 79.504143932122716, 79.569105886359097,
+	79.633824991601713, 79.698303056787935, 79.762541870718422, 79.826543202354898,
+	79.890308801112511, 79.953840397146678, 80.017139701634761, 80.080208407052709,
+	80.143048187446468, 80.205660698698708, 80.268047578790529, 80.330210448058693,
+	80.392150909448048, 80.453870548759554, 80.515370934893966, 80.576653620091037,
+	80.637720140164632, 80.698572014733685, 80.759210747449117, 80.819637826216692,
+	80.879854723416187, 80.939862896116594, 80.999663786287655, 81.059258821007845,
+	81.118649412668645, 81.177836959175423, 81.236822844144811, 81.295608437098892,
+	81.354195093655846, 81.412584155717639, 81.470776951654386, 81.528774796485706,
+	81.586578992059017, 81.644190827224861, 81.701611578009391, 81.758842507783854,
+	81.815884867431464, 81.87273989551143, 81.929408818420271, 81.985892850550599,
+	82.042193194447265, 82.098311040960937, 82.154247569399288, 82.210003947675673,
+	82.265581332455426, 82.320980869299859, 82.376203692807962, 82.43125092675578,
+	82.486123684233675, 82.540823067781332, 82.595350169520714, 82.649706071286872,
+	82.703891844756797, 82.75790855157608, 82.811757243483854, 82.865438962435547,
+	82.918954740723933, 82.972305601098242, 83.025492556881375, 83.078516612085437,
+	83.131378761525454, 83.184079990931338, 83.236621277058234, 83.289003587795051,
+	83.341227882271539, 83.393295110963592, 83.445206215797072, 83.496962130250054,
+	83.548563779453573, 83.600012080290753, 83.65130794149465, 83.702452263744576,
+	83.753445939760866, 83.804289854398519, 83.854984884739224, 83.905531900182197,
+	83.955931762533623, 84.006185326094823, 84.056293437749133, 84.106256937047576,
+	84.15607665629318, 84.205753420624262, 84.255288048096389, 84.304681349763172,
+	84.353934129756013, 84.40304718536261, 84.452021307104417, 84.500857278812973,
+	84.549555877705217, 84.598117874457643, 84.646544033279525, 84.694835111985057,
+	84.742991862064542, 84.791015028754501, 84.838905351106916, 84.88666356205745,
+	84.934290388492798, 84.981786551317001, 85.029152765516955, 85.076389740227,
+	85.123498178792602, 85.1704787788332, 85.217332232304187, 85.264059225558086,
+	85.310660439404813, 85.357136549171301, 85.403488224760082, 85.449716130707358,
+	85.4958209262401, 85.541803265332419, 85.587663796761319, 85.633403164161535,
+	85.679022006079819, 85.7245209560283, 85.769900642537436, 85.815161689207926,
+	85.860304714762322, 85.905330333095606, 85.950239153325413, 85.995031779841369,
+	86.039708812353979, 86.08427084594274, 86.128718471103767, 86.173052273796671,
+	86.217272835490945, 86.261380733211723, 86.305376539584955, 86.34926082288203,
+	86.393034147063759, 86.436697071823943, 86.480250152632237, 86.523693940776596,
+	86.567028983405137, 86.610255823567485, 86.653375000255579, 86.696387048444052,
+	86.739292499129988, 86.782091879372288, 86.824785712330566, 86.867374517303404,
+	86.909858809766391, 86.952239101409432, 86.994515900173795, 87.036689710288641,
+	87.078761032307057, 87.120730363141789, 87.162598196100348, 87.20436502091988,
+	87.24603132380156, 87.287597587444409, 87.329064291079035, 87.370431910500656,
+	87.411700918101914, 87.452871782905191, 87.493944970594669, 87.534920943547831,
+	87.575800160866834, 87.616583078409207, 87.657270148818498, 87.697861821554326,
+	87.738358542922214, 87.778760756102997, 87.819068901181964, 87.859283415177629,
+	87.899404732070067, 87.939433282829143, 87.979369495442199, 88.019213794941535,
+	88.058966603431557, 88.098628340115624, 88.138199421322525, 88.177680260532739,
+	88.217071268404368, 88.256372852798691, 88.295585418805615, 88.334709368768671,
+	88.373745102309712, 88.412693016353558, 88.451553505152106, 88.490326960308252,
+	88.529013770799693, 88.567614323002203, 88.606129000712883, 88.644558185173025,
+	88.682902255090696, 88.721161586663271, 88.759336553599425, 88.797427527141153,
+	88.835434876085344, 88.873358966805284, 88.911200163271772, 88.948958827074136,
+	88.986635317440943, 89.024229991260498, 89.06174320310113, 89.099175305231284,
+	89.1365266476393, 89.173797578053168, 89.210988441959813, 89.248099582624391,
+	89.285131341109292, 89.322084056292965, 89.358958064888441, 89.395753701461842,
+	89.432471298450537, 89.469111186181181, 89.505673692887555, 89.542159144728174,
+	89.578567865803763, 89.61490017817458, 89.651156401877429, 89.6873368549426,
+	89.723441853410662, 89.759471711348951, 89.795426740867981, 89.831307252137719,
+	89.867113553403584, 89.90284595100232, 89.938504749377813, 89.974090251096555,
+	90.009602756863075, 90.045042565535255, 90.080409974139286, 90.115705277884757,
+	90.15092877017932, 90.186080742643384, 90.221161485124583, 90.256171285712099,
+	90.291110430750948, 90.325979204855884, 90.360777890925419, 90.395506770155578,
+	90.430166122053492, 90.464756224450952, 90.499277353517698, 90.53372978377476,
+	90.568113788107439, 90.602429637778329, 90.636677602440159, 90.67085795014853,
+	90.704970947374434, 90.739016859016786, 90.772995948414746, 90.806908477359897,
+	90.840754706108441, 90.87453489339309, 90.908249296434974, 90.941898170955412,
+	90.975481771187489, 91.009000349887657, 91.042454158347084, 91.075843446403013,
+	91.109168462449901, 91.142429453450546, 91.17562666494706, 91.208760341071738,
+	91.241830724557843, 91.274838056750269, 91.307782577616081, 91.340664525755017,
+	91.373484138409879, 91.406241651476762, 91.438937299515175, 91.471571315758297,
+	91.504143932122716, 91.536655379218558, 91.569105886359097, 91.601495681570555,
+	91.633824991601713, 91.666094041933391, 91.698303056787935, 91.730452259138502,
+	91.762541870718422, 91.794572112030224, 91.826543202354912, 91.858455359760782,
+	91.890308801112511, 91.922103742079912, 91.953840397146678, 91.985518979619115,
+	92.017139701634761, 92.048702774170835, 92.080208407052709, 92.111656808962337,
+	92.143048187446482, 92.174382748924927, 92.205660698698708, 92.236882240958067,
+	92.268047578790544, 92.299156914188828, 92.330210448058693, 92.361208380226728,
+	92.392150909448048, 92.423038233413962, 92.453870548759554, 92.48464805107119,
+	92.515370934893966, 92.546039393739051, 92.576653620091037, 92.607213805415185,
+	92.637720140164632, 92.668172813787422, 92.698572014733685, 92.728917930462558,
+	92.759210747449117, 92.789450651191302, 92.819637826216692, 92.849772456089298,
+	92.879854723416187, 92.909884809854233, 92.939862896116594, 92.969789161979293,
+	92.999663786287655, 93.029486946962791, 93.059258821007859, 93.088979584514405,
+	93.118649412668645, 93.148268479757647, 93.177836959175423, 93.207355023429074,
+	93.236822844144825, 93.266240592073984, 93.295608437098892, 93.324926548238835,
+	93.354195093655846, 93.383414240660485, 93.412584155717639, 93.441705004452118,
+	93.470776951654386, 93.499800161286103, 93.528774796485692, 93.557701019573869,
+	93.586578992059017, 93.615408874642668, 93.644190827224861, 93.672925008909459,
+	93.701611578009391, 93.730250692051925, 93.758842507783854, 93.787387181176626,
+	93.815884867431464, 93.844335720984432, 93.872739895511415, 93.90109754393319,
+	93.929408818420271, 93.957673870397826, 93.985892850550599, 94.014065908827661,
+	94.042193194447265, 94.070274855901459, 94.098311040960937, 94.126301896679621,
+	94.154247569399303, 94.182148204754213, 94.210003947675673, 94.237814942396469,
+	94.265581332455426, 94.293303260701833, 94.320980869299859, 94.348614299732915,
+	94.376203692807962, 94.403749188659916, 94.43125092675578, 94.458709045899028,
+	94.486123684233689, 94.513494979248534, 94.540823067781332, 94.568108086022789,
+	94.595350169520714, 94.62254945318405, 94.649706071286872, 94.676820157472378,
+	94.703891844756797, 94.73092126553334, 94.75790855157608, 94.784853834043815,
+	94.811757243483854, 94.838618909835844, 94.865438962435547, 94.892217530018542,
+	94.918954740723933, 94.945650722098108, 94.972305601098242, 94.998919504096079,
+	95.025492556881375, 95.052024884665613, 95.078516612085437, 95.104967863206198,
+	95.13137876152544, 95.157749429976406, 95.184079990931338, 95.210370566205057,
+	95.236621277058234, 95.262832244200752, 95.289003587795051, 95.315135427459495,
+	95.341227882271539, 95.367281070771071, 95.393295110963592, 95.419270120323461,
+	95.445206215797072, 95.471103513805971, 95.496962130250068, 95.522782180510646,
+	95.548563779453559, 95.574307041432249, 95.600012080290739, 95.625679009366763,
+	95.65130794149465, 95.676898989008407, 95.702452263744561, 95.727967877045231,
+	95.753445939760866, 95.778886562253305, 95.804289854398519, 95.82965592558952,
+	95.854984884739224, 95.880276840283102, 95.905531900182197, 95.930750171925638,
+	95.955931762533623, 95.981076778559938, 96.006185326094823, 96.031257510767546,
+	96.056293437749133, 96.08129321175501, 96.106256937047576, 96.131184717438884,
+	96.15607665629318, 96.180932856529523, 96.205753420624262, 96.230538450613693,
+	96.255288048096389, 96.280002314235929, 96.304681349763172, 96.329325254978869,
+	96.353934129756013, 96.378508073542321, 96.40304718536261, 96.427551563821225,
+	96.452021307104417, 96.476456512982637, 96.500857278812973, 96.525223701541421,
+	96.549555877705217, 96.573853903435108, 96.598117874457643, 96.622347886097458,
+	96.646544033279525, 96.670706410531295, 96.694835111985057, 96.718930231380028,
+	96.742991862064542, 96.767020096998309, 96.791015028754501, 96.814976749521861,
+	96.838905351106902, 96.86280092493601, 96.88666356205745, 96.910493353143579,
+	96.934290388492798, 96.958054758031693, 96.981786551316986, 97.005485857537693,
+	97.029152765516955, 97.052787363714188, 97.076389740227, 97.099959982793166,
+	97.123498178792602, 97.147004415249285, 97.1704787788332, 97.193921355862244,
+	97.217332232304187, 97.240711493778448, 97.264059225558086, 97.2873755125716,
+	97.310660439404813, 97.333914090302727, 97.357136549171301, 97.380327899579285,
+	97.403488224760082, 97.426617607613451, 97.449716130707372, 97.472783876279706,
+	97.4958209262401, 97.518827362171578, 97.541803265332419, 97.564748716657732,
+	97.587663796761319, 97.610548585937224, 97.633403164161535, 97.656227611094039,
+	97.679022006079819, 97.701786428150996, 97.7245209560283, 97.747225668122809,
+	97.769900642537436, 97.792545957068612, 97.815161689207926, 97.837747916143641,
+	97.860304714762322, 97.882832161650356, 97.905330333095606, 97.927799305088854,
+	97.950239153325413, 97.972649953206613, 97.995031779841369, 98.017384708047643,
+	98.039708812353979, 98.062004167000964, 98.08427084594274, 98.106508922848477,
+	98.128718471103781, 98.150899563812189, 98.173052273796671, 98.195176673600926,
+	98.217272835490945, 98.239340831456317, 98.261380733211723, 98.283392612198284,
+	98.305376539584955, 98.327332586269947, 98.34926082288203, 98.371161319781947,
+	98.393034147063759, 98.414879374556193, 98.436697071823943, 98.458487308169055,
+	98.480250152632237, 98.501985673994113, 98.523693940776596, 98.545375021244155,
+	98.567028983405137, 98.588655895012963, 98.610255823567485, 98.631828836316217,
+	98.653375000255579, 98.674894382132194, 98.696387048444052, 98.717853065441801,
+	98.739292499129988, 98.760705415268177, 98.782091879372288, 98.803451956715719,
+	98.824785712330552, 98.846093211008778, 98.867374517303404, 98.888629695529715,
+	98.909858809766391, 98.931061923856646, 98.952239101409432, 98.973390405800558,
+	98.994515900173795, 99.015615647442104, 99.036689710288641, 99.057738151167953,
+	99.078761032307057, 99.099758415706589, 99.120730363141789, 99.141676936163748,
+	99.162598196100348, 99.183494204057439, 99.20436502091988, 99.225210707352574,
+	99.246031323801546, 99.266826930495014, 99.287597587444409, 99.308343354445412,
+	99.329064291079035, 99.349760456712573, 99.370431910500656, 99.391078711386328,
+	99.411700918101914, 99.432298589170173, 99.452871782905191, 99.473420557413434,
+	99.493944970594669, 99.514445080143005, 99.534920943547831, 99.555372618094822,
+	99.575800160866834, 99.596203628744902, 99.616583078409207, 99.636938566339992,
+	99.657270148818498, 99.677577881927931, 99.697861821554326, 99.718122023387565,
+	99.738358542922214, 99.758571435458435, 99.778760756102997, 99.798926559769995,
+	99.819068901181964, 99.839187834870572, 99.859283415177629, 99.879355696255899,
+	99.899404732070067, 99.919430576397488, 99.939433282829143, 99.95941290477046,
+	99.979369495442199, 99.999303107881246, 100.01921379494152, 100.03910160929482,
+	100.05896660343156, 100.07880882966172, 100.09862834011562, 100.11842518674473,
+	100.13819942132253, 100.15795109544524, 100.17768026053274, 100.19738696782929,
+	100.21707126840435, 100.2367332131534, 100.25637285279869, 100.27599023789003,
+	100.29558541880562, 100.31515844575276, 100.33470936876867, 100.3542382377212,
+	100.37374510230973, 100.39323001206569, 100.41269301635356, 100.4321341643715,
+	100.45155350515211, 100.47095108756312, 100.49032696030825, 100.50968117192787,
+	100.52901377079969, 100.54832480513957, 100.5676143230022, 100.58688237228181,
+	100.60612900071288, 100.62535425587092, 100.64455818517303, 100.66374083587874,
+	100.6829022550907, 100.70204248975526, 100.72116158666327, 100.74025959245071,
+	100.75933655359943, 100.77839251643773, 100.79742752714114, 100.81644163173306,
+	100.83543487608534, 100.8544073059191, 100.87335896680528, 100.8922899041653,
+	100.91120016327177, 100.9300897892491, 100.94895882707414, 100.96780732157686,
+	100.98663531744094, 101.00544285920446, 101.0242299912605, 101.04299675785774,
+	101.06174320310113, 101.08046937095253, 101.09917530523128, 101.11786104961482,
+	101.1365266476393, 101.15517214270028, 101.17379757805317, 101.19240299681397,
+	101.21098844195981, 101.22955395632955, 101.24809958262439, 101.26662536340842,
+	101.28513134110929, 101.30361755801869, 101.32208405629297, 101.34053087795374,
+	101.35895806488844, 101.37736565885089, 101.39575370146184, 101.4141222342096,
+	101.43247129845054, 101.45080093540966, 101.46911118618118, 101.48740209172907,
+	101.50567369288756, 101.52392603036176, 101.54215914472816, 101.5603730764352,
+	101.57856786580376, 101.59674355302775, 101.61490017817458, 101.63303778118578,
+	101.65115640187743, 101.66925607994075, 101.6873368549426, 101.70539876632601,
+	101.72344185341066, 101.74146615539345, 101.75947171134894, 101.77745856022996,
+	101.79542674086798, 101.81337629197375, 101.83130725213772, 101.84921965983054,
+	101.86711355340358, 101.88498897108941, 101.90284595100232, 101.92068453113876,
+	101.93850474937781, 101.95630664348178, 101.97409025109656, 101.99185560975212,
+	102.00960275686307, 102.02733172972907, 102.04504256553525, 102.06273530135277,
+	102.08040997413929, 102.0980666207393, 102.11570527788476, 102.1333259821954,
+	102.15092877017932, 102.16851367823331, 102.18608074264338, 102.20362999958522,
+	102.22116148512458, 102.23867523521778, 102.2561712857121, 102.27364967234629,
+	102.29111043075095, 102.30855359644893, 102.32597920485588, 102.34338729128058,
+	102.36077789092542, 102.37815103888678, 102.39550677015558, 102.41284511961746,
+	102.43016612205349, 102.44746981214037, 102.46475622445095, 102.48202539345462,
+	102.4992773535177, 102.51651213890393, 102.53372978377476, 102.55093032218986,
+	102.56811378810744, 102.58528021538473, 102.60242963777833, 102.61956208894462,
+	102.63667760244016, 102.6537762117221, 102.67085795014853, 102.68792285097891,
+	102.70497094737443, 102.72200227239844, 102.73901685901679, 102.75601474009821,
+	102.77299594841475, 102.78996051664205, 102.8069084773599, 102.82383986305238,
+},
+{
+	-HUGE_VAL, -5.1592452938915585, 6.8407547061084415, 13.860304714762322,
+	18.840754706108441, 22.703891844756797, 25.860304714762322, 28.529013770799693,
+	30.840754706108441, 32.879854723416187, 34.703891844756797, 36.353934129756013,
+	37.860304714762322, 39.246031323801546, 40.529013770799693, 41.723441853410669,
+	42.840754706108441, 43.890308801112518, 44.879854723416187, 45.815884867431471,
+	46.703891844756797, 47.548563779453573, 48.353934129756013, 49.123498178792602,
+	49.860304714762322, 50.567028983405137, 51.246031323801553, 51.899404732070067,
+	52.529013770799693, 53.136526647639307, 53.723441853410662, 54.291110430750948,
+	54.840754706108441, 55.373484138409886, 55.890308801112511, 56.392150909448041,
+	56.879854723416187, 57.354195093655839, 57.815884867431471, 58.265581332455426,
+	58.703891844756797, 59.131378761525447, 59.548563779453573, 59.955931762533616,
+	60.353934129756013, 60.742991862064542, 61.123498178792602, 61.495820926240093,
+	61.860304714762322, 62.217272835490945, 62.567028983405137, 62.909858809766391,
+	63.246031323801553, 63.575800160866834, 63.899404732070067, 64.217071268404354,
+	64.529013770799693, 64.835434876085344, 65.136526647639315, 65.432471298450537,
+	65.723441853410662, 66.009602756863075, 66.291110430750948, 66.568113788107439,
+	66.840754706108441, 67.109168462449901, 67.373484138409879, 67.633824991601713,
+	67.890308801112511, 68.143048187446468, 68.392150909448034, 68.637720140164632,
+	68.879854723416187, 69.118649412668645, 69.354195093655846, 69.586578992059017,
+	69.815884867431464, 70.042193194447265, 70.265581332455426, 70.486123684233675,
+	70.703891844756797, 70.918954740723933, 71.131378761525454, 71.341227882271539,
+	71.548563779453573, 71.753445939760866, 71.955931762533623, 72.15607665629318,
+	72.353934129756013, 72.549555877705217, 72.742991862064542, 72.934290388492798,
+	73.123498178792602, 73.310660439404813, 73.495820926240086, 73.679022006079819,
+	73.860304714762322, 74.039708812353979, 74.217272835490945, 74.393034147063759,
+	74.567028983405137, 74.739292499129974, 74.909858809766391, 75.078761032307071,
+	75.246031323801546, 75.411700918101914, 75.575800160866834, 75.738358542922214,
+	75.899404732070067, 76.058966603431557, 76.217071268404354, 76.373745102309712,
+	76.529013770799693, 76.682902255090696, 76.835434876085344, 76.986635317440943,
+	77.1365266476393, 77.285131341109292, 77.432471298450537, 77.578567865803763,
+	77.723441853410662, 77.867113553403584, 78.009602756863075, 78.15092877017932,
+	78.291110430750948, 78.430166122053492, 78.568113788107439, 78.704970947374434,
+	78.840754706108441, 78.975481771187489, 79.109168462449901, 79.241830724557843,
+	79.373484138409879, 79.504143932122716, 79.633824991601713, 79.762541870718422,
+	79.890308801112511, 80.017139701634761, 80.143048187446468, 80.268047578790529,
+	80.392150909448048, 80.515370934893966, 80.637720140164632, 80.759210747449117,
+	80.879854723416187, 80.999663786287655, 81.118649412668645, 81.236822844144811,
+	81.354195093655846, 81.470776951654386, 81.586578992059017, 81.701611578009391,
+	81.815884867431464, 81.929408818420271, 82.042193194447265, 82.154247569399288,
+	82.265581332455426, 82.376203692807962, 82.486123684233675, 82.595350169520714,
+	82.703891844756797, 82.811757243483854, 82.918954740723933, 83.025492556881375,
+	83.131378761525454, 83.236621277058234, 83.341227882271539, 83.445206215797072,
+	83.548563779453573, 83.65130794149465, 83.753445939760866, 83.854984884739224,
+	83.955931762533623, 84.056293437749133, 84.15607665629318, 84.255288048096389,
+	84.353934129756013, 84.452021307104417, 84.549555877705217, 84.646544033279525,
+	84.742991862064542, 84.838905351106916, 84.934290388492798, 85.029152765516955,
+	85.123498178792602, 85.217332232304187, 85.310660439404813, 85.403488224760082,
+	85.4958209262401, 85.587663796761319, 85.679022006079819, 85.769900642537436,
+	85.860304714762322, 85.950239153325413, 86.039708812353979, 86.128718471103767,
+	86.217272835490945, 86.305376539584955, 86.393034147063759, 86.480250152632237,
+	86.567028983405137, 86.653375000255579, 86.739292499129988, 86.824785712330566,
+	86.909858809766391, 86.994515900173795, 87.078761032307057, 87.162598196100348,
+	87.24603132380156, 87.329064291079035, 87.411700918101914, 87.493944970594669,
+	87.575800160866834, 87.657270148818498, 87.738358542922214, 87.819068901181964,
+	87.899404732070067, 87.979369495442199, 88.058966603431557, 88.138199421322525,
+	88.217071268404368, 88.295585418805615, 88.373745102309712, 88.451553505152106,
+	88.529013770799693, 88.606129000712883, 88.682902255090696, 88.759336553599425,
+	88.835434876085344, 88.911200163271772, 88.986635317440943, 89.06174320310113,
+	89.1365266476393, 89.210988441959813, 89.285131341109292, 89.358958064888441,
+	89.432471298450537, 89.505673692887555, 89.578567865803763, 89.651156401877429,
+	89.723441853410662, 89.795426740867981, 89.867113553403584, 89.938504749377813,
+	90.009602756863075, 90.080409974139286, 90.15092877017932, 90.221161485124583,
+	90.291110430750948, 90.360777890925419, 90.430166122053492, 90.499277353517698,
+	90.568113788107439, 90.636677602440159, 90.704970947374434, 90.772995948414746,
+	90.840754706108441, 90.908249296434974, 90.975481771187489, 91.042454158347084,
+	91.109168462449901, 91.17562666494706, 91.241830724557843, 91.307782577616081,
+	91.373484138409879, 91.438937299515175, 91.504143932122716, 91.569105886359097,
+	91.633824991601713, 91.698303056787935, 91.762541870718422, 91.826543202354912,
+	91.890308801112511, 91.953840397146678, 92.017139701634761, 92.080208407052709,
+	92.143048187446482, 92.205660698698708, 92.268047578790544, 92.330210448058693,
+	92.392150909448048, 92.453870548759554, 92.515370934893966, 92.576653620091037,
+	92.637720140164632, 92.698572014733685, 92.759210747449117, 92.819637826216692,
+	92.879854723416187, 92.939862896116594, 92.999663786287655, 93.059258821007859,
+	93.118649412668645, 93.177836959175423, 93.236822844144825, 93.295608437098892,
+	93.354195093655846, 93.412584155717639, 93.470776951654386, 93.528774796485692,
+	93.586578992059017, 93.644190827224861, 93.701611578009391, 93.758842507783854,
+	93.815884867431464, 93.872739895511415, 93.929408818420271, 93.985892850550599,
+	94.042193194447265, 94.098311040960937, 94.154247569399303, 94.210003947675673,
+	94.265581332455426, 94.320980869299859, 94.376203692807962, 94.43125092675578,
+	94.486123684233689, 94.540823067781332, 94.595350169520714, 94.649706071286872,
+	94.703891844756797, 94.75790855157608, 94.811757243483854, 94.865438962435547,
+	94.918954740723933, 94.972305601098242, 95.025492556881375, 95.078516612085437,
+	95.13137876152544, 95.184079990931338, 95.236621277058234, 95.289003587795051,
+	95.341227882271539, 95.393295110963592, 95.445206215797072, 95.496962130250068,
+	95.548563779453559, 95.600012080290739, 95.65130794149465, 95.702452263744561,
+	95.753445939760866, 95.804289854398519, 95.854984884739224, 95.905531900182197,
+	95.955931762533623, 96.006185326094823, 96.056293437749133, 96.106256937047576,
+	96.15607665629318, 96.205753420624262, 96.255288048096389, 96.304681349763172,
+	96.353934129756013, 96.40304718536261, 96.452021307104417, 96.500857278812973,
+	96.549555877705217, 96.598117874457643, 96.646544033279525, 96.694835111985057,
+	96.742991862064542, 96.791015028754501, 96.838905351106902, 96.88666356205745,
+	96.934290388492798, 96.981786551316986, 97.029152765516955, 97.076389740227,
+	97.123498178792602, 97.1704787788332, 97.217332232304187, 97.264059225558086,
+	97.310660439404813, 97.357136549171301, 97.403488224760082, 97.449716130707372,
+	97.4958209262401, 97.541803265332419, 97.587663796761319, 97.633403164161535,
+	97.679022006079819, 97.7245209560283, 97.769900642537436, 97.815161689207926,
+	97.860304714762322, 97.905330333095606, 97.950239153325413, 97.995031779841369,
+	98.039708812353979, 98.08427084594274, 98.128718471103781, 98.173052273796671,
+	98.217272835490945, 98.261380733211723, 98.305376539584955, 98.34926082288203,
+	98.393034147063759, 98.436697071823943, 98.480250152632237, 98.523693940776596,
+	98.567028983405137, 98.610255823567485, 98.653375000255579, 98.696387048444052,
+	98.739292499129988, 98.782091879372288, 98.824785712330552, 98.867374517303404,
+	98.909858809766391, 98.952239101409432, 98.994515900173795, 99.036689710288641,
+	99.078761032307057, 99.120730363141789, 99.162598196100348, 99.20436502091988,
+	99.246031323801546, 99.287597587444409, 99.329064291079035, 99.370431910500656,
+	99.411700918101914, 99.452871782905191, 99.493944970594669, 99.534920943547831,
+	99.575800160866834, 99.616583078409207, 99.657270148818498, 99.697861821554326,
+	99.738358542922214, 99.778760756102997, 99.819068901181964, 99.859283415177629,
+	99.899404732070067, 99.939433282829143, 99.979369495442199, 100.01921379494152,
+	100.05896660343156, 100.09862834011562, 100.13819942132253, 100.17768026053274,
+	100.21707126840435, 100.25637285279869, 100.29558541880562, 100.33470936876867,
+	100.37374510230973, 100.41269301635356, 100.45155350515211, 100.49032696030825,
+	100.52901377079969, 100.5676143230022, 100.60612900071288, 100.64455818517303,
+	100.6829022550907, 100.72116158666327, 100.75933655359943, 100.79742752714114,
+	100.83543487608534, 100.87335896680528, 100.91120016327177, 100.94895882707414,
+	100.98663531744094, 101.0242299912605, 101.06174320310113, 101.09917530523128,
+	101.1365266476393, 101.17379757805317, 101.21098844195981, 101.24809958262439,
+	101.28513134110929, 101.32208405629297, 101.35895806488844, 101.39575370146184,
+	101.43247129845054, 101.46911118618118, 101.50567369288756, 101.54215914472816,
+	101.57856786580376, 101.61490017817458, 101.65115640187743, 101.6873368549426,
+	101.72344185341066, 101.75947171134894, 101.79542674086798, 101.83130725213772,
+	101.86711355340358, 101.90284595100232, 101.93850474937781, 101.97409025109656,
+	102.00960275686307, 102.04504256553525, 102.08040997413929, 102.11570527788476,
+	102.15092877017932, 102.18608074264338, 102.22116148512458, 102.2561712857121,
+	102.29111043075095, 102.32597920485588, 102.36077789092542, 102.39550677015558,
+	102.43016612205349, 102.46475622445095, 102.4992773535177, 102.53372978377476,
+	102.56811378810744, 102.60242963777833, 102.63667760244016, 102.67085795014853,
+	102.70497094737443, 102.73901685901679, 102.77299594841475, 102.8069084773599,
+	102.84075470610844, 102.87453489339309, 102.90824929643497, 102.94189817095541,
+	102.97548177118749, 103.00900034988766, 103.04245415834708, 103.07584344640301,
+	103.1091684624499, 103.14242945345055, 103.17562666494706, 103.20876034107174,
+	103.24183072455784, 103.27483805675027, 103.30778257761608, 103.34066452575502,
+	103.37348413840988, 103.40624165147675, 103.43893729951517, 103.4715713157583,
+	103.50414393212273, 103.53665537921856, 103.5691058863591, 103.60149568157055,
+	103.63382499160171, 103.66609404193339, 103.69830305678794, 103.7304522591385,
+	103.76254187071842, 103.79457211203022, 103.82654320235491, 103.85845535976078,
+	103.89030880111252, 103.92210374207991, 103.95384039714668, 103.98551897961912,
+	104.01713970163476, 104.04870277417083, 104.08020840705271, 104.11165680896234,
+	104.14304818744648, 104.17438274892493, 104.20566069869871, 104.23688224095807,
+	104.26804757879054, 104.29915691418881, 104.33021044805869, 104.36120838022673,
+	104.39215090944805, 104.42303823341396, 104.45387054875955, 104.48464805107119,
+	104.51537093489397, 104.54603939373905, 104.57665362009104, 104.6072138054152,
+	104.63772014016463, 104.66817281378744, 104.69857201473368, 104.72891793046256,
+	104.75921074744912, 104.7894506511913, 104.81963782621671, 104.84977245608928,
+	104.87985472341619, 104.90988480985423, 104.93986289611658, 104.96978916197929,
+	104.99966378628766, 105.02948694696279, 105.05925882100786, 105.08897958451441,
+	105.11864941266865, 105.14826847975765, 105.17783695917542, 105.20735502342907,
+	105.23682284414483, 105.26624059207398, 105.29560843709889, 105.32492654823884,
+	105.35419509365585, 105.38341424066049, 105.41258415571764, 105.44170500445212,
+	105.47077695165439, 105.4998001612861, 105.52877479648569, 105.55770101957387,
+	105.58657899205902, 105.61540887464267, 105.64419082722486, 105.67292500890946,
+	105.70161157800939, 105.73025069205192, 105.75884250778385, 105.78738718117663,
+	105.81588486743146, 105.84433572098443, 105.87273989551142, 105.90109754393319,
+	105.92940881842027, 105.95767387039783, 105.9858928505506, 106.01406590882766,
+	106.04219319444726, 106.07027485590146, 106.09831104096094, 106.12630189667962,
+	106.1542475693993, 106.18214820475421, 106.21000394767567, 106.23781494239647,
+	106.26558133245543, 106.29330326070183, 106.32098086929986, 106.34861429973292,
+	106.37620369280796, 106.40374918865992, 106.43125092675578, 106.45870904589903,
+	106.48612368423369, 106.51349497924853, 106.54082306778133, 106.56810808602279,
+	106.59535016952071, 106.62254945318405, 106.64970607128687, 106.67682015747238,
+	106.7038918447568, 106.73092126553334, 106.75790855157608, 106.78485383404382,
+	106.81175724348385, 106.83861890983584, 106.86543896243555, 106.89221753001854,
+	106.91895474072393, 106.94565072209811, 106.97230560109824, 106.99891950409608,
+	107.02549255688137, 107.05202488466561, 107.07851661208544, 107.1049678632062,
+	107.13137876152544, 107.15774942997641, 107.18407999093134, 107.21037056620506,
+	107.23662127705823, 107.26283224420075, 107.28900358779505, 107.3151354274595,
+	107.34122788227154, 107.36728107077107, 107.39329511096359, 107.41927012032346,
+	107.44520621579707, 107.47110351380597, 107.49696213025007, 107.52278218051065,
+	107.54856377945356, 107.57430704143225, 107.60001208029074, 107.62567900936676,
+	107.65130794149465, 107.67689898900841, 107.70245226374456, 107.72796787704523,
+	107.75344593976087, 107.77888656225331, 107.80428985439852, 107.82965592558952,
+	107.85498488473922, 107.8802768402831, 107.9055319001822, 107.93075017192564,
+	107.95593176253362, 107.98107677855994, 108.00618532609482, 108.03125751076755,
+	108.05629343774913, 108.08129321175501, 108.10625693704758, 108.13118471743888,
+	108.15607665629318, 108.18093285652952, 108.20575342062426, 108.23053845061369,
+	108.25528804809639, 108.28000231423593, 108.30468134976317, 108.32932525497887,
+	108.35393412975601, 108.37850807354232, 108.40304718536261, 108.42755156382123,
+	108.45202130710442, 108.47645651298264, 108.50085727881297, 108.52522370154142,
+	108.54955587770522, 108.57385390343511, 108.59811787445764, 108.62234788609746,
+	108.64654403327953, 108.6707064105313, 108.69483511198506, 108.71893023138003,
+	108.74299186206454, 108.76702009699831, 108.7910150287545, 108.81497674952186,
+	108.8389053511069, 108.86280092493601, 108.88666356205745, 108.91049335314358,
+	108.9342903884928, 108.95805475803169, 108.98178655131699, 109.00548585753769,
+	109.02915276551695, 109.05278736371419, 109.076389740227, 109.09995998279317,
+	109.1234981787926, 109.14700441524928, 109.1704787788332, 109.19392135586224,
+	109.21733223230419, 109.24071149377845, 109.26405922555809, 109.2873755125716,
+	109.31066043940481, 109.33391409030273, 109.3571365491713, 109.38032789957929,
+	109.40348822476008, 109.42661760761345, 109.44971613070737, 109.47278387627971,
+	109.4958209262401, 109.51882736217158, 109.54180326533242, 109.56474871665773,
+	109.58766379676132, 109.61054858593722, 109.63340316416154, 109.65622761109404,
+	109.67902200607982, 109.701786428151, 109.7245209560283, 109.74722566812281,
+	109.76990064253744, 109.79254595706861, 109.81516168920793, 109.83774791614364,
+	109.86030471476232, 109.88283216165036, 109.90533033309561, 109.92779930508885,
+	109.95023915332541, 109.97264995320661, 109.99503177984137, 110.01738470804764,
+	110.03970881235398, 110.06200416700096, 110.08427084594274, 110.10650892284848,
+	110.12871847110378, 110.15089956381219, 110.17305227379667, 110.19517667360093,
+	110.21727283549095, 110.23934083145632, 110.26138073321172, 110.28339261219828,
+	110.30537653958496, 110.32733258626995, 110.34926082288203, 110.37116131978195,
+	110.39303414706376, 110.41487937455619, 110.43669707182394, 110.45848730816905,
+	110.48025015263224, 110.50198567399411, 110.5236939407766, 110.54537502124415,
+	110.56702898340514, 110.58865589501296, 110.61025582356748, 110.63182883631622,
+	110.65337500025558, 110.67489438213219, 110.69638704844405, 110.7178530654418,
+	110.73929249912999, 110.76070541526818, 110.78209187937229, 110.80345195671572,
+	110.82478571233055, 110.84609321100878, 110.8673745173034, 110.88862969552972,
+	110.90985880976639, 110.93106192385665, 110.95223910140943, 110.97339040580056,
+	110.99451590017379, 111.0156156474421, 111.03668971028864, 111.05773815116795,
+	111.07876103230706, 111.09975841570659, 111.12073036314179, 111.14167693616375,
+	111.16259819610035, 111.18349420405744, 111.20436502091988, 111.22521070735257,
+	111.24603132380155, 111.26682693049501, 111.28759758744441, 111.30834335444541,
+	111.32906429107904, 111.34976045671257, 111.37043191050066, 111.39107871138633,
+	111.41170091810191, 111.43229858917017, 111.45287178290519, 111.47342055741343,
+	111.49394497059467, 111.51444508014301, 111.53492094354783, 111.55537261809482,
+	111.57580016086683, 111.5962036287449, 111.61658307840921, 111.63693856633999,
+	111.6572701488185, 111.67757788192793, 111.69786182155433, 111.71812202338756,
+	111.73835854292221, 111.75857143545844, 111.778760756103, 111.79892655977,
+	111.81906890118196, 111.83918783487057, 111.85928341517763, 111.8793556962559,
+	111.89940473207007, 111.91943057639749, 111.93943328282914, 111.95941290477046,
+	111.9793694954422, 111.99930310788125, 112.01921379494152, 112.03910160929482,
+	112.05896660343156, 112.07880882966172, 112.09862834011562, 112.11842518674473,
+	112.13819942132253, 112.15795109544524, 112.17768026053274, 112.19738696782929,
+	112.21707126840435, 112.2367332131534, 112.25637285279869, 112.27599023789003,
+	112.29558541880562, 112.31515844575276, 112.33470936876867, 112.3542382377212,
+	112.37374510230973, 112.39323001206569, 112.41269301635356, 112.4321341643715,
+	112.45155350515211, 112.47095108756312, 112.49032696030825, 112.50968117192787,
+	112.52901377079969, 112.54832480513957, 112.5676143230022, 112.58688237228181,
+	112.60612900071288, 112.62535425587092, 112.64455818517303, 112.66374083587874,
+	112.6829022550907, 112.70204248975526, 112.72116158666327, 112.74025959245071,
+	112.75933655359943, 112.77839251643773, 112.79742752714114, 112.81644163173306,
+	112.83543487608534, 112.8544073059191, 112.87335896680528, 112.8922899041653,
+	112.91120016327177, 112.9300897892491, 112.94895882707414, 112.96780732157686,
+	112.98663531744094, 113.00544285920446, 113.0242299912605, 113.04299675785774,
+	113.06174320310113, 113.08046937095253, 113.09917530523128, 113.11786104961482,
+	113.1365266476393, 113.15517214270028, 113.17379757805317, 113.19240299681397,
+	113.21098844195981, 113.22955395632955, 113.24809958262439, 113.26662536340842,
+	113.28513134110929, 113.30361755801869, 113.32208405629297, 113.34053087795374,
+	113.35895806488844, 113.37736565885089, 113.39575370146184, 113.4141222342096,
+	113.43247129845054, 113.45080093540966, 113.46911118618118, 113.48740209172907,
+	113.50567369288756, 113.52392603036176, 113.54215914472816, 113.5603730764352,
+	113.57856786580376, 113.59674355302775, 113.61490017817458, 113.63303778118578,
+	113.65115640187743, 113.66925607994075, 113.6873368549426, 113.70539876632601,
+	113.72344185341066, 113.74146615539345, 113.75947171134894, 113.77745856022996,
+	113.79542674086798, 113.81337629197375, 113.83130725213772, 113.84921965983054,
+	113.86711355340358, 113.88498897108941, 113.90284595100232, 113.92068453113876,
+	113.93850474937781, 113.95630664348178, 113.97409025109656, 113.99185560975212,
+	114.00960275686307, 114.02733172972907, 114.04504256553525, 114.06273530135277,
+	114.08040997413929, 114.0980666207393, 114.11570527788476, 114.1333259821954,
+	114.15092877017932, 114.16851367823331, 114.18608074264338, 114.20362999958522,
+	114.22116148512458, 114.23867523521778, 114.2561712857121, 114.27364967234629,
+	114.29111043075095, 114.30855359644893, 114.32597920485588, 114.34338729128058,
+	114.36077789092542, 114.37815103888678, 114.39550677015558, 114.41284511961746,
+	114.43016612205349, 114.44746981214037, 114.46475622445095, 114.48202539345462,
+	114.4992773535177, 114.51651213890393, 114.53372978377476, 114.55093032218986,
+	114.56811378810744, 114.58528021538473, 114.60242963777833, 114.61956208894462,
+	114.63667760244016, 114.6537762117221, 114.67085795014853, 114.68792285097891,
+	114.70497094737443, 114.72200227239844, 114.73901685901679, 114.75601474009821,
+	114.77299594841475, 114.78996051664205, 114.8069084773599, 114.82383986305238,
+},
+};
+
+const double freqtable_50000[8][1024] = {
+{
+	-HUGE_VAL, -89.060630869054165, -77.060630869054165, -70.041080860400314,
+	-65.060630869054165, -61.197493730405824, -58.041080860400299, -55.372371804362928,
+	-53.060630869054165, -51.021530851746434, -49.197493730405824, -47.547451445406608,
+	-46.041080860400299, -44.655354251361061, -43.372371804362928, -42.177943721751959,
+	-41.060630869054165, -40.01107677405011, -39.021530851746434, -38.085500707731143,
+	-37.197493730405824, -36.352821795709048, -35.547451445406608, -34.777887396370033,
+	-34.041080860400299, -33.334356591757469, -32.655354251361061, -32.001980843092554,
+	-31.372371804362928, -30.764858927523306, -30.177943721751959, -29.610275144411673,
+	-29.060630869054165, -28.527901436752742, -28.01107677405011, -27.509234665714558,
+	-27.021530851746434, -26.547190481506775, -26.085500707731143, -25.635804242707195,
+	-25.197493730405824, -24.770006813637167, -24.352821795709048, -23.945453812628998,
+	-23.547451445406608, -23.158393713098079, -22.777887396370019, -22.405564648922521,
+	-22.041080860400299, -21.684112739671676, -21.334356591757484, -20.99152676539623,
+	-20.655354251361075, -20.325585414295787, -20.001980843092554, -19.684314306758267,
+	-19.372371804362928, -19.065950699077277, -18.764858927523306, -18.46891427671207,
+	-18.177943721751944, -17.891782818299546, -17.610275144411673, -17.333271787055182,
+	-17.060630869054165, -16.79221711271272, -16.527901436752728, -16.267560583560908,
+	-16.01107677405011, -15.758337387716139, -15.509234665714573, -15.263665434997989,
+	-15.021530851746434, -14.782736162493961, -14.547190481506775, -14.314806583103604,
+	-14.085500707731143, -13.859192380715356, -13.635804242707195, -13.415261890928932,
+	-13.197493730405824, -12.982430834438674, -12.770006813637167, -12.560157692891082,
+	-12.352821795709048, -12.147939635401755, -11.945453812628998, -11.745308918869441,
+	-11.547451445406608, -11.351829697457404, -11.158393713098079, -10.967095186669809,
+	-10.777887396370019, -10.590725135757793, -10.405564648922521, -10.222363569082802,
+	-10.041080860400299, -9.8616767628086421, -9.6841127396716757, -9.5083514280988624,
+	-9.3343565917574836, -9.1620930760326331, -8.9915267653962303, -8.8226245428555501,
+	-8.6553542513610751, -8.4896846570607067, -8.3255854142957872, -8.1630270322404215,
+	-8.0019808430925536, -7.8424189717310639, -7.6843143067582673, -7.5276404728528945,
+	-7.3723718043629276, -7.2184833200719254, -7.0659506990772769, -6.9147502577216784,
+	-6.7648589275233064, -6.616254234053315, -6.46891427671207, -6.3228177093588442,
+	-6.1779437217519444, -6.0342720217590369, -5.8917828182995464, -5.7504568049832869,
+	-5.6102751444116734, -5.4712194531091285, -5.3332717870551818, -5.1964146277881866,
+	-5.0606308690541653, -4.9259038039751317, -4.79221711271272, -4.6595548506047635,
+	-4.5279014367527282, -4.3972416430398908, -4.2675605835609076, -4.1388437044441986,
+	-4.0110767740501103, -3.8842458735278598, -3.7583373877161392, -3.6333379963720773,
+	-3.5092346657145725, -3.3860146402686553, -3.2636654349979892, -3.1421748277135038,
+	-3.0215308517464337, -2.9017217888749656, -2.7827361624939613, -2.6645627310177957,
+	-2.5471904815067745, -2.4306086235082347, -2.3148065831036035, -2.1997739971532297,
+	-2.0855007077311427, -1.9719767567423503, -1.8591923807153563, -1.7471380057633183,
+	-1.635804242707195, -1.5251818823546444, -1.4152618909289316, -1.3060354056419072,
+	-1.1974937304058244, -1.0896283316787674, -0.98243083443867363, -0.87589301828124633,
+	-0.77000681363716694, -0.66476429810438731, -0.56015769289108164, -0.45617935936554943,
+	-0.35282179570904759, -0.25007763366795643, -0.14793963540175525, -0.046400690423411106,
+	0.054546187371002475, 0.15490786258652633, 0.25469108113055938, 0.35390247293378252,
+	0.45254855459339183, 0.55063573194179583, 0.64817030254259578, 0.7451584581169044,
+	0.84160628690192141, 0.93751977594429547, 1.032904813330191, 1.1277671903543336,
+	1.2221126036299808, 1.3159466571415663, 1.4092748642422066, 1.502102649597461,
+	1.5944353510774789, 1.6862782215986982, 1.7776364309171981, 1.8685150673748154,
+	1.9589191395997005, 2.0488535781627775, 2.1383232371913579, 2.2273328959411458,
+	2.3158872603283243, 2.4039909644223485, 2.4916485719011376, 2.5788645774696164,
+	2.6656434082425164, 2.7519894250929724, 2.8379069239673669, 2.9234001371679454,
+	3.0084732346037697, 3.0931303250111739, 3.1773754571444499, 3.2612126209377266,
+	3.3446457486389249, 3.4276787159164144, 3.5103153429392933, 3.5925593954320476,
+	3.6744145857042128, 3.7558845736558908, 3.8369729677595785, 3.9176833260193433,
+	3.9980191569074464, 4.0779839202795785, 4.1575810282689361, 4.2368138461599187,
+	4.3156856932417327, 4.3941998436430083, 4.4723595271471055, 4.5501679299894846,
+	4.6276281956370724, 4.7047434255502765, 4.7815166799280746, 4.8579509784368042,
+	4.9340493009227231, 5.0098145881091511, 5.0852497422783216, 5.1603576279385095,
+	5.2351410724766936, 5.3096028667971851, 5.383745765946685, 5.4575724897258198,
+	5.53108572328793, 5.6042881177249342, 5.6771822906411558, 5.7497708267148084,
+	5.8220562782480556, 5.8940411657053602, 5.9657279782409631, 6.0371191742151922,
+	6.1082171817004536, 6.1790243989766651, 6.249543195016706, 6.3197759099619617,
+	6.3897248555883266, 6.4593923157627984, 6.5287805468908715, 6.5978917783550912,
+	6.6667282129448182, 6.7352920272775521, 6.8035853722118134, 6.8716103732521248,
+	6.9393691309458276, 7.0068637212723672, 7.0740961960248754, 7.1410685831844773,
+	7.20778288728728, 7.2742410897844394, 7.3404451493952294, 7.4063970024534527,
+	7.4720985632472718, 7.5375517243525678, 7.6027583569601092, 7.6677203111964758,
+	7.7324394164390924, 7.7969174816253144, 7.8611562955558014, 7.9251576271922914,
+	7.9889232259498968, 8.0524548219840568, 8.1157541264721402, 8.1788228318900877,
+	8.2416626122838608, 8.3042751235360868, 8.3666620036279227, 8.4288248728960724,
+	8.4907653342854275, 8.5524849735969326, 8.6139853597313518, 8.6752680449284156,
+	8.7363345650020108, 8.7971864395710782, 8.8578251722864962, 8.9182522510540778,
+	8.9784691482535735, 9.0384773209539659, 9.0982782111250415, 9.1578732458452379,
+	9.2172638375060387, 9.2764513840128018, 9.3354372689822043, 9.3942228619362709,
+	9.4528095184932255, 9.5111985805550177, 9.5693913764917653, 9.6273892213230852,
+	9.6851934168963965, 9.7428052520622472, 9.8002260028467703, 9.8574569326212327,
+	9.9144992922688502, 9.9713543203488086, 10.028023243257643, 10.084507275387978,
+	10.140807619284644, 10.196925465798323, 10.252861994236682, 10.308618372513052,
+	10.364195757292805, 10.419595294137245, 10.474818117645356, 10.529865351593173,
+	10.584738109071068, 10.639437492618711, 10.693964594358093, 10.748320496124258,
+	10.802506269594168, 10.856522976413459, 10.910371668321233, 10.964053387272926,
+	11.017569165561319, 11.070920025935635, 11.124106981718754, 11.177131036922816,
+	11.229993186362833, 11.282694415768724, 11.33523570189562, 11.387618012632437,
+	11.439842307108918, 11.491909535800971, 11.543820640634451, 11.595576555087447,
+	11.647178204290945, 11.698626505128118, 11.749922366332044, 11.801066688581955,
+	11.852060364598245, 11.902904279235898, 11.953599309576596, 12.004146325019576,
+	12.054546187371002, 12.104799750932202, 12.154907862586526, 12.204871361884955,
+	12.254691081130559, 12.304367845461655, 12.353902472933775, 12.403295774600558,
+	12.452548554593392, 12.501661610199989, 12.550635731941796, 12.599471703650352,
+	12.648170302542596, 12.696732299295022, 12.745158458116904, 12.793449536822443,
+	12.841606286901921, 12.889629453591873, 12.937519775944295, 12.985277986894836,
+	13.032904813330184, 13.08040097615438, 13.127767190354334, 13.175004165064379,
+	13.222112603629981, 13.269093203670579, 13.315946657141566, 13.362673650395465,
+	13.409274864242199, 13.45575097400868, 13.502102649597461, 13.548330555544744,
+	13.594435351077479, 13.640417690169791, 13.686278221598698, 13.732017588998929,
+	13.777636430917198, 13.823135380865686, 13.868515067374815, 13.913776114045312,
+	13.958919139599701, 14.003944757932992, 14.048853578162785, 14.093646204678748,
+	14.138323237191358, 14.182885270780133, 14.227332895941153, 14.27166669863405,
+	14.315887260328324, 14.359995158049102, 14.403990964422348, 14.447875247719409,
+	14.491648571901138, 14.535311496661315, 14.578864577469616, 14.622308365613975,
+	14.665643408242516, 14.708870248404864, 14.751989425092965, 14.795001473281438,
+	14.837906923967367, 14.880706304209667, 14.923400137167945, 14.965988942140783,
+	15.00847323460377, 15.050853526246811, 15.093130325011174, 15.13530413512602,
+	15.17737545714445, 15.219344787979168, 15.261212620937727, 15.302979445757273,
+	15.344645748638925, 15.386212012281788, 15.427678715916414, 15.469046335338035,
+	15.510315342939293, 15.551486207742585, 15.592559395432048, 15.633535368385225,
+	15.674414585704213, 15.715197503246586, 15.755884573655891, 15.796476246391713,
+	15.836972967759586, 15.877375180940369, 15.917683326019343, 15.957897840015008,
+	15.998019156907446, 16.038047707666522, 16.077983920279578, 16.117828219778914,
+	16.157581028268936, 16.197242764953003, 16.236813846159912, 16.276294685370125,
+	16.315685693241733, 16.35498727763607, 16.394199843643008, 16.433323793606043,
+	16.472359527147105, 16.511307441190951, 16.550167929989485, 16.588941385145631,
+	16.627628195637072, 16.666228747839597, 16.704743425550276, 16.743172610010404,
+	16.781516679928082, 16.819776011500643, 16.857950978436804, 16.896041951978525,
+	16.934049300922723, 16.971973391642663, 17.009814588109151, 17.04757325191153,
+	17.085249742278322, 17.122844416097877, 17.160357627938509, 17.197789730068656,
+	17.235141072476694, 17.272412002890547, 17.309602866797185, 17.346714007461763,
+	17.383745765946685, 17.420698481130344, 17.45757248972582, 17.494368126299221,
+	17.53108572328793, 17.567725611018574, 17.604288117724934, 17.640773569565553,
+	17.677182290641156, 17.713514603011973, 17.749770826714808, 17.785951279779987,
+	17.822056278248056, 17.85808613618633, 17.89404116570536, 17.929921676975098,
+	17.965727978240963, 18.001460375839699, 18.037119174215192, 18.072704675933927,
+	18.108217181700454, 18.143656990372627, 18.179024398976665, 18.21431970272215,
+	18.249543195016706, 18.284695167480763, 18.319775909961962, 18.354785710549493,
+	18.389724855588327, 18.424593629693263, 18.459392315762798, 18.49412119499295,
+	18.528780546890872, 18.563370649288323, 18.597891778355091, 18.632344208612153,
+	18.666728212944818, 18.701044062615715, 18.735292027277552, 18.769472374985909,
+	18.803585372211813, 18.837631283854172, 18.871610373252125, 18.905522902197283,
+	18.939369130945828, 18.973149318230469, 19.006863721272367, 19.040512595792791,
+	19.074096196024875, 19.107614774725036, 19.141068583184477, 19.174457871240392,
+	19.20778288728728, 19.241043878287925, 19.274241089784439, 19.307374765909117,
+	19.340445149395229, 19.373452481587648, 19.406397002453453, 19.43927895059241,
+	19.472098563247272, 19.504856076314127, 19.537551724352568, 19.570185740595676,
+	19.602758356960109, 19.635269804055937, 19.667720311196476, 19.700110106407934,
+	19.732439416439092, 19.764708466770777, 19.796917481625314, 19.829066683975896,
+	19.861156295555801, 19.893186536867603, 19.925157627192291, 19.957069784598168,
+	19.988923225949897, 20.020718166917291, 20.052454821984057, 20.084133404456509,
+	20.11575412647214, 20.147317199008214, 20.178822831890088, 20.210271233799716,
+	20.241662612283861, 20.272997173762306, 20.304275123536087, 20.335496665795446,
+	20.366662003627923, 20.397771339026207, 20.428824872896072, 20.459822805064107,
+	20.490765334285427, 20.521652658251341, 20.552484973596933, 20.583262475908583,
+	20.613985359731352, 20.644653818576423, 20.675268044928416, 20.705828230252578,
+	20.736334565002011, 20.766787238624808, 20.797186439571078, 20.827532355299937,
+	20.857825172286496, 20.888065076028681, 20.918252251054078, 20.948386880926677,
+	20.978469148253573, 21.00849923469162, 21.038477320953973, 21.068403586816665,
+	21.098278211125042, 21.12810137180017, 21.157873245845231, 21.187594009351784,
+	21.217263837506032, 21.246882904595026, 21.276451384012802, 21.305969448266453,
+	21.335437268982204, 21.364855016911356, 21.394222861936271, 21.423540973076214,
+	21.452809518493225, 21.482028665497864, 21.511198580555018, 21.540319429289497,
+	21.569391376491765, 21.598414586123482, 21.627389221323085, 21.656315444411256,
+	21.685193416896396, 21.714023299480047, 21.742805252062254, 21.771539433746845,
+	21.80022600284677, 21.828865116889311, 21.857456932621233, 21.886001606014013,
+	21.91449929226885, 21.942950145821811, 21.971354320348809, 21.999711968770583,
+	22.02802324325765, 22.056288295235206, 22.084507275387978, 22.112680333665054,
+	22.140807619284644, 22.168889280738846, 22.196925465798316, 22.224916321517,
+	22.252861994236682, 22.280762629591607, 22.308618372513052, 22.336429367233848,
+	22.364195757292805, 22.391917685539219, 22.419595294137245, 22.447228724570294,
+	22.474818117645356, 22.502363613497295, 22.529865351593173, 22.557323470736414,
+	22.584738109071061, 22.612109404085921, 22.639437492618711, 22.666722510860168,
+	22.693964594358093, 22.721163878021429, 22.748320496124258, 22.775434582309757,
+	22.802506269594176, 22.829535690370719, 22.856522976413466, 22.883468258881194,
+	22.910371668321233, 22.937233334673223, 22.964053387272926, 22.990831954855913,
+	23.017569165561319, 23.044265146935487, 23.070920025935628, 23.097533928933451,
+	23.124106981718754, 23.150639309502992, 23.177131036922816, 23.203582288043577,
+	23.229993186362826, 23.256363854813777, 23.282694415768724, 23.308984991042443,
+	23.335235701895613, 23.361446669038131, 23.387618012632437, 23.413749852296874,
+	23.439842307108918, 23.46589549560845, 23.491909535800971, 23.517884545160847,
+	23.543820640634451, 23.569717938643358, 23.595576555087447, 23.621396605348032,
+	23.647178204290952, 23.672921466269628, 23.698626505128125, 23.724293434204142,
+	23.749922366332044, 23.775513413845786, 23.801066688581955, 23.82658230188261,
+	23.852060364598245, 23.877500987090684, 23.902904279235898, 23.928270350426914,
+	23.953599309576596, 23.978891265120495, 24.004146325019576, 24.029364596763031,
+	24.054546187370995, 24.079691203397317, 24.104799750932202, 24.129871935604932,
+	24.154907862586526, 24.17990763659239, 24.204871361884962, 24.229799142276264,
+	24.254691081130559, 24.279547281366902, 24.304367845461655, 24.329152875451065,
+	24.353902472933768, 24.378616739073301, 24.403295774600558, 24.427939679816248,
+	24.452548554593392, 24.4771224983797, 24.501661610199989, 24.526165988658612,
+	24.550635731941796, 24.575070937820023, 24.599471703650352, 24.623838126378814,
+	24.648170302542596, 24.672468328272487, 24.696732299295022, 24.720962310934851,
+	24.745158458116904, 24.769320835368681, 24.793449536822443, 24.8175446562174,
+	24.841606286901921, 24.865634521835695, 24.88962945359188, 24.91359117435924,
+	24.937519775944288, 24.961415349773389, 24.985277986894836, 25.009107777980958,
+	25.032904813330177, 25.056669182869072, 25.08040097615438, 25.104100282375079,
+	25.127767190354334, 25.151401788551567, 25.175004165064379, 25.198574407630545,
+	25.222112603629981, 25.245618840086664, 25.269093203670579, 25.292535780699637,
+	25.315946657141566, 25.339325918615828, 25.362673650395465, 25.385989937408979,
+	25.409274864242199, 25.432528515140113, 25.45575097400868, 25.478942324416664,
+	25.502102649597461, 25.525232032450845, 25.548330555544744, 25.571398301117085,
+	25.594435351077472, 25.617441787008964, 25.640417690169798, 25.663363141495125,
+	25.686278221598698, 25.709163010774603, 25.732017588998929, 25.754842035931418,
+	25.777636430917198, 25.800400852988368, 25.823135380865693, 25.845840092960188,
+	25.868515067374815, 25.891160381905991, 25.913776114045312, 25.936362340981027,
+	25.958919139599701, 25.981446586487742, 26.003944757932992, 26.026413729926233,
+	26.048853578162792, 26.071264378043992, 26.093646204678748, 26.115999132885023,
+	26.138323237191358, 26.160618591838343, 26.182885270780133, 26.205123347685856,
+	26.227332895941153, 26.249513988649575, 26.27166669863405, 26.293791098438312,
+	26.315887260328324, 26.337955256293696, 26.359995158049102, 26.382007037035663,
+	26.403990964422341, 26.425947011107333, 26.447875247719409, 26.469775744619326,
+	26.491648571901138, 26.513493799393572, 26.535311496661322, 26.557101733006434,
+	26.578864577469616, 26.600600098831485, 26.622308365613975, 26.643989446081548,
+	26.665643408242516, 26.687270319850349, 26.708870248404871, 26.730443261153603,
+	26.751989425092972, 26.773508806969573, 26.795001473281431, 26.816467490279194,
+	26.837906923967367, 26.859319840105556, 26.880706304209667, 26.902066381553098,
+	26.923400137167938, 26.944707635846157, 26.96598894214079, 26.987244120367109,
+	27.00847323460377, 27.029676348694025, 27.050853526246811, 27.07200483063793,
+	27.093130325011181, 27.114230072279483, 27.13530413512602, 27.156352576005332,
+	27.177375457144443, 27.198372840543961, 27.219344787979168, 27.240291361001127,
+	27.261212620937727, 27.282108628894832, 27.302979445757273, 27.32382513218996,
+	27.344645748638932, 27.365441355332393, 27.386212012281788, 27.406957779282806,
+	27.427678715916414, 27.448374881549952, 27.469046335338042, 27.489693136223707,
+	27.510315342939293, 27.53091301400756, 27.551486207742578, 27.572034982250813,
+	27.592559395432048, 27.613059504980384, 27.633535368385218, 27.653987042932208,
+	27.67441458570422, 27.694818053582289, 27.715197503246593, 27.735552991177371,
+	27.755884573655891, 27.77619230676531, 27.796476246391713, 27.816736448224944,
+	27.836972967759593, 27.857185860295822, 27.877375180940376, 27.897540984607389,
+	27.91768332601935, 27.937802259707951, 27.957897840015008, 27.977970121093286,
+	27.998019156907446, 28.018045001234867, 28.038047707666529, 28.058027329607846,
+	28.077983920279578, 28.097917532718625, 28.117828219778914, 28.137716034132197,
+	28.157581028268936, 28.177423254499104, 28.197242764953003, 28.217039611582116,
+	28.236813846159905, 28.256565520282621, 28.276294685370125, 28.296001392666668,
+	28.31568569324174, 28.335347637990793, 28.35498727763607, 28.374604662727421,
+	28.394199843643001, 28.413772870590144, 28.433323793606043, 28.452852662558591,
+	28.472359527147098, 28.491844436903065, 28.511307441190944, 28.530748589208883,
+	28.550167929989485, 28.569565512400501, 28.588941385145638, 28.608295596765252,
+	28.62762819563708, 28.646939229976958, 28.66622874783959, 28.685496797119193,
+	28.704743425550269, 28.723968680708289, 28.743172610010397, 28.762355260716127,
+	28.781516679928075, 28.800656914592636, 28.81977601150065, 28.838874017288092,
+	28.857950978436804, 28.877006941275113, 28.896041951978532, 28.915056056570435,
+	28.934049300922723, 28.95302173075649, 28.971973391642663, 28.990904329002682,
+	29.009814588109151, 29.028704214086481, 29.047573251911523, 29.066421746414235,
+	29.085249742278329, 29.104057284041858, 29.122844416097877, 29.141611182695115,
+	29.160357627938517, 29.179083795789921, 29.197789730068664, 29.216475474452196,
+	29.235141072476694, 29.253786567537659, 29.272412002890547, 29.291017421651347,
+	29.309602866797192, 29.328168381166932, 29.34671400746177, 29.365239788245816,
+	29.383745765946678, 29.402231982856065, 29.420698481130344, 29.439145302791118,
+	29.457572489725827, 29.475980083688263, 29.494368126299221, 29.512736659046986,
+	29.531085723287923, 29.549415360247039, 29.567725611018574, 29.586016516566445,
+	29.604288117724934, 29.622540455199143, 29.640773569565546, 29.658987501272584,
+	29.677182290641149, 29.695357977865129, 29.713514603011966, 29.731652206023156,
+	29.749770826714808, 29.767870504778131, 29.785951279779987, 29.804013191163392,
+	29.822056278248048, 29.840080580230833, 29.85808613618633, 29.876072985067339,
+	29.894041165705367, 29.91199071681114, 29.929921676975098, 29.947834084667917,
+	29.965727978240956, 29.983603395926799, 30.001460375839699, 30.019298955976133,
+	30.037119174215199, 30.05492106831916, 30.072704675933934, 30.090470034589501,
+	30.108217181700461, 30.125946154566449, 30.143656990372634, 30.161349726190167,
+	30.179024398976672, 30.196681045576689, 30.214319702722143, 30.231940407032795,
+	30.249543195016706, 30.267128103070689, 30.284695167480763, 30.302244424422597,
+	30.319775909961955, 30.337289660055156, 30.354785710549486, 30.372264097183688,
+	30.389724855588327, 30.40716802128631, 30.424593629693263, 30.442001716117957,
+	30.459392315762798, 30.476765463724178, 30.494121194992957, 30.511459544454851,
+	30.528780546890872, 30.546084236977748, 30.563370649288331, 30.580639818291992,
+	30.597891778355091, 30.615126563741313, 30.632344208612153, 30.649544747027242,
+	30.666728212944825, 30.683894640222107, 30.701044062615708, 30.718176513781998,
+	30.735292027277545, 30.752390636559483, 30.769472374985909, 30.786537275816286,
+	30.80358537221182, 30.820616697235828, 30.837631283854165, 30.854629164935588,
+	30.871610373252125, 30.88857494147944, 30.905522902197283, 30.922454287889764,
+},
+{
+	-HUGE_VAL, -77.060630869054165, -65.060630869054165, -58.041080860400299,
+	-53.060630869054165, -49.197493730405824, -46.041080860400299, -43.372371804362928,
+	-41.060630869054165, -39.021530851746434, -37.197493730405824, -35.547451445406608,
+	-34.041080860400299, -32.655354251361061, -31.372371804362928, -30.177943721751959,
+	-29.060630869054165, -28.01107677405011, -27.021530851746434, -26.085500707731143,
+	-25.197493730405824, -24.352821795709048, -23.547451445406608, -22.777887396370019,
+	-22.041080860400299, -21.334356591757484, -20.655354251361075, -20.001980843092554,
+	-19.372371804362928, -18.764858927523306, -18.177943721751944, -17.610275144411673,
+	-17.060630869054165, -16.527901436752728, -16.01107677405011, -15.509234665714573,
+	-15.021530851746434, -14.547190481506775, -14.085500707731143, -13.635804242707195,
+	-13.197493730405824, -12.770006813637167, -12.352821795709048, -11.945453812628998,
+	-11.547451445406608, -11.158393713098079, -10.777887396370019, -10.405564648922521,
+	-10.041080860400299, -9.6841127396716757, -9.3343565917574836, -8.9915267653962303,
+	-8.6553542513610751, -8.3255854142957872, -8.0019808430925536, -7.6843143067582673,
+	-7.3723718043629276, -7.0659506990772769, -6.7648589275233064, -6.46891427671207,
+	-6.1779437217519444, -5.8917828182995464, -5.6102751444116734, -5.3332717870551818,
+	-5.0606308690541653, -4.79221711271272, -4.5279014367527282, -4.2675605835609076,
+	-4.0110767740501103, -3.7583373877161392, -3.5092346657145725, -3.2636654349979892,
+	-3.0215308517464337, -2.7827361624939613, -2.5471904815067745, -2.3148065831036035,
+	-2.0855007077311427, -1.8591923807153563, -1.635804242707195, -1.4152618909289316,
+	-1.1974937304058244, -0.98243083443867363, -0.77000681363716694, -0.56015769289108164,
+	-0.35282179570904759, -0.14793963540175525, 0.054546187371002475, 0.25469108113055938,
+	0.45254855459339183, 0.64817030254259578, 0.84160628690192141, 1.032904813330191,
+	1.2221126036299808, 1.4092748642422066, 1.5944353510774789, 1.7776364309171981,
+	1.9589191395997005, 2.1383232371913579, 2.3158872603283243, 2.4916485719011376,
+	2.6656434082425164, 2.8379069239673669, 3.0084732346037697, 3.1773754571444499,
+	3.3446457486389249, 3.5103153429392933, 3.6744145857042128, 3.8369729677595785,
+	3.9980191569074464, 4.1575810282689361, 4.3156856932417327, 4.4723595271471055,
+	4.6276281956370724, 4.7815166799280746, 4.9340493009227231, 5.0852497422783216,
+	5.2351410724766936, 5.383745765946685, 5.53108572328793, 5.6771822906411558,
+	5.8220562782480556, 5.9657279782409631, 6.1082171817004536, 6.249543195016706,
+	6.3897248555883266, 6.5287805468908715, 6.6667282129448182, 6.8035853722118134,
+	6.9393691309458276, 7.0740961960248754, 7.20778288728728, 7.3404451493952294,
+	7.4720985632472718, 7.6027583569601092, 7.7324394164390924, 7.8611562955558014,
+	7.9889232259498968, 8.1157541264721402, 8.2416626122838608, 8.3666620036279227,
+	8.4907653342854275, 8.6139853597313518, 8.7363345650020108, 8.8578251722864962,
+	8.9784691482535735, 9.0982782111250415, 9.2172638375060387, 9.3354372689822043,
+	9.4528095184932255, 9.5693913764917653, 9.6851934168963965, 9.8002260028467703,
+	9.9144992922688502, 10.028023243257643, 10.140807619284644, 10.252861994236682,
+	10.364195757292805, 10.474818117645356, 10.584738109071068, 10.693964594358093,
+	10.802506269594168, 10.910371668321233, 11.017569165561319, 11.124106981718754,
+	11.229993186362833, 11.33523570189562, 11.439842307108918, 11.543820640634451,
+	11.647178204290945, 11.749922366332044, 11.852060364598245, 11.953599309576596,
+	12.054546187371002, 12.154907862586526, 12.254691081130559, 12.353902472933775,
+	12.452548554593392, 12.550635731941796, 12.648170302542596, 12.745158458116904,
+	12.841606286901921, 12.937519775944295, 13.032904813330184, 13.127767190354334,
+	13.222112603629981, 13.315946657141566, 13.409274864242199, 13.502102649597461,
+	13.594435351077479, 13.686278221598698, 13.777636430917198, 13.868515067374815,
+	13.958919139599701, 14.048853578162785, 14.138323237191358, 14.227332895941153,
+	14.315887260328324, 14.403990964422348, 14.491648571901138, 14.578864577469616,
+	14.665643408242516, 14.751989425092965, 14.837906923967367, 14.923400137167945,
+	15.00847323460377, 15.093130325011174, 15.17737545714445, 15.261212620937727,
+	15.344645748638925, 15.427678715916414, 15.510315342939293, 15.592559395432048,
+	15.674414585704213, 15.755884573655891, 15.836972967759586, 15.917683326019343,
+	15.998019156907446, 16.077983920279578, 16.157581028268936, 16.236813846159912,
+	16.315685693241733, 16.394199843643008, 16.472359527147105, 16.550167929989485,
+	16.627628195637072, 16.704743425550276, 16.781516679928082, 16.857950978436804,
+	16.934049300922723, 17.009814588109151, 17.085249742278322, 17.160357627938509,
+	17.235141072476694, 17.309602866797185, 17.383745765946685, 17.45757248972582,
+	17.53108572328793, 17.604288117724934, 17.677182290641156, 17.749770826714808,
+	17.822056278248056, 17.89404116570536, 17.965727978240963, 18.037119174215192,
+	18.108217181700454, 18.179024398976665, 18.249543195016706, 18.319775909961962,
+	18.389724855588327, 18.459392315762798, 18.528780546890872, 18.597891778355091,
+	18.666728212944818, 18.735292027277552, 18.803585372211813, 18.871610373252125,
+	18.939369130945828, 19.006863721272367, 19.074096196024875, 19.141068583184477,
+	19.20778288728728, 19.274241089784439, 19.340445149395229, 19.406397002453453,
+	19.472098563247272, 19.537551724352568, 19.602758356960109, 19.667720311196476,
+	19.732439416439092, 19.796917481625314, 19.861156295555801, 19.925157627192291,
+	19.988923225949897, 20.052454821984057, 20.11575412647214, 20.178822831890088,
+	20.241662612283861, 20.304275123536087, 20.366662003627923, 20.428824872896072,
+	20.490765334285427, 20.552484973596933, 20.613985359731352, 20.675268044928416,
+	20.736334565002011, 20.797186439571078, 20.857825172286496, 20.918252251054078,
+	20.978469148253573, 21.038477320953973, 21.098278211125042, 21.157873245845231,
+	21.217263837506032, 21.276451384012802, 21.335437268982204, 21.394222861936271,
+	21.452809518493225, 21.511198580555018, 21.569391376491765, 21.627389221323085,
+	21.685193416896396, 21.742805252062254, 21.80022600284677, 21.857456932621233,
+	21.91449929226885, 21.971354320348809, 22.02802324325765, 22.084507275387978,
+	22.140807619284644, 22.196925465798316, 22.252861994236682, 22.308618372513052,
+	22.364195757292805, 22.419595294137245, 22.474818117645356, 22.529865351593173,
+	22.584738109071061, 22.639437492618711, 22.693964594358093, 22.748320496124258,
+	22.802506269594176, 22.856522976413466, 22.910371668321233, 22.964053387272926,
+	23.017569165561319, 23.070920025935628, 23.124106981718754, 23.177131036922816,
+	23.229993186362826, 23.282694415768724, 23.335235701895613, 23.387618012632437,
+	23.439842307108918, 23.491909535800971, 23.543820640634451, 23.595576555087447,
+	23.647178204290952, 23.698626505128125, 23.749922366332044, 23.801066688581955,
+	23.852060364598245, 23.902904279235898, 23.953599309576596, 24.004146325019576,
+	24.054546187370995, 24.104799750932202, 24.154907862586526, 24.204871361884962,
+	24.254691081130559, 24.304367845461655, 24.353902472933768, 24.403295774600558,
+	24.452548554593392, 24.501661610199989, 24.550635731941796, 24.599471703650352,
+	24.648170302542596, 24.696732299295022, 24.745158458116904, 24.793449536822443,
+	24.841606286901921, 24.88962945359188, 24.937519775944288, 24.985277986894836,
+	25.032904813330177, 25.08040097615438, 25.127767190354334, 25.175004165064379,
+	25.222112603629981, 25.269093203670579, 25.315946657141566, 25.362673650395465,
+	25.409274864242199, 25.45575097400868, 25.502102649597461, 25.548330555544744,
+	25.594435351077472, 25.640417690169798, 25.686278221598698, 25.732017588998929,
+	25.777636430917198, 25.823135380865693, 25.868515067374815, 25.913776114045312,
+	25.958919139599701, 26.003944757932992, 26.048853578162792, 26.093646204678748,
+	26.138323237191358, 26.182885270780133, 26.227332895941153, 26.27166669863405,
+	26.315887260328324, 26.359995158049102, 26.403990964422341, 26.447875247719409,
+	26.491648571901138, 26.535311496661322, 26.578864577469616, 26.622308365613975,
+	26.665643408242516, 26.708870248404871, 26.751989425092972, 26.795001473281431,
+	26.837906923967367, 26.880706304209667, 26.923400137167938, 26.96598894214079,
+	27.00847323460377, 27.050853526246811, 27.093130325011181, 27.13530413512602,
+	27.177375457144443, 27.219344787979168, 27.261212620937727, 27.302979445757273,
+	27.344645748638932, 27.386212012281788, 27.427678715916414, 27.469046335338042,
+	27.510315342939293, 27.551486207742578, 27.592559395432048, 27.633535368385218,
+	27.67441458570422, 27.715197503246593, 27.755884573655891, 27.796476246391713,
+	27.836972967759593, 27.877375180940376, 27.91768332601935, 27.957897840015008,
+	27.998019156907446, 28.038047707666529, 28.077983920279578, 28.117828219778914,
+	28.157581028268936, 28.197242764953003, 28.236813846159905, 28.276294685370125,
+	28.31568569324174, 28.35498727763607, 28.394199843643001, 28.433323793606043,
+	28.472359527147098, 28.511307441190944, 28.550167929989485, 28.588941385145638,
+	28.62762819563708, 28.66622874783959, 28.704743425550269, 28.743172610010397,
+	28.781516679928075, 28.81977601150065, 28.857950978436804, 28.896041951978532,
+	28.934049300922723, 28.971973391642663, 29.009814588109151, 29.047573251911523,
+	29.085249742278329, 29.122844416097877, 29.160357627938517, 29.197789730068664,
+	29.235141072476694, 29.272412002890547, 29.309602866797192, 29.34671400746177,
+	29.383745765946678, 29.420698481130344, 29.457572489725827, 29.494368126299221,
+	29.531085723287923, 29.567725611018574, 29.604288117724934, 29.640773569565546,
+	29.677182290641149, 29.713514603011966, 29.749770826714808, 29.785951279779987,
+	29.822056278248048, 29.85808613618633, 29.894041165705367, 29.929921676975098,
+	29.965727978240956, 30.001460375839699, 30.037119174215199, 30.072704675933934,
+	30.108217181700461, 30.143656990372634, 30.179024398976672, 30.214319702722143,
+	30.249543195016706, 30.284695167480763, 30.319775909961955, 30.354785710549486,
+	30.389724855588327, 30.424593629693263, 30.459392315762798, 30.494121194992957,
+	30.528780546890872, 30.563370649288331, 30.597891778355091, 30.632344208612153,
+	30.666728212944825, 30.701044062615708, 30.735292027277545, 30.769472374985909,
+	30.80358537221182, 30.837631283854165, 30.871610373252125, 30.905522902197283,
+	30.939369130945828, 30.973149318230476, 31.006863721272367, 31.040512595792798,
+	31.074096196024875, 31.107614774725043, 31.141068583184477, 31.174457871240392,
+	31.20778288728728, 31.241043878287925, 31.274241089784439, 31.307374765909117,
+	31.340445149395229, 31.373452481587648, 31.406397002453453, 31.439278950592403,
+	31.472098563247272, 31.504856076314134, 31.537551724352568, 31.570185740595669,
+	31.602758356960102, 31.635269804055937, 31.667720311196476, 31.700110106407934,
+	31.732439416439099, 31.764708466770777, 31.796917481625314, 31.829066683975888,
+	31.861156295555801, 31.893186536867603, 31.925157627192284, 31.957069784598161,
+	31.988923225949897, 32.020718166917291, 32.052454821984057, 32.084133404456509,
+	32.11575412647214, 32.147317199008207, 32.178822831890088, 32.210271233799716,
+	32.241662612283854, 32.272997173762306, 32.304275123536087, 32.335496665795446,
+	32.366662003627916, 32.397771339026207, 32.42882487289608, 32.459822805064107,
+	32.490765334285427, 32.521652658251341, 32.552484973596933, 32.583262475908583,
+	32.613985359731345, 32.64465381857643, 32.675268044928409, 32.705828230252578,
+	32.736334565002011, 32.766787238624808, 32.797186439571078, 32.827532355299937,
+	32.857825172286496, 32.888065076028681, 32.918252251054078, 32.948386880926677,
+	32.978469148253573, 33.00849923469162, 33.038477320953973, 33.068403586816665,
+	33.098278211125042, 33.12810137180017, 33.157873245845231, 33.187594009351784,
+	33.217263837506032, 33.246882904595026, 33.276451384012802, 33.305969448266453,
+	33.335437268982204, 33.364855016911356, 33.394222861936271, 33.423540973076214,
+	33.452809518493225, 33.482028665497864, 33.511198580555018, 33.540319429289497,
+	33.569391376491765, 33.598414586123482, 33.627389221323085, 33.656315444411256,
+	33.685193416896396, 33.714023299480047, 33.742805252062254, 33.771539433746845,
+	33.80022600284677, 33.828865116889311, 33.857456932621233, 33.886001606014013,
+	33.91449929226885, 33.942950145821811, 33.971354320348809, 33.999711968770583,
+	34.02802324325765, 34.056288295235206, 34.084507275387978, 34.112680333665054,
+	34.140807619284644, 34.168889280738846, 34.196925465798316, 34.224916321517,
+	34.252861994236682, 34.280762629591607, 34.308618372513052, 34.336429367233848,
+	34.364195757292805, 34.391917685539219, 34.419595294137245, 34.447228724570294,
+	34.474818117645356, 34.502363613497295, 34.529865351593173, 34.557323470736414,
+	34.584738109071061, 34.612109404085921, 34.639437492618711, 34.666722510860168,
+	34.693964594358093, 34.721163878021429, 34.748320496124258, 34.775434582309757,
+	34.802506269594176, 34.829535690370719, 34.856522976413466, 34.883468258881194,
+	34.910371668321233, 34.937233334673223, 34.964053387272926, 34.990831954855913,
+	35.017569165561319, 35.044265146935487, 35.070920025935628, 35.097533928933451,
+	35.124106981718754, 35.150639309502992, 35.177131036922816, 35.203582288043577,
+	35.229993186362826, 35.256363854813777, 35.282694415768724, 35.308984991042443,
+	35.335235701895613, 35.361446669038131, 35.387618012632437, 35.413749852296874,
+	35.439842307108918, 35.46589549560845, 35.491909535800971, 35.517884545160847,
+	35.543820640634451, 35.569717938643358, 35.595576555087447, 35.621396605348032,
+	35.647178204290952, 35.672921466269628, 35.698626505128125, 35.724293434204142,
+	35.749922366332044, 35.775513413845786, 35.801066688581955, 35.82658230188261,
+	35.852060364598245, 35.877500987090684, 35.902904279235898, 35.928270350426914,
+	35.953599309576596, 35.978891265120495, 36.004146325019576, 36.029364596763031,
+	36.054546187370995, 36.079691203397317, 36.104799750932202, 36.129871935604932,
+	36.154907862586526, 36.17990763659239, 36.204871361884962, 36.229799142276264,
+	36.254691081130559, 36.279547281366902, 36.304367845461655, 36.329152875451065,
+	36.353902472933768, 36.378616739073301, 36.403295774600558, 36.427939679816248,
+	36.452548554593392, 36.4771224983797, 36.501661610199989, 36.526165988658612,
+	36.550635731941796, 36.575070937820023, 36.599471703650352, 36.623838126378814,
+	36.648170302542596, 36.672468328272487, 36.696732299295022, 36.720962310934851,
+	36.745158458116904, 36.769320835368681, 36.793449536822443, 36.8175446562174,
+	36.841606286901921, 36.865634521835695, 36.88962945359188, 36.91359117435924,
+	36.937519775944288, 36.961415349773389, 36.985277986894836, 37.009107777980958,
+	37.032904813330177, 37.056669182869072, 37.08040097615438, 37.104100282375079,
+	37.127767190354334, 37.151401788551567, 37.175004165064379, 37.198574407630545,
+	37.222112603629981, 37.245618840086664, 37.269093203670579, 37.292535780699637,
+	37.315946657141566, 37.339325918615828, 37.362673650395465, 37.385989937408979,
+	37.409274864242199, 37.432528515140113, 37.45575097400868, 37.478942324416664,
+	37.502102649597461, 37.525232032450845, 37.548330555544744, 37.571398301117085,
+	37.594435351077472, 37.617441787008964, 37.640417690169798, 37.663363141495125,
+	37.686278221598698, 37.709163010774603, 37.732017588998929, 37.754842035931418,
+	37.777636430917198, 37.800400852988368, 37.823135380865693, 37.845840092960188,
+	37.868515067374815, 37.891160381905991, 37.913776114045312, 37.936362340981027,
+	37.958919139599701, 37.981446586487742, 38.003944757932992, 38.026413729926233,
+	38.048853578162792, 38.071264378043992, 38.093646204678748, 38.115999132885023,
+	38.138323237191358, 38.160618591838343, 38.182885270780133, 38.205123347685856,
+	38.227332895941153, 38.249513988649575, 38.27166669863405, 38.293791098438312,
+	38.315887260328324, 38.337955256293696, 38.359995158049102, 38.382007037035663,
+	38.403990964422341, 38.425947011107333, 38.447875247719409, 38.469775744619326,
+	38.491648571901138, 38.513493799393572, 38.535311496661322, 38.557101733006434,
+	38.578864577469616, 38.600600098831485, 38.622308365613975, 38.643989446081548,
+	38.665643408242516, 38.687270319850349, 38.708870248404871, 38.730443261153603,
+	38.751989425092972, 38.773508806969573, 38.795001473281431, 38.816467490279194,
+	38.837906923967367, 38.859319840105556, 38.880706304209667, 38.902066381553098,
+	38.923400137167938, 38.944707635846157, 38.96598894214079, 38.987244120367109,
+	39.00847323460377, 39.029676348694025, 39.050853526246811, 39.07200483063793,
+	39.093130325011181, 39.114230072279483, 39.13530413512602, 39.156352576005332,
+	39.177375457144443, 39.198372840543961, 39.219344787979168, 39.240291361001127,
+	39.261212620937727, 39.282108628894832, 39.302979445757273, 39.32382513218996,
+	39.344645748638932, 39.365441355332393, 39.386212012281788, 39.406957779282806,
+	39.427678715916414, 39.448374881549952, 39.469046335338042, 39.489693136223707,
+	39.510315342939293, 39.53091301400756, 39.551486207742578, 39.572034982250813,
+	39.592559395432048, 39.613059504980384, 39.633535368385218, 39.653987042932208,
+	39.67441458570422, 39.694818053582289, 39.715197503246593, 39.735552991177371,
+	39.755884573655891, 39.77619230676531, 39.796476246391713, 39.816736448224944,
+	39.836972967759593, 39.857185860295822, 39.877375180940376, 39.897540984607389,
+	39.91768332601935, 39.937802259707951, 39.957897840015008, 39.977970121093286,
+	39.998019156907446, 40.018045001234867, 40.038047707666529, 40.058027329607846,
+	40.077983920279578, 40.097917532718625, 40.117828219778914, 40.137716034132197,
+	40.157581028268936, 40.177423254499104, 40.197242764953003, 40.217039611582116,
+	40.236813846159905, 40.256565520282621, 40.276294685370125, 40.296001392666668,
+	40.31568569324174, 40.335347637990793, 40.35498727763607, 40.374604662727421,
+	40.394199843643001, 40.413772870590144, 40.433323793606043, 40.452852662558591,
+	40.472359527147098, 40.491844436903065, 40.511307441190944, 40.530748589208883,
+	40.550167929989485, 40.569565512400501, 40.588941385145638, 40.608295596765252,
+	40.62762819563708, 40.646939229976958, 40.66622874783959, 40.685496797119193,
+	40.704743425550269, 40.723968680708289, 40.743172610010397, 40.762355260716127,
+	40.781516679928075, 40.800656914592636, 40.81977601150065, 40.838874017288092,
+	40.857950978436804, 40.877006941275113, 40.896041951978532, 40.915056056570435,
+	40.934049300922723, 40.95302173075649, 40.971973391642663, 40.990904329002682,
+	41.009814588109151, 41.028704214086481, 41.047573251911523, 41.066421746414235,
+	41.085249742278329, 41.104057284041858, 41.122844416097877, 41.141611182695115,
+	41.160357627938517, 41.179083795789921, 41.197789730068664, 41.216475474452196,
+	41.235141072476694, 41.253786567537659, 41.272412002890547, 41.291017421651347,
+	41.309602866797192, 41.328168381166932, 41.34671400746177, 41.365239788245816,
+	41.383745765946678, 41.402231982856065, 41.420698481130344, 41.439145302791118,
+	41.457572489725827, 41.475980083688263, 41.494368126299221, 41.512736659046986,
+	41.531085723287923, 41.549415360247039, 41.567725611018574, 41.586016516566445,
+	41.604288117724934, 41.622540455199143, 41.640773569565546, 41.658987501272584,
+	41.677182290641149, 41.695357977865129, 41.713514603011966, 41.731652206023156,
+	41.749770826714808, 41.767870504778131, 41.785951279779987, 41.804013191163392,
+	41.822056278248048, 41.840080580230833, 41.85808613618633, 41.876072985067339,
+	41.894041165705367, 41.91199071681114, 41.929921676975098, 41.947834084667917,
+	41.965727978240956, 41.983603395926799, 42.001460375839699, 42.019298955976133,
+	42.037119174215199, 42.05492106831916, 42.072704675933934, 42.090470034589501,
+	42.108217181700461, 42.125946154566449, 42.143656990372634, 42.161349726190167,
+	42.179024398976672, 42.196681045576689, 42.214319702722143, 42.231940407032795,
+	42.249543195016706, 42.267128103070689, 42.284695167480763, 42.302244424422597,
+	42.319775909961955, 42.337289660055156, 42.354785710549486, 42.372264097183688,
+	42.389724855588327, 42.40716802128631, 42.424593629693263, 42.442001716117957,
+	42.459392315762798, 42.476765463724178, 42.494121194992957, 42.511459544454851,
+	42.528780546890872, 42.546084236977748, 42.563370649288331, 42.580639818291992,
+	42.597891778355091, 42.615126563741313, 42.632344208612153, 42.649544747027242,
+	42.666728212944825, 42.683894640222107, 42.701044062615708, 42.718176513781998,
+	42.735292027277545, 42.752390636559483, 42.769472374985909, 42.786537275816286,
+	42.80358537221182, 42.820616697235828, 42.837631283854165, 42.854629164935588,
+	42.871610373252125, 42.88857494147944, 42.905522902197283, 42.922454287889764,
+},
+{
+	-HUGE_VAL, -65.060630869054165, -53.060630869054165, -46.041080860400299,
+	-41.060630869054165, -37.197493730405824, -34.041080860400299, -31.372371804362928,
+	-29.060630869054165, -27.021530851746434, -25.197493730405824, -23.547451445406608,
+	-22.041080860400299, -20.655354251361075, -19.372371804362928, -18.177943721751944,
+	-17.060630869054165, -16.01107677405011, -15.021530851746434, -14.085500707731143,
+	-13.197493730405824, -12.352821795709048, -11.547451445406608, -10.777887396370019,
+	-10.041080860400299, -9.3343565917574836, -8.6553542513610751, -8.0019808430925536,
+	-7.3723718043629276, -6.7648589275233064, -6.1779437217519444, -5.6102751444116734,
+	-5.0606308690541653, -4.5279014367527282, -4.0110767740501103, -3.5092346657145725,
+	-3.0215308517464337, -2.5471904815067745, -2.0855007077311427, -1.635804242707195,
+	-1.1974937304058244, -0.77000681363716694, -0.35282179570904759, 0.054546187371002475,
+	0.45254855459339183, 0.84160628690192141, 1.2221126036299808, 1.5944353510774789,
+	1.9589191395997005, 2.3158872603283243, 2.6656434082425164, 3.0084732346037697,
+	3.3446457486389249, 3.6744145857042128, 3.9980191569074464, 4.3156856932417327,
+	4.6276281956370724, 4.9340493009227231, 5.2351410724766936, 5.53108572328793,
+	5.8220562782480556, 6.1082171817004536, 6.3897248555883266, 6.6667282129448182,
+	6.9393691309458276, 7.20778288728728, 7.4720985632472718, 7.7324394164390924,
+	7.9889232259498968, 8.2416626122838608, 8.4907653342854275, 8.7363345650020108,
+	8.9784691482535735, 9.2172638375060387, 9.4528095184932255, 9.6851934168963965,
+	9.9144992922688502, 10.140807619284644, 10.364195757292805, 10.584738109071068,
+	10.802506269594168, 11.017569165561319, 11.229993186362833, 11.439842307108918,
+	11.647178204290945, 11.852060364598245, 12.054546187371002, 12.254691081130559,
+	12.452548554593392, 12.648170302542596, 12.841606286901921, 13.032904813330184,
+	13.222112603629981, 13.409274864242199, 13.594435351077479, 13.777636430917198,
+	13.958919139599701, 14.138323237191358, 14.315887260328324, 14.491648571901138,
+	14.665643408242516, 14.837906923967367, 15.00847323460377, 15.17737545714445,
+	15.344645748638925, 15.510315342939293, 15.674414585704213, 15.836972967759586,
+	15.998019156907446, 16.157581028268936, 16.315685693241733, 16.472359527147105,
+	16.627628195637072, 16.781516679928082, 16.934049300922723, 17.085249742278322,
+	17.235141072476694, 17.383745765946685, 17.53108572328793, 17.677182290641156,
+	17.822056278248056, 17.965727978240963, 18.108217181700454, 18.249543195016706,
+	18.389724855588327, 18.528780546890872, 18.666728212944818, 18.803585372211813,
+	18.939369130945828, 19.074096196024875, 19.20778288728728, 19.340445149395229,
+	19.472098563247272, 19.602758356960109, 19.732439416439092, 19.861156295555801,
+	19.988923225949897, 20.11575412647214, 20.241662612283861, 20.366662003627923,
+	20.490765334285427, 20.613985359731352, 20.736334565002011, 20.857825172286496,
+	20.978469148253573, 21.098278211125042, 21.217263837506032, 21.335437268982204,
+	21.452809518493225, 21.569391376491765, 21.685193416896396, 21.80022600284677,
+	21.91449929226885, 22.02802324325765, 22.140807619284644, 22.252861994236682,
+	22.364195757292805, 22.474818117645356, 22.584738109071061, 22.693964594358093,
+	22.802506269594176, 22.910371668321233, 23.017569165561319, 23.124106981718754,
+	23.229993186362826, 23.335235701895613, 23.439842307108918, 23.543820640634451,
+	23.647178204290952, 23.749922366332044, 23.852060364598245, 23.953599309576596,
+	24.054546187370995, 24.154907862586526, 24.254691081130559, 24.353902472933768,
+	24.452548554593392, 24.550635731941796, 24.648170302542596, 24.745158458116904,
+	24.841606286901921, 24.937519775944288, 25.032904813330177, 25.127767190354334,
+	25.222112603629981, 25.315946657141566, 25.409274864242199, 25.502102649597461,
+	25.594435351077472, 25.686278221598698, 25.777636430917198, 25.868515067374815,
+	25.958919139599701, 26.048853578162792, 26.138323237191358, 26.227332895941153,
+	26.315887260328324, 26.403990964422341, 26.491648571901138, 26.578864577469616,
+	26.665643408242516, 26.751989425092972, 26.837906923967367, 26.923400137167938,
+	27.00847323460377, 27.093130325011181, 27.177375457144443, 27.261212620937727,
+	27.344645748638932, 27.427678715916414, 27.510315342939293, 27.592559395432048,
+	27.67441458570422, 27.755884573655891, 27.836972967759593, 27.91768332601935,
+	27.998019156907446, 28.077983920279578, 28.157581028268936, 28.236813846159905,
+	28.31568569324174, 28.394199843643001, 28.472359527147098, 28.550167929989485,
+	28.62762819563708, 28.704743425550269, 28.781516679928075, 28.857950978436804,
+	28.934049300922723, 29.009814588109151, 29.085249742278329, 29.160357627938517,
+	29.235141072476694, 29.309602866797192, 29.383745765946678, 29.457572489725827,
+	29.531085723287923, 29.604288117724934, 29.677182290641149, 29.749770826714808,
+	29.822056278248048, 29.894041165705367, 29.965727978240956, 30.037119174215199,
+	30.108217181700461, 30.179024398976672, 30.249543195016706, 30.319775909961955,
+	30.389724855588327, 30.459392315762798, 30.528780546890872, 30.597891778355091,
+	30.666728212944825, 30.735292027277545, 30.80358537221182, 30.871610373252125,
+	30.939369130945828, 31.006863721272367, 31.074096196024875, 31.141068583184477,
+	31.20778288728728, 31.274241089784439, 31.340445149395229, 31.406397002453453,
+	31.472098563247272, 31.537551724352568, 31.602758356960102, 31.667720311196476,
+	31.732439416439099, 31.796917481625314, 31.861156295555801, 31.925157627192284,
+	31.988923225949897, 32.052454821984057, 32.11575412647214, 32.178822831890088,
+	32.241662612283854, 32.304275123536087, 32.366662003627916, 32.42882487289608,
+	32.490765334285427, 32.552484973596933, 32.613985359731345, 32.675268044928409,
+	32.736334565002011, 32.797186439571078, 32.857825172286496, 32.918252251054078,
+	32.978469148253573, 33.038477320953973, 33.098278211125042, 33.157873245845231,
+	33.217263837506032, 33.276451384012802, 33.335437268982204, 33.394222861936271,
+	33.452809518493225, 33.511198580555018, 33.569391376491765, 33.627389221323085,
+	33.685193416896396, 33.742805252062254, 33.80022600284677, 33.857456932621233,
+	33.91449929226885, 33.971354320348809, 34.02802324325765, 34.084507275387978,
+	34.140807619284644, 34.196925465798316, 34.252861994236682, 34.308618372513052,
+	34.364195757292805, 34.419595294137245, 34.474818117645356, 34.529865351593173,
+	34.584738109071061, 34.639437492618711, 34.693964594358093, 34.748320496124258,
+	34.802506269594176, 34.856522976413466, 34.910371668321233, 34.964053387272926,
+	35.017569165561319, 35.070920025935628, 35.124106981718754, 35.177131036922816,
+	35.229993186362826, 35.282694415768724, 35.335235701895613, 35.387618012632437,
+	35.439842307108918, 35.491909535800971, 35.543820640634451, 35.595576555087447,
+	35.647178204290952, 35.698626505128125, 35.749922366332044, 35.801066688581955,
+	35.852060364598245, 35.902904279235898, 35.953599309576596, 36.004146325019576,
+	36.054546187370995, 36.104799750932202, 36.154907862586526, 36.204871361884962,
+	36.254691081130559, 36.304367845461655, 36.353902472933768, 36.403295774600558,
+	36.452548554593392, 36.501661610199989, 36.550635731941796, 36.599471703650352,
+	36.648170302542596, 36.696732299295022, 36.745158458116904, 36.793449536822443,
+	36.841606286901921, 36.88962945359188, 36.937519775944288, 36.985277986894836,
+	37.032904813330177, 37.08040097615438, 37.127767190354334, 37.175004165064379,
+	37.222112603629981, 37.269093203670579, 37.315946657141566, 37.362673650395465,
+	37.409274864242199, 37.45575097400868, 37.502102649597461, 37.548330555544744,
+	37.594435351077472, 37.640417690169798, 37.686278221598698, 37.732017588998929,
+	37.777636430917198, 37.823135380865693, 37.868515067374815, 37.913776114045312,
+	37.958919139599701, 38.003944757932992, 38.048853578162792, 38.093646204678748,
+	38.138323237191358, 38.182885270780133, 38.227332895941153, 38.27166669863405,
+	38.315887260328324, 38.359995158049102, 38.403990964422341, 38.447875247719409,
+	38.491648571901138, 38.535311496661322, 38.578864577469616, 38.622308365613975,
+	38.665643408242516, 38.708870248404871, 38.751989425092972, 38.795001473281431,
+	38.837906923967367, 38.880706304209667, 38.923400137167938, 38.96598894214079,
+	39.00847323460377, 39.050853526246811, 39.093130325011181, 39.13530413512602,
+	39.177375457144443, 39.219344787979168, 39.261212620937727, 39.302979445757273,
+	39.344645748638932, 39.386212012281788, 39.427678715916414, 39.469046335338042,
+	39.510315342939293, 39.551486207742578, 39.592559395432048, 39.633535368385218,
+	39.67441458570422, 39.715197503246593, 39.755884573655891, 39.796476246391713,
+	39.836972967759593, 39.877375180940376, 39.91768332601935, 39.957897840015008,
+	39.998019156907446, 40.038047707666529, 40.077983920279578, 40.117828219778914,
+	40.157581028268936, 40.197242764953003, 40.236813846159905, 40.276294685370125,
+	40.31568569324174, 40.35498727763607, 40.394199843643001, 40.433323793606043,
+	40.472359527147098, 40.511307441190944, 40.550167929989485, 40.588941385145638,
+	40.62762819563708, 40.66622874783959, 40.704743425550269, 40.743172610010397,
+	40.781516679928075, 40.81977601150065, 40.857950978436804, 40.896041951978532,
+	40.934049300922723, 40.971973391642663, 41.009814588109151, 41.047573251911523,
+	41.085249742278329, 41.122844416097877, 41.160357627938517, 41.197789730068664,
+	41.235141072476694, 41.272412002890547, 41.309602866797192, 41.34671400746177,
+	41.383745765946678, 41.420698481130344, 41.457572489725827, 41.494368126299221,
+	41.531085723287923, 41.567725611018574, 41.604288117724934, 41.640773569565546,
+	41.677182290641149, 41.713514603011966, 41.749770826714808, 41.785951279779987,
+	41.822056278248048, 41.85808613618633, 41.894041165705367, 41.929921676975098,
+	41.965727978240956, 42.001460375839699, 42.037119174215199, 42.072704675933934,
+	42.108217181700461, 42.143656990372634, 42.179024398976672, 42.214319702722143,
+	42.249543195016706, 42.284695167480763, 42.319775909961955, 42.354785710549486,
+	42.389724855588327, 42.424593629693263, 42.459392315762798, 42.494121194992957,
+	42.528780546890872, 42.563370649288331, 42.597891778355091, 42.632344208612153,
+	42.666728212944825, 42.701044062615708, 42.735292027277545, 42.769472374985909,
+	42.80358537221182, 42.837631283854165, 42.871610373252125, 42.905522902197283,
+	42.939369130945828, 42.973149318230476, 43.006863721272367, 43.040512595792798,
+	43.074096196024875, 43.107614774725043, 43.141068583184477, 43.174457871240392,
+	43.20778288728728, 43.241043878287925, 43.274241089784439, 43.307374765909117,
+	43.340445149395229, 43.373452481587648, 43.406397002453453, 43.439278950592403,
+	43.472098563247272, 43.504856076314134, 43.537551724352568, 43.570185740595669,
+	43.602758356960102, 43.635269804055937, 43.667720311196476, 43.700110106407934,
+	43.732439416439099, 43.764708466770777, 43.796917481625314, 43.829066683975888,
+	43.861156295555801, 43.893186536867603, 43.925157627192284, 43.957069784598161,
+	43.988923225949897, 44.020718166917291, 44.052454821984057, 44.084133404456509,
+	44.11575412647214, 44.147317199008207, 44.178822831890088, 44.210271233799716,
+	44.241662612283854, 44.272997173762306, 44.304275123536087, 44.335496665795446,
+	44.366662003627916, 44.397771339026207, 44.42882487289608, 44.459822805064107,
+	44.490765334285427, 44.521652658251341, 44.552484973596933, 44.583262475908583,
+	44.613985359731345, 44.64465381857643, 44.675268044928409, 44.705828230252578,
+	44.736334565002011, 44.766787238624808, 44.797186439571078, 44.827532355299937,
+	44.857825172286496, 44.888065076028681, 44.918252251054078, 44.948386880926677,
+	44.978469148253573, 45.00849923469162, 45.038477320953973, 45.068403586816665,
+	45.098278211125034, 45.12810137180017, 45.157873245845231, 45.187594009351784,
+	45.217263837506032, 45.246882904595026, 45.276451384012802, 45.305969448266453,
+	45.335437268982204, 45.364855016911349, 45.394222861936271, 45.423540973076214,
+	45.452809518493225, 45.482028665497864, 45.511198580555018, 45.540319429289497,
+	45.569391376491765, 45.598414586123482, 45.627389221323085, 45.656315444411256,
+	45.685193416896396, 45.714023299480047, 45.742805252062254, 45.771539433746845,
+	45.80022600284677, 45.828865116889304, 45.85745693262124, 45.886001606014005,
+	45.91449929226885, 45.942950145821811, 45.971354320348809, 45.999711968770583,
+	46.02802324325765, 46.056288295235206, 46.084507275387978, 46.112680333665054,
+	46.140807619284644, 46.168889280738838, 46.196925465798316, 46.224916321517,
+	46.252861994236675, 46.280762629591607, 46.308618372513052, 46.336429367233848,
+	46.364195757292805, 46.391917685539219, 46.419595294137245, 46.447228724570294,
+	46.474818117645349, 46.502363613497295, 46.529865351593173, 46.557323470736414,
+	46.584738109071061, 46.612109404085921, 46.639437492618711, 46.666722510860168,
+	46.693964594358093, 46.721163878021429, 46.748320496124258, 46.775434582309757,
+	46.802506269594176, 46.829535690370719, 46.856522976413466, 46.883468258881194,
+	46.910371668321233, 46.937233334673223, 46.964053387272926, 46.990831954855921,
+	47.017569165561326, 47.044265146935487, 47.070920025935628, 47.097533928933451,
+	47.124106981718754, 47.150639309502992, 47.177131036922816, 47.203582288043577,
+	47.229993186362833, 47.256363854813785, 47.282694415768724, 47.30898499104245,
+	47.335235701895613, 47.361446669038131, 47.387618012632437, 47.413749852296874,
+	47.439842307108918, 47.46589549560845, 47.491909535800971, 47.51788454516084,
+	47.543820640634451, 47.569717938643358, 47.59557655508744, 47.621396605348025,
+	47.647178204290952, 47.672921466269628, 47.698626505128125, 47.724293434204142,
+	47.749922366332036, 47.775513413845786, 47.801066688581955, 47.82658230188261,
+	47.852060364598245, 47.877500987090677, 47.902904279235898, 47.928270350426914,
+	47.953599309576603, 47.978891265120495, 48.004146325019576, 48.029364596763031,
+	48.054546187371002, 48.079691203397317, 48.104799750932202, 48.129871935604925,
+	48.154907862586519, 48.17990763659239, 48.204871361884955, 48.229799142276264,
+	48.254691081130566, 48.279547281366902, 48.304367845461655, 48.329152875451058,
+	48.353902472933768, 48.378616739073301, 48.403295774600551, 48.427939679816248,
+	48.452548554593392, 48.4771224983797, 48.501661610199989, 48.526165988658612,
+	48.550635731941796, 48.575070937820016, 48.599471703650359, 48.623838126378807,
+	48.648170302542596, 48.672468328272487, 48.696732299295022, 48.720962310934851,
+	48.745158458116904, 48.769320835368681, 48.793449536822436, 48.8175446562174,
+	48.841606286901921, 48.865634521835695, 48.88962945359188, 48.91359117435924,
+	48.937519775944288, 48.961415349773389, 48.985277986894829, 49.009107777980958,
+	49.032904813330177, 49.056669182869072, 49.08040097615438, 49.104100282375072,
+	49.127767190354334, 49.151401788551567, 49.175004165064379, 49.198574407630545,
+	49.222112603629981, 49.245618840086664, 49.269093203670579, 49.292535780699637,
+	49.315946657141566, 49.339325918615828, 49.362673650395465, 49.385989937408979,
+	49.409274864242207, 49.432528515140113, 49.45575097400868, 49.478942324416671,
+	49.502102649597461, 49.525232032450837, 49.548330555544737, 49.571398301117085,
+	49.594435351077472, 49.617441787008964, 49.640417690169798, 49.663363141495118,
+	49.686278221598698, 49.709163010774603, 49.732017588998929, 49.754842035931418,
+	49.777636430917198, 49.800400852988368, 49.823135380865693, 49.845840092960188,
+	49.868515067374815, 49.891160381905991, 49.913776114045305, 49.936362340981027,
+	49.958919139599701, 49.981446586487742, 50.003944757932985, 50.026413729926233,
+	50.048853578162792, 50.071264378043992, 50.093646204678748, 50.115999132885023,
+	50.138323237191358, 50.160618591838343, 50.182885270780133, 50.205123347685856,
+	50.227332895941153, 50.249513988649575, 50.27166669863405, 50.293791098438312,
+	50.315887260328324, 50.337955256293696, 50.359995158049102, 50.382007037035663,
+	50.403990964422341, 50.425947011107326, 50.447875247719409, 50.469775744619326,
+	50.491648571901138, 50.513493799393572, 50.535311496661322, 50.557101733006434,
+	50.578864577469616, 50.600600098831485, 50.622308365613975, 50.643989446081548,
+	50.665643408242524, 50.687270319850349, 50.708870248404871, 50.730443261153596,
+	50.751989425092972, 50.773508806969573, 50.795001473281431, 50.816467490279194,
+	50.837906923967367, 50.859319840105556, 50.880706304209667, 50.902066381553098,
+	50.923400137167945, 50.944707635846157, 50.96598894214079, 50.987244120367109,
+	51.00847323460377, 51.029676348694025, 51.050853526246811, 51.07200483063793,
+	51.093130325011174, 51.114230072279483, 51.13530413512602, 51.156352576005332,
+	51.177375457144443, 51.198372840543968, 51.219344787979168, 51.24029136100112,
+	51.261212620937727, 51.282108628894832, 51.302979445757273, 51.32382513218996,
+	51.344645748638932, 51.365441355332393, 51.386212012281788, 51.406957779282799,
+	51.427678715916414, 51.448374881549952, 51.469046335338042, 51.489693136223707,
+	51.510315342939293, 51.53091301400756, 51.551486207742578, 51.572034982250813,
+	51.592559395432048, 51.613059504980384, 51.633535368385225, 51.653987042932208,
+	51.674414585704213, 51.694818053582281, 51.715197503246593, 51.735552991177379,
+	51.755884573655884, 51.77619230676531, 51.796476246391705, 51.816736448224944,
+	51.836972967759593, 51.857185860295822, 51.877375180940376, 51.897540984607389,
+	51.91768332601935, 51.937802259707951, 51.957897840015008, 51.977970121093286,
+	51.998019156907446, 52.018045001234867, 52.038047707666522, 52.058027329607846,
+	52.077983920279578, 52.097917532718625, 52.117828219778914, 52.137716034132197,
+	52.157581028268943, 52.177423254499104, 52.197242764953003, 52.217039611582123,
+	52.236813846159905, 52.256565520282621, 52.276294685370125, 52.296001392666675,
+	52.31568569324174, 52.335347637990793, 52.35498727763607, 52.374604662727421,
+	52.394199843643008, 52.413772870590144, 52.43332379360605, 52.452852662558591,
+	52.472359527147098, 52.491844436903065, 52.511307441190944, 52.530748589208891,
+	52.550167929989485, 52.569565512400501, 52.588941385145638, 52.608295596765252,
+	52.627628195637072, 52.646939229976958, 52.66622874783959, 52.685496797119193,
+	52.704743425550269, 52.723968680708289, 52.743172610010397, 52.762355260716127,
+	52.781516679928075, 52.800656914592636, 52.81977601150065, 52.838874017288092,
+	52.857950978436804, 52.877006941275113, 52.896041951978532, 52.915056056570435,
+	52.934049300922723, 52.95302173075649, 52.971973391642663, 52.990904329002682,
+	53.009814588109151, 53.028704214086481, 53.047573251911523, 53.066421746414235,
+	53.085249742278329, 53.104057284041858, 53.122844416097884, 53.141611182695115,
+	53.160357627938517, 53.179083795789921, 53.197789730068664, 53.216475474452196,
+	53.235141072476694, 53.253786567537659, 53.272412002890547, 53.291017421651347,
+	53.309602866797192, 53.328168381166932, 53.34671400746177, 53.365239788245816,
+	53.383745765946678, 53.402231982856065, 53.420698481130344, 53.439145302791118,
+	53.45757248972582, 53.47598008368827, 53.494368126299221, 53.512736659046986,
+	53.531085723287923, 53.549415360247046, 53.567725611018567, 53.586016516566445,
+	53.604288117724934, 53.622540455199136, 53.640773569565546, 53.658987501272591,
+	53.677182290641149, 53.695357977865129, 53.713514603011966, 53.731652206023156,
+	53.749770826714808, 53.767870504778131, 53.785951279779994, 53.804013191163392,
+	53.822056278248048, 53.840080580230833, 53.85808613618633, 53.876072985067339,
+	53.894041165705367, 53.91199071681114, 53.929921676975106, 53.947834084667917,
+	53.965727978240963, 53.983603395926799, 54.001460375839706, 54.019298955976133,
+	54.037119174215199, 54.05492106831916, 54.072704675933934, 54.090470034589501,
+	54.108217181700461, 54.125946154566449, 54.143656990372634, 54.161349726190167,
+	54.179024398976672, 54.196681045576689, 54.214319702722143, 54.231940407032795,
+	54.249543195016706, 54.267128103070689, 54.284695167480763, 54.302244424422597,
+	54.319775909961962, 54.337289660055156, 54.354785710549493, 54.372264097183688,
+	54.389724855588327, 54.40716802128631, 54.424593629693263, 54.442001716117957,
+	54.459392315762798, 54.476765463724178, 54.494121194992957, 54.511459544454851,
+	54.528780546890872, 54.546084236977748, 54.563370649288331, 54.580639818291992,
+	54.597891778355091, 54.615126563741313, 54.632344208612153, 54.649544747027242,
+	54.666728212944825, 54.683894640222114, 54.701044062615708, 54.718176513781998,
+	54.735292027277545, 54.752390636559483, 54.769472374985909, 54.786537275816286,
+	54.803585372211813, 54.820616697235828, 54.837631283854165, 54.854629164935588,
+	54.871610373252125, 54.888574941479447, 54.905522902197276, 54.922454287889771,
+},
+{
+	-HUGE_VAL, -53.060630869054165, -41.060630869054165, -34.041080860400299,
+	-29.060630869054165, -25.197493730405824, -22.041080860400299, -19.372371804362928,
+	-17.060630869054165, -15.021530851746434, -13.197493730405824, -11.547451445406608,
+	-10.041080860400299, -8.6553542513610751, -7.3723718043629276, -6.1779437217519444,
+	-5.0606308690541653, -4.0110767740501103, -3.0215308517464337, -2.0855007077311427,
+	-1.1974937304058244, -0.35282179570904759, 0.45254855459339183, 1.2221126036299808,
+	1.9589191395997005, 2.6656434082425164, 3.3446457486389249, 3.9980191569074464,
+	4.6276281956370724, 5.2351410724766936, 5.8220562782480556, 6.3897248555883266,
+	6.9393691309458276, 7.4720985632472718, 7.9889232259498968, 8.4907653342854275,
+	8.9784691482535735, 9.4528095184932255, 9.9144992922688502, 10.364195757292805,
+	10.802506269594168, 11.229993186362833, 11.647178204290945, 12.054546187371002,
+	12.452548554593392, 12.841606286901921, 13.222112603629981, 13.594435351077479,
+	13.958919139599701, 14.315887260328324, 14.665643408242516, 15.00847323460377,
+	15.344645748638925, 15.674414585704213, 15.998019156907446, 16.315685693241733,
+	16.627628195637072, 16.934049300922723, 17.235141072476694, 17.53108572328793,
+	17.822056278248056, 18.108217181700454, 18.389724855588327, 18.666728212944818,
+	18.939369130945828, 19.20778288728728, 19.472098563247272, 19.732439416439092,
+	19.988923225949897, 20.241662612283861, 20.490765334285427, 20.736334565002011,
+	20.978469148253573, 21.217263837506032, 21.452809518493225, 21.685193416896396,
+	21.91449929226885, 22.140807619284644, 22.364195757292805, 22.584738109071061,
+	22.802506269594176, 23.017569165561319, 23.229993186362826, 23.439842307108918,
+	23.647178204290952, 23.852060364598245, 24.054546187370995, 24.254691081130559,
+	24.452548554593392, 24.648170302542596, 24.841606286901921, 25.032904813330177,
+	25.222112603629981, 25.409274864242199, 25.594435351077472, 25.777636430917198,
+	25.958919139599701, 26.138323237191358, 26.315887260328324, 26.491648571901138,
+	26.665643408242516, 26.837906923967367, 27.00847323460377, 27.177375457144443,
+	27.344645748638932, 27.510315342939293, 27.67441458570422, 27.836972967759593,
+	27.998019156907446, 28.157581028268936, 28.31568569324174, 28.472359527147098,
+	28.62762819563708, 28.781516679928075, 28.934049300922723, 29.085249742278329,
+	29.235141072476694, 29.383745765946678, 29.531085723287923, 29.677182290641149,
+	29.822056278248048, 29.965727978240956, 30.108217181700461, 30.249543195016706,
+	30.389724855588327, 30.528780546890872, 30.666728212944825, 30.80358537221182,
+	30.939369130945828, 31.074096196024875, 31.20778288728728, 31.340445149395229,
+	31.472098563247272, 31.602758356960102, 31.732439416439099, 31.861156295555801,
+	31.988923225949897, 32.11575412647214, 32.241662612283854, 32.366662003627916,
+	32.490765334285427, 32.613985359731345, 32.736334565002011, 32.857825172286496,
+	32.978469148253573, 33.098278211125042, 33.217263837506032, 33.335437268982204,
+	33.452809518493225, 33.569391376491765, 33.685193416896396, 33.80022600284677,
+	33.91449929226885, 34.02802324325765, 34.140807619284644, 34.252861994236682,
+	34.364195757292805, 34.474818117645356, 34.584738109071061, 34.693964594358093,
+	34.802506269594176, 34.910371668321233, 35.017569165561319, 35.124106981718754,
+	35.229993186362826, 35.335235701895613, 35.439842307108918, 35.543820640634451,
+	35.647178204290952, 35.749922366332044, 35.852060364598245, 35.953599309576596,
+	36.054546187370995, 36.154907862586526, 36.254691081130559, 36.353902472933768,
+	36.452548554593392, 36.550635731941796, 36.648170302542596, 36.745158458116904,
+	36.841606286901921, 36.937519775944288, 37.032904813330177, 37.127767190354334,
+	37.222112603629981, 37.315946657141566, 37.409274864242199, 37.502102649597461,
+	37.594435351077472, 37.686278221598698, 37.777636430917198, 37.868515067374815,
+	37.958919139599701, 38.048853578162792, 38.138323237191358, 38.227332895941153,
+	38.315887260328324, 38.403990964422341, 38.491648571901138, 38.578864577469616,
+	38.665643408242516, 38.751989425092972, 38.837906923967367, 38.923400137167938,
+	39.00847323460377, 39.093130325011181, 39.177375457144443, 39.261212620937727,
+	39.344645748638932, 39.427678715916414, 39.510315342939293, 39.592559395432048,
+	39.67441458570422, 39.755884573655891, 39.836972967759593, 39.91768332601935,
+	39.998019156907446, 40.077983920279578, 40.157581028268936, 40.236813846159905,
+	40.31568569324174, 40.394199843643001, 40.472359527147098, 40.550167929989485,
+	40.62762819563708, 40.704743425550269, 40.781516679928075, 40.857950978436804,
+	40.934049300922723, 41.009814588109151, 41.085249742278329, 41.160357627938517,
+	41.235141072476694, 41.309602866797192, 41.383745765946678, 41.457572489725827,
+	41.531085723287923, 41.604288117724934, 41.677182290641149, 41.749770826714808,
+	41.822056278248048, 41.894041165705367, 41.965727978240956, 42.037119174215199,
+	42.108217181700461, 42.179024398976672, 42.249543195016706, 42.319775909961955,
+	42.389724855588327, 42.459392315762798, 42.528780546890872, 42.597891778355091,
+	42.666728212944825, 42.735292027277545, 42.80358537221182, 42.871610373252125,
+	42.939369130945828, 43.006863721272367, 43.074096196024875, 43.141068583184477,
+	43.20778288728728, 43.274241089784439, 43.340445149395229, 43.406397002453453,
+	43.472098563247272, 43.537551724352568, 43.602758356960102, 43.667720311196476,
+	43.732439416439099, 43.796917481625314, 43.861156295555801, 43.925157627192284,
+	43.988923225949897, 44.052454821984057, 44.11575412647214, 44.178822831890088,
+	44.241662612283854, 44.304275123536087, 44.366662003627916, 44.42882487289608,
+	44.490765334285427, 44.552484973596933, 44.613985359731345, 44.675268044928409,
+	44.736334565002011, 44.797186439571078, 44.857825172286496, 44.918252251054078,
+	44.978469148253573, 45.038477320953973, 45.098278211125034, 45.157873245845231,
+	45.217263837506032, 45.276451384012802, 45.335437268982204, 45.394222861936271,
+	45.452809518493225, 45.511198580555018, 45.569391376491765, 45.627389221323085,
+	45.685193416896396, 45.742805252062254, 45.80022600284677, 45.85745693262124,
+	45.91449929226885, 45.971354320348809, 46.02802324325765, 46.084507275387978,
+	46.140807619284644, 46.196925465798316, 46.252861994236675, 46.308618372513052,
+	46.364195757292805, 46.419595294137245, 46.474818117645349, 46.529865351593173,
+	46.584738109071061, 46.639437492618711, 46.693964594358093, 46.748320496124258,
+	46.802506269594176, 46.856522976413466, 46.910371668321233, 46.964053387272926,
+	47.017569165561326, 47.070920025935628, 47.124106981718754, 47.177131036922816,
+	47.229993186362833, 47.282694415768724, 47.335235701895613, 47.387618012632437,
+	47.439842307108918, 47.491909535800971, 47.543820640634451, 47.59557655508744,
+	47.647178204290952, 47.698626505128125, 47.749922366332036, 47.801066688581955,
+	47.852060364598245, 47.902904279235898, 47.953599309576603, 48.004146325019576,
+	48.054546187371002, 48.104799750932202, 48.154907862586519, 48.204871361884955,
+	48.254691081130566, 48.304367845461655, 48.353902472933768, 48.403295774600551,
+	48.452548554593392, 48.501661610199989, 48.550635731941796, 48.599471703650359,
+	48.648170302542596, 48.696732299295022, 48.745158458116904, 48.793449536822436,
+	48.841606286901921, 48.88962945359188, 48.937519775944288, 48.985277986894829,
+	49.032904813330177, 49.08040097615438, 49.127767190354334, 49.175004165064379,
+	49.222112603629981, 49.269093203670579, 49.315946657141566, 49.362673650395465,
+	49.409274864242207, 49.45575097400868, 49.502102649597461, 49.548330555544737,
+	49.594435351077472, 49.640417690169798, 49.686278221598698, 49.732017588998929,
+	49.777636430917198, 49.823135380865693, 49.868515067374815, 49.913776114045305,
+	49.958919139599701, 50.003944757932985, 50.048853578162792, 50.093646204678748,
+	50.138323237191358, 50.182885270780133, 50.227332895941153, 50.27166669863405,
+	50.315887260328324, 50.359995158049102, 50.403990964422341, 50.447875247719409,
+	50.491648571901138, 50.535311496661322, 50.578864577469616, 50.622308365613975,
+	50.665643408242524, 50.708870248404871, 50.751989425092972, 50.795001473281431,
+	50.837906923967367, 50.880706304209667, 50.923400137167945, 50.96598894214079,
+	51.00847323460377, 51.050853526246811, 51.093130325011174, 51.13530413512602,
+	51.177375457144443, 51.219344787979168, 51.261212620937727, 51.302979445757273,
+	51.344645748638932, 51.386212012281788, 51.427678715916414, 51.469046335338042,
+	51.510315342939293, 51.551486207742578, 51.592559395432048, 51.633535368385225,
+	51.674414585704213, 51.715197503246593, 51.755884573655884, 51.796476246391705,
+	51.836972967759593, 51.877375180940376, 51.91768332601935, 51.957897840015008,
+	51.998019156907446, 52.038047707666522, 52.077983920279578, 52.117828219778914,
+	52.157581028268943, 52.197242764953003, 52.236813846159905, 52.276294685370125,
+	52.31568569324174, 52.35498727763607, 52.394199843643008, 52.43332379360605,
+	52.472359527147098, 52.511307441190944, 52.550167929989485, 52.588941385145638,
+	52.627628195637072, 52.66622874783959, 52.704743425550269, 52.743172610010397,
+	52.781516679928075, 52.81977601150065, 52.857950978436804, 52.896041951978532,
+	52.934049300922723, 52.971973391642663, 53.009814588109151, 53.047573251911523,
+	53.085249742278329, 53.122844416097884, 53.160357627938517, 53.197789730068664,
+	53.235141072476694, 53.272412002890547, 53.309602866797192, 53.34671400746177,
+	53.383745765946678, 53.420698481130344, 53.45757248972582, 53.494368126299221,
+	53.531085723287923, 53.567725611018567, 53.604288117724934, 53.640773569565546,
+	53.677182290641149, 53.713514603011966, 53.749770826714808, 53.785951279779994,
+	53.822056278248048, 53.85808613618633, 53.894041165705367, 53.929921676975106,
+	53.965727978240963, 54.001460375839706, 54.037119174215199, 54.072704675933934,
+	54.108217181700461, 54.143656990372634, 54.179024398976672, 54.214319702722143,
+	54.249543195016706, 54.284695167480763, 54.319775909961962, 54.354785710549493,
+	54.389724855588327, 54.424593629693263, 54.459392315762798, 54.494121194992957,
+	54.528780546890872, 54.563370649288331, 54.597891778355091, 54.632344208612153,
+	54.666728212944825, 54.701044062615708, 54.735292027277545, 54.769472374985909,
+	54.803585372211813, 54.837631283854165, 54.871610373252125, 54.905522902197276,
+	54.939369130945821, 54.973149318230476, 55.006863721272367, 55.040512595792791,
+	55.074096196024875, 55.107614774725043, 55.14106858318447, 55.174457871240392,
+	55.20778288728728, 55.241043878287925, 55.274241089784439, 55.307374765909124,
+	55.340445149395229, 55.373452481587648, 55.406397002453453, 55.439278950592403,
+	55.472098563247265, 55.504856076314134, 55.537551724352568, 55.570185740595669,
+	55.602758356960102, 55.635269804055937, 55.667720311196476, 55.700110106407934,
+	55.732439416439092, 55.764708466770777, 55.796917481625314, 55.829066683975888,
+	55.861156295555794, 55.89318653686761, 55.925157627192284, 55.957069784598161,
+	55.988923225949897, 56.020718166917291, 56.052454821984057, 56.084133404456509,
+	56.115754126472147, 56.147317199008214, 56.178822831890088, 56.210271233799716,
+	56.241662612283854, 56.272997173762306, 56.304275123536087, 56.335496665795446,
+	56.366662003627916, 56.397771339026207, 56.42882487289608, 56.459822805064107,
+	56.490765334285427, 56.521652658251341, 56.55248497359694, 56.583262475908583,
+	56.613985359731345, 56.64465381857643, 56.675268044928416, 56.705828230252571,
+	56.736334565002011, 56.766787238624815, 56.797186439571078, 56.827532355299937,
+	56.857825172286496, 56.888065076028681, 56.918252251054085, 56.948386880926677,
+	56.978469148253573, 57.008499234691612, 57.038477320953973, 57.068403586816665,
+	57.098278211125042, 57.12810137180017, 57.157873245845231, 57.187594009351784,
+	57.217263837506032, 57.246882904595026, 57.276451384012802, 57.305969448266453,
+	57.335437268982197, 57.364855016911349, 57.394222861936271, 57.423540973076214,
+	57.452809518493225, 57.482028665497864, 57.511198580555018, 57.540319429289497,
+	57.569391376491765, 57.598414586123482, 57.627389221323085, 57.656315444411256,
+	57.685193416896396, 57.714023299480047, 57.742805252062254, 57.771539433746845,
+	57.80022600284677, 57.828865116889304, 57.85745693262124, 57.886001606014005,
+	57.91449929226885, 57.942950145821811, 57.971354320348809, 57.999711968770576,
+	58.02802324325765, 58.056288295235206, 58.084507275387978, 58.112680333665054,
+	58.140807619284644, 58.168889280738838, 58.196925465798316, 58.224916321517,
+	58.252861994236675, 58.280762629591607, 58.308618372513052, 58.336429367233848,
+	58.364195757292805, 58.391917685539219, 58.419595294137245, 58.447228724570294,
+	58.474818117645349, 58.502363613497295, 58.529865351593173, 58.557323470736414,
+	58.584738109071061, 58.612109404085921, 58.639437492618711, 58.666722510860168,
+	58.693964594358093, 58.721163878021429, 58.748320496124258, 58.775434582309757,
+	58.802506269594176, 58.829535690370719, 58.856522976413466, 58.883468258881194,
+	58.910371668321226, 58.937233334673223, 58.964053387272926, 58.990831954855921,
+	59.017569165561326, 59.044265146935487, 59.070920025935628, 59.097533928933451,
+	59.124106981718754, 59.150639309502992, 59.177131036922816, 59.203582288043577,
+	59.229993186362833, 59.256363854813785, 59.282694415768724, 59.30898499104245,
+	59.335235701895613, 59.361446669038131, 59.387618012632437, 59.413749852296874,
+	59.439842307108925, 59.46589549560845, 59.491909535800971, 59.517884545160847,
+	59.543820640634451, 59.569717938643358, 59.59557655508744, 59.621396605348025,
+	59.647178204290952, 59.672921466269628, 59.698626505128125, 59.724293434204142,
+	59.749922366332036, 59.775513413845786, 59.801066688581955, 59.82658230188261,
+	59.852060364598245, 59.877500987090677, 59.902904279235898, 59.928270350426914,
+	59.953599309576603, 59.978891265120495, 60.004146325019576, 60.029364596763031,
+	60.054546187371002, 60.079691203397317, 60.104799750932202, 60.129871935604925,
+	60.154907862586519, 60.17990763659239, 60.204871361884955, 60.229799142276264,
+	60.254691081130566, 60.279547281366902, 60.304367845461655, 60.329152875451058,
+	60.353902472933768, 60.378616739073308, 60.403295774600551, 60.427939679816248,
+	60.452548554593392, 60.4771224983797, 60.501661610199989, 60.526165988658612,
+	60.550635731941796, 60.575070937820016, 60.599471703650359, 60.623838126378807,
+	60.648170302542596, 60.672468328272487, 60.696732299295022, 60.720962310934844,
+	60.745158458116904, 60.769320835368681, 60.793449536822436, 60.8175446562174,
+	60.841606286901921, 60.865634521835695, 60.88962945359188, 60.91359117435924,
+	60.937519775944295, 60.961415349773389, 60.985277986894829, 61.009107777980958,
+	61.032904813330177, 61.056669182869072, 61.08040097615438, 61.104100282375072,
+	61.127767190354334, 61.151401788551567, 61.175004165064379, 61.198574407630545,
+	61.222112603629981, 61.245618840086664, 61.269093203670579, 61.292535780699637,
+	61.315946657141573, 61.339325918615835, 61.362673650395465, 61.385989937408979,
+	61.409274864242199, 61.432528515140113, 61.45575097400868, 61.478942324416671,
+	61.502102649597468, 61.525232032450837, 61.548330555544744, 61.571398301117085,
+	61.594435351077479, 61.617441787008964, 61.640417690169798, 61.663363141495118,
+	61.686278221598698, 61.709163010774603, 61.732017588998929, 61.754842035931418,
+	61.777636430917198, 61.800400852988368, 61.823135380865686, 61.845840092960188,
+	61.868515067374808, 61.891160381905991, 61.913776114045312, 61.936362340981027,
+	61.958919139599701, 61.981446586487742, 62.003944757932992, 62.02641372992624,
+	62.048853578162792, 62.071264378043992, 62.093646204678748, 62.115999132885023,
+	62.138323237191358, 62.160618591838343, 62.182885270780133, 62.205123347685856,
+	62.227332895941153, 62.249513988649582, 62.27166669863405, 62.293791098438312,
+	62.315887260328324, 62.337955256293696, 62.359995158049102, 62.382007037035663,
+	62.403990964422341, 62.425947011107326, 62.447875247719409, 62.469775744619326,
+	62.491648571901138, 62.513493799393565, 62.535311496661315, 62.557101733006434,
+	62.578864577469609, 62.600600098831492, 62.622308365613975, 62.643989446081548,
+	62.665643408242524, 62.687270319850349, 62.708870248404864, 62.730443261153596,
+	62.751989425092972, 62.773508806969573, 62.795001473281431, 62.816467490279187,
+	62.837906923967367, 62.859319840105556, 62.880706304209667, 62.902066381553105,
+	62.923400137167945, 62.944707635846157, 62.96598894214079, 62.987244120367109,
+	63.00847323460377, 63.029676348694025, 63.050853526246811, 63.07200483063793,
+	63.093130325011174, 63.114230072279483, 63.13530413512602, 63.156352576005332,
+	63.177375457144443, 63.198372840543961, 63.219344787979168, 63.24029136100112,
+	63.261212620937727, 63.282108628894832, 63.302979445757273, 63.32382513218996,
+	63.344645748638932, 63.365441355332401, 63.386212012281788, 63.406957779282799,
+	63.427678715916421, 63.448374881549952, 63.469046335338042, 63.489693136223707,
+	63.5103153429393, 63.53091301400756, 63.551486207742578, 63.572034982250813,
+	63.592559395432048, 63.613059504980384, 63.633535368385225, 63.653987042932208,
+	63.674414585704213, 63.694818053582289, 63.715197503246593, 63.735552991177379,
+	63.755884573655884, 63.77619230676531, 63.796476246391713, 63.816736448224951,
+	63.836972967759593, 63.857185860295822, 63.877375180940376, 63.897540984607389,
+	63.91768332601935, 63.937802259707951, 63.957897840015001, 63.977970121093286,
+	63.998019156907446, 64.018045001234867, 64.038047707666522, 64.058027329607853,
+	64.077983920279578, 64.097917532718625, 64.117828219778914, 64.137716034132197,
+	64.157581028268936, 64.177423254499104, 64.197242764953003, 64.217039611582123,
+	64.236813846159905, 64.256565520282621, 64.276294685370118, 64.296001392666668,
+	64.315685693241747, 64.335347637990793, 64.35498727763607, 64.374604662727421,
+	64.394199843643008, 64.413772870590151, 64.43332379360605, 64.452852662558598,
+	64.472359527147091, 64.491844436903065, 64.511307441190951, 64.530748589208883,
+	64.550167929989485, 64.569565512400501, 64.588941385145631, 64.608295596765245,
+	64.627628195637072, 64.646939229976965, 64.666228747839583, 64.6854967971192,
+	64.704743425550276, 64.723968680708282, 64.74317261001039, 64.76235526071612,
+	64.781516679928075, 64.800656914592636, 64.81977601150065, 64.838874017288092,
+	64.857950978436804, 64.877006941275113, 64.896041951978532, 64.915056056570435,
+	64.934049300922723, 64.95302173075649, 64.971973391642663, 64.990904329002689,
+	65.009814588109151, 65.028704214086474, 65.047573251911516, 65.066421746414235,
+	65.085249742278322, 65.104057284041858, 65.122844416097877, 65.141611182695115,
+	65.160357627938509, 65.179083795789921, 65.197789730068664, 65.216475474452196,
+	65.235141072476694, 65.253786567537659, 65.272412002890547, 65.291017421651347,
+	65.309602866797192, 65.328168381166932, 65.34671400746177, 65.365239788245816,
+	65.383745765946685, 65.402231982856065, 65.420698481130344, 65.439145302791118,
+	65.45757248972582, 65.47598008368827, 65.494368126299221, 65.512736659046979,
+	65.531085723287916, 65.549415360247039, 65.567725611018574, 65.586016516566445,
+	65.604288117724934, 65.622540455199143, 65.640773569565553, 65.658987501272591,
+	65.677182290641142, 65.695357977865129, 65.713514603011959, 65.731652206023156,
+	65.749770826714808, 65.767870504778131, 65.785951279779994, 65.804013191163392,
+	65.822056278248041, 65.840080580230833, 65.85808613618633, 65.876072985067339,
+	65.89404116570536, 65.911990716811147, 65.929921676975098, 65.947834084667917,
+	65.965727978240963, 65.983603395926792, 66.001460375839699, 66.019298955976126,
+	66.037119174215192, 66.05492106831916, 66.072704675933934, 66.090470034589501,
+	66.108217181700468, 66.125946154566449, 66.143656990372634, 66.161349726190167,
+	66.179024398976679, 66.196681045576696, 66.214319702722136, 66.231940407032795,
+	66.249543195016699, 66.267128103070689, 66.284695167480763, 66.302244424422597,
+	66.319775909961962, 66.337289660055148, 66.354785710549493, 66.372264097183688,
+	66.389724855588327, 66.40716802128631, 66.424593629693263, 66.442001716117957,
+	66.459392315762798, 66.476765463724178, 66.494121194992957, 66.511459544454851,
+	66.528780546890872, 66.546084236977748, 66.563370649288331, 66.580639818291999,
+	66.597891778355091, 66.615126563741313, 66.632344208612153, 66.649544747027235,
+	66.666728212944818, 66.683894640222107, 66.701044062615708, 66.718176513781998,
+	66.735292027277552, 66.752390636559483, 66.769472374985909, 66.786537275816286,
+	66.803585372211813, 66.82061669723582, 66.837631283854165, 66.854629164935588,
+	66.871610373252125, 66.888574941479447, 66.905522902197276, 66.922454287889764,
+},
+{
+	-HUGE_VAL, -41.060630869054165, -29.060630869054165, -22.041080860400299,
+	-17.060630869054165, -13.197493730405824, -10.041080860400299, -7.3723718043629276,
+	-5.0606308690541653, -3.0215308517464337, -1.1974937304058244, 0.45254855459339183,
+	1.9589191395997005, 3.3446457486389249, 4.6276281956370724, 5.8220562782480556,
+	6.9393691309458276, 7.9889232259498968, 8.9784691482535735, 9.9144992922688502,
+	10.802506269594168, 11.647178204290945, 12.452548554593392, 13.222112603629981,
+	13.958919139599701, 14.665643408242516, 15.344645748638925, 15.998019156907446,
+	16.627628195637072, 17.235141072476694, 17.822056278248056, 18.389724855588327,
+	18.939369130945828, 19.472098563247272, 19.988923225949897, 20.490765334285427,
+	20.978469148253573, 21.452809518493225, 21.91449929226885, 22.364195757292805,
+	22.802506269594176, 23.229993186362826, 23.647178204290952, 24.054546187370995,
+	24.452548554593392, 24.841606286901921, 25.222112603629981, 25.594435351077472,
+	25.958919139599701, 26.315887260328324, 26.665643408242516, 27.00847323460377,
+	27.344645748638932, 27.67441458570422, 27.998019156907446, 28.31568569324174,
+	28.62762819563708, 28.934049300922723, 29.235141072476694, 29.531085723287923,
+	29.822056278248048, 30.108217181700461, 30.389724855588327, 30.666728212944825,
+	30.939369130945828, 31.20778288728728, 31.472098563247272, 31.732439416439099,
+	31.988923225949897, 32.241662612283854, 32.490765334285427, 32.736334565002011,
+	32.978469148253573, 33.217263837506032, 33.452809518493225, 33.685193416896396,
+	33.91449929226885, 34.140807619284644, 34.364195757292805, 34.584738109071061,
+	34.802506269594176, 35.017569165561319, 35.229993186362826, 35.439842307108918,
+	35.647178204290952, 35.852060364598245, 36.054546187370995, 36.254691081130559,
+	36.452548554593392, 36.648170302542596, 36.841606286901921, 37.032904813330177,
+	37.222112603629981, 37.409274864242199, 37.594435351077472, 37.777636430917198,
+	37.958919139599701, 38.138323237191358, 38.315887260328324, 38.491648571901138,
+	38.665643408242516, 38.837906923967367, 39.00847323460377, 39.177375457144443,
+	39.344645748638932, 39.510315342939293, 39.67441458570422, 39.836972967759593,
+	39.998019156907446, 40.157581028268936, 40.31568569324174, 40.472359527147098,
+	40.62762819563708, 40.781516679928075, 40.934049300922723, 41.085249742278329,
+	41.235141072476694, 41.383745765946678, 41.531085723287923, 41.677182290641149,
+	41.822056278248048, 41.965727978240956, 42.108217181700461, 42.249543195016706,
+	42.389724855588327, 42.528780546890872, 42.666728212944825, 42.80358537221182,
+	42.939369130945828, 43.074096196024875, 43.20778288728728, 43.340445149395229,
+	43.472098563247272, 43.602758356960102, 43.732439416439099, 43.861156295555801,
+	43.988923225949897, 44.11575412647214, 44.241662612283854, 44.366662003627916,
+	44.490765334285427, 44.613985359731345, 44.736334565002011, 44.857825172286496,
+	44.978469148253573, 45.098278211125034, 45.217263837506032, 45.335437268982204,
+	45.452809518493225, 45.569391376491765, 45.685193416896396, 45.80022600284677,
+	45.91449929226885, 46.02802324325765, 46.140807619284644, 46.252861994236675,
+	46.364195757292805, 46.474818117645349, 46.584738109071061, 46.693964594358093,
+	46.802506269594176, 46.910371668321233, 47.017569165561326, 47.124106981718754,
+	47.229993186362833, 47.335235701895613, 47.439842307108918, 47.543820640634451,
+	47.647178204290952, 47.749922366332036, 47.852060364598245, 47.953599309576603,
+	48.054546187371002, 48.154907862586519, 48.254691081130566, 48.353902472933768,
+	48.452548554593392, 48.550635731941796, 48.648170302542596, 48.745158458116904,
+	48.841606286901921, 48.937519775944288, 49.032904813330177, 49.127767190354334,
+	49.222112603629981, 49.315946657141566, 49.409274864242207, 49.502102649597461,
+	49.594435351077472, 49.686278221598698, 49.777636430917198, 49.868515067374815,
+	49.958919139599701, 50.048853578162792, 50.138323237191358, 50.227332895941153,
+	50.315887260328324, 50.403990964422341, 50.491648571901138, 50.578864577469616,
+	50.665643408242524, 50.751989425092972, 50.837906923967367, 50.923400137167945,
+	51.00847323460377, 51.093130325011174, 51.177375457144443, 51.261212620937727,
+	51.344645748638932, 51.427678715916414, 51.510315342939293, 51.592559395432048,
+	51.674414585704213, 51.755884573655884, 51.836972967759593, 51.91768332601935,
+	51.998019156907446, 52.077983920279578, 52.157581028268943, 52.236813846159905,
+	52.31568569324174, 52.394199843643008, 52.472359527147098, 52.550167929989485,
+	52.627628195637072, 52.704743425550269, 52.781516679928075, 52.857950978436804,
+	52.934049300922723, 53.009814588109151, 53.085249742278329, 53.160357627938517,
+	53.235141072476694, 53.309602866797192, 53.383745765946678, 53.45757248972582,
+	53.531085723287923, 53.604288117724934, 53.677182290641149, 53.749770826714808,
+	53.822056278248048, 53.894041165705367, 53.965727978240963, 54.037119174215199,
+	54.108217181700461, 54.179024398976672, 54.249543195016706, 54.319775909961962,
+	54.389724855588327, 54.459392315762798, 54.528780546890872, 54.597891778355091,
+	54.666728212944825, 54.735292027277545, 54.803585372211813, 54.871610373252125,
+	54.939369130945821, 55.006863721272367, 55.074096196024875, 55.14106858318447,
+	55.20778288728728, 55.274241089784439, 55.340445149395229, 55.406397002453453,
+	55.472098563247265, 55.537551724352568, 55.602758356960102, 55.667720311196476,
+	55.732439416439092, 55.796917481625314, 55.861156295555794, 55.925157627192284,
+	55.988923225949897, 56.052454821984057, 56.115754126472147, 56.178822831890088,
+	56.241662612283854, 56.304275123536087, 56.366662003627916, 56.42882487289608,
+	56.490765334285427, 56.55248497359694, 56.613985359731345, 56.675268044928416,
+	56.736334565002011, 56.797186439571078, 56.857825172286496, 56.918252251054085,
+	56.978469148253573, 57.038477320953973, 57.098278211125042, 57.157873245845231,
+	57.217263837506032, 57.276451384012802, 57.335437268982197, 57.394222861936271,
+	57.452809518493225, 57.511198580555018, 57.569391376491765, 57.627389221323085,
+	57.685193416896396, 57.742805252062254, 57.80022600284677, 57.85745693262124,
+	57.91449929226885, 57.971354320348809, 58.02802324325765, 58.084507275387978,
+	58.140807619284644, 58.196925465798316, 58.252861994236675, 58.308618372513052,
+	58.364195757292805, 58.419595294137245, 58.474818117645349, 58.529865351593173,
+	58.584738109071061, 58.639437492618711, 58.693964594358093, 58.748320496124258,
+	58.802506269594176, 58.856522976413466, 58.910371668321226, 58.964053387272926,
+	59.017569165561326, 59.070920025935628, 59.124106981718754, 59.177131036922816,
+	59.229993186362833, 59.282694415768724, 59.335235701895613, 59.387618012632437,
+	59.439842307108925, 59.491909535800971, 59.543820640634451, 59.59557655508744,
+	59.647178204290952, 59.698626505128125, 59.749922366332036, 59.801066688581955,
+	59.852060364598245, 59.902904279235898, 59.953599309576603, 60.004146325019576,
+	60.054546187371002, 60.104799750932202, 60.154907862586519, 60.204871361884955,
+	60.254691081130566, 60.304367845461655, 60.353902472933768, 60.403295774600551,
+	60.452548554593392, 60.501661610199989, 60.550635731941796, 60.599471703650359,
+	60.648170302542596, 60.696732299295022, 60.745158458116904, 60.793449536822436,
+	60.841606286901921, 60.88962945359188, 60.937519775944295, 60.985277986894829,
+	61.032904813330177, 61.08040097615438, 61.127767190354334, 61.175004165064379,
+	61.222112603629981, 61.269093203670579, 61.315946657141573, 61.362673650395465,
+	61.409274864242199, 61.45575097400868, 61.502102649597468, 61.548330555544744,
+	61.594435351077479, 61.640417690169798, 61.686278221598698, 61.732017588998929,
+	61.777636430917198, 61.823135380865686, 61.868515067374808, 61.913776114045312,
+	61.958919139599701, 62.003944757932992, 62.048853578162792, 62.093646204678748,
+	62.138323237191358, 62.182885270780133, 62.227332895941153, 62.27166669863405,
+	62.315887260328324, 62.359995158049102, 62.403990964422341, 62.447875247719409,
+	62.491648571901138, 62.535311496661315, 62.578864577469609, 62.622308365613975,
+	62.665643408242524, 62.708870248404864, 62.751989425092972, 62.795001473281431,
+	62.837906923967367, 62.880706304209667, 62.923400137167945, 62.96598894214079,
+	63.00847323460377, 63.050853526246811, 63.093130325011174, 63.13530413512602,
+	63.177375457144443, 63.219344787979168, 63.261212620937727, 63.302979445757273,
+	63.344645748638932, 63.386212012281788, 63.427678715916421, 63.469046335338042,
+	63.5103153429393, 63.551486207742578, 63.592559395432048, 63.633535368385225,
+	63.674414585704213, 63.715197503246593, 63.755884573655884, 63.796476246391713,
+	63.836972967759593, 63.877375180940376, 63.91768332601935, 63.957897840015001,
+	63.998019156907446, 64.038047707666522, 64.077983920279578, 64.117828219778914,
+	64.157581028268936, 64.197242764953003, 64.236813846159905, 64.276294685370118,
+	64.315685693241747, 64.35498727763607, 64.394199843643008, 64.43332379360605,
+	64.472359527147091, 64.511307441190951, 64.550167929989485, 64.588941385145631,
+	64.627628195637072, 64.666228747839583, 64.704743425550276, 64.74317261001039,
+	64.781516679928075, 64.81977601150065, 64.857950978436804, 64.896041951978532,
+	64.934049300922723, 64.971973391642663, 65.009814588109151, 65.047573251911516,
+	65.085249742278322, 65.122844416097877, 65.160357627938509, 65.197789730068664,
+	65.235141072476694, 65.272412002890547, 65.309602866797192, 65.34671400746177,
+	65.383745765946685, 65.420698481130344, 65.45757248972582, 65.494368126299221,
+	65.531085723287916, 65.567725611018574, 65.604288117724934, 65.640773569565553,
+	65.677182290641142, 65.713514603011959, 65.749770826714808, 65.785951279779994,
+	65.822056278248041, 65.85808613618633, 65.89404116570536, 65.929921676975098,
+	65.965727978240963, 66.001460375839699, 66.037119174215192, 66.072704675933934,
+	66.108217181700468, 66.143656990372634, 66.179024398976679, 66.214319702722136,
+	66.249543195016699, 66.284695167480763, 66.319775909961962, 66.354785710549493,
+	66.389724855588327, 66.424593629693263, 66.459392315762798, 66.494121194992957,
+	66.528780546890872, 66.563370649288331, 66.597891778355091, 66.632344208612153,
+	66.666728212944818, 66.701044062615708, 66.735292027277552, 66.769472374985909,
+	66.803585372211813, 66.837631283854165, 66.871610373252125, 66.905522902197276,
+	66.939369130945821, 66.973149318230469, 67.006863721272367, 67.040512595792791,
+	67.074096196024882, 67.107614774725036, 67.141068583184477, 67.174457871240392,
+	67.20778288728728, 67.241043878287925, 67.274241089784439, 67.307374765909117,
+	67.340445149395222, 67.373452481587648, 67.40639700245346, 67.439278950592396,
+	67.472098563247272, 67.504856076314127, 67.537551724352568, 67.570185740595662,
+	67.602758356960095, 67.635269804055937, 67.667720311196476, 67.700110106407934,
+	67.732439416439092, 67.76470846677077, 67.796917481625314, 67.829066683975896,
+	67.861156295555801, 67.893186536867603, 67.925157627192277, 67.957069784598161,
+	67.988923225949904, 68.020718166917291, 68.052454821984057, 68.084133404456509,
+	68.11575412647214, 68.147317199008214, 68.178822831890088, 68.210271233799716,
+	68.241662612283861, 68.272997173762306, 68.304275123536087, 68.335496665795446,
+	68.366662003627908, 68.397771339026207, 68.428824872896072, 68.459822805064107,
+	68.490765334285427, 68.521652658251341, 68.552484973596933, 68.583262475908583,
+	68.613985359731345, 68.64465381857643, 68.675268044928416, 68.705828230252578,
+	68.736334565002011, 68.766787238624815, 68.797186439571078, 68.827532355299937,
+	68.857825172286496, 68.888065076028681, 68.918252251054085, 68.948386880926677,
+	68.978469148253581, 69.008499234691612, 69.038477320953973, 69.068403586816657,
+	69.098278211125034, 69.12810137180017, 69.157873245845238, 69.187594009351784,
+	69.217263837506039, 69.246882904595026, 69.276451384012802, 69.305969448266453,
+	69.335437268982204, 69.364855016911349, 69.394222861936271, 69.423540973076214,
+	69.452809518493225, 69.482028665497864, 69.511198580555018, 69.540319429289497,
+	69.569391376491765, 69.598414586123482, 69.627389221323085, 69.656315444411248,
+	69.685193416896396, 69.714023299480047, 69.742805252062254, 69.771539433746838,
+	69.80022600284677, 69.828865116889304, 69.857456932621233, 69.886001606014005,
+	69.914499292268857, 69.942950145821811, 69.971354320348809, 69.999711968770583,
+	70.02802324325765, 70.056288295235206, 70.084507275387978, 70.112680333665054,
+	70.140807619284644, 70.168889280738838, 70.196925465798316, 70.224916321517,
+	70.252861994236682, 70.280762629591607, 70.308618372513052, 70.336429367233848,
+	70.364195757292805, 70.391917685539227, 70.419595294137238, 70.447228724570294,
+	70.474818117645356, 70.502363613497295, 70.529865351593173, 70.557323470736421,
+	70.584738109071068, 70.612109404085913, 70.639437492618711, 70.666722510860168,
+	70.693964594358093, 70.721163878021429, 70.748320496124265, 70.775434582309757,
+	70.802506269594176, 70.829535690370719, 70.856522976413459, 70.883468258881194,
+	70.910371668321233, 70.937233334673223, 70.964053387272926, 70.990831954855921,
+	71.017569165561326, 71.044265146935487, 71.070920025935635, 71.097533928933444,
+	71.124106981718754, 71.150639309502992, 71.177131036922816, 71.203582288043577,
+	71.229993186362833, 71.256363854813785, 71.282694415768731, 71.30898499104245,
+	71.335235701895613, 71.361446669038131, 71.38761801263243, 71.413749852296874,
+	71.439842307108918, 71.46589549560845, 71.491909535800971, 71.51788454516084,
+	71.543820640634451, 71.569717938643365, 71.595576555087447, 71.621396605348025,
+	71.647178204290952, 71.672921466269628, 71.698626505128132, 71.724293434204142,
+	71.749922366332044, 71.775513413845786, 71.801066688581955, 71.82658230188261,
+	71.852060364598245, 71.877500987090684, 71.902904279235898, 71.928270350426914,
+	71.953599309576603, 71.978891265120495, 72.004146325019576, 72.029364596763031,
+	72.054546187371002, 72.079691203397317, 72.104799750932202, 72.129871935604925,
+	72.154907862586526, 72.17990763659239, 72.204871361884955, 72.229799142276264,
+	72.254691081130559, 72.279547281366902, 72.304367845461655, 72.329152875451058,
+	72.353902472933768, 72.378616739073308, 72.403295774600551, 72.427939679816248,
+	72.452548554593392, 72.4771224983797, 72.501661610199989, 72.526165988658619,
+	72.550635731941796, 72.575070937820016, 72.599471703650352, 72.623838126378814,
+	72.648170302542596, 72.672468328272487, 72.696732299295022, 72.720962310934851,
+	72.745158458116904, 72.769320835368674, 72.793449536822436, 72.817544656217393,
+	72.841606286901921, 72.865634521835688, 72.88962945359188, 72.91359117435924,
+	72.937519775944295, 72.961415349773389, 72.985277986894829, 73.009107777980958,
+	73.032904813330177, 73.056669182869072, 73.08040097615438, 73.104100282375072,
+	73.127767190354334, 73.151401788551567, 73.175004165064379, 73.198574407630545,
+	73.222112603629981, 73.245618840086664, 73.269093203670579, 73.292535780699637,
+	73.315946657141566, 73.339325918615828, 73.362673650395465, 73.385989937408979,
+	73.409274864242207, 73.43252851514012, 73.45575097400868, 73.478942324416664,
+	73.502102649597461, 73.525232032450845, 73.548330555544737, 73.571398301117085,
+	73.594435351077479, 73.617441787008971, 73.640417690169798, 73.663363141495125,
+	73.686278221598698, 73.709163010774603, 73.732017588998929, 73.754842035931418,
+	73.777636430917198, 73.800400852988375, 73.823135380865693, 73.845840092960188,
+	73.868515067374815, 73.891160381905991, 73.913776114045305, 73.93636234098102,
+	73.958919139599701, 73.981446586487749, 74.003944757932985, 74.026413729926233,
+	74.048853578162792, 74.071264378043992, 74.093646204678748, 74.115999132885023,
+	74.138323237191358, 74.160618591838343, 74.182885270780133, 74.205123347685856,
+	74.227332895941146, 74.249513988649582, 74.27166669863405, 74.293791098438305,
+	74.315887260328324, 74.337955256293696, 74.359995158049102, 74.382007037035663,
+	74.403990964422334, 74.425947011107326, 74.447875247719409, 74.469775744619326,
+	74.491648571901138, 74.513493799393572, 74.535311496661322, 74.557101733006434,
+	74.578864577469616, 74.600600098831492, 74.622308365613975, 74.643989446081548,
+	74.665643408242516, 74.687270319850342, 74.708870248404864, 74.730443261153596,
+	74.751989425092972, 74.773508806969573, 74.795001473281431, 74.816467490279194,
+	74.837906923967367, 74.859319840105556, 74.880706304209667, 74.902066381553098,
+	74.923400137167945, 74.944707635846157, 74.965988942140797, 74.987244120367109,
+	75.00847323460377, 75.029676348694025, 75.050853526246811, 75.072004830637923,
+	75.093130325011174, 75.114230072279483, 75.13530413512602, 75.156352576005332,
+	75.17737545714445, 75.198372840543968, 75.219344787979168, 75.240291361001127,
+	75.261212620937727, 75.282108628894832, 75.302979445757273, 75.323825132189953,
+	75.344645748638925, 75.365441355332393, 75.386212012281788, 75.406957779282806,
+	75.427678715916414, 75.448374881549952, 75.469046335338049, 75.489693136223707,
+	75.510315342939293, 75.530913014007552, 75.551486207742585, 75.572034982250813,
+	75.592559395432048, 75.613059504980384, 75.633535368385225, 75.653987042932215,
+	75.674414585704213, 75.694818053582281, 75.7151975032466, 75.735552991177371,
+	75.755884573655891, 75.77619230676531, 75.796476246391705, 75.816736448224944,
+	75.836972967759593, 75.857185860295829, 75.877375180940376, 75.897540984607389,
+	75.917683326019343, 75.937802259707951, 75.957897840015008, 75.977970121093279,
+	75.998019156907446, 76.018045001234867, 76.038047707666522, 76.058027329607853,
+	76.077983920279578, 76.097917532718625, 76.117828219778914, 76.137716034132197,
+	76.157581028268936, 76.177423254499104, 76.197242764953003, 76.217039611582123,
+	76.236813846159905, 76.256565520282621, 76.276294685370118, 76.296001392666668,
+	76.315685693241733, 76.335347637990793, 76.35498727763607, 76.374604662727421,
+	76.394199843643008, 76.413772870590151, 76.43332379360605, 76.452852662558598,
+	76.472359527147091, 76.491844436903065, 76.511307441190951, 76.530748589208883,
+	76.550167929989485, 76.569565512400501, 76.588941385145631, 76.608295596765245,
+	76.627628195637072, 76.646939229976965, 76.666228747839597, 76.6854967971192,
+	76.704743425550276, 76.723968680708282, 76.74317261001039, 76.76235526071612,
+	76.781516679928075, 76.800656914592636, 76.81977601150065, 76.838874017288092,
+	76.857950978436804, 76.877006941275113, 76.896041951978532, 76.915056056570435,
+	76.934049300922723, 76.95302173075649, 76.971973391642663, 76.990904329002689,
+	77.009814588109151, 77.028704214086474, 77.04757325191153, 77.066421746414235,
+	77.085249742278336, 77.104057284041858, 77.122844416097877, 77.141611182695115,
+	77.160357627938509, 77.179083795789921, 77.197789730068664, 77.216475474452196,
+	77.235141072476694, 77.253786567537659, 77.272412002890547, 77.291017421651347,
+	77.309602866797192, 77.328168381166932, 77.34671400746177, 77.365239788245816,
+	77.383745765946685, 77.402231982856065, 77.420698481130344, 77.439145302791118,
+	77.45757248972582, 77.47598008368827, 77.494368126299221, 77.512736659046979,
+	77.531085723287916, 77.549415360247053, 77.567725611018574, 77.586016516566445,
+	77.604288117724934, 77.622540455199143, 77.640773569565553, 77.658987501272591,
+	77.677182290641142, 77.695357977865129, 77.713514603011959, 77.731652206023156,
+	77.749770826714808, 77.767870504778131, 77.785951279779994, 77.804013191163392,
+	77.822056278248056, 77.840080580230833, 77.85808613618633, 77.876072985067339,
+	77.89404116570536, 77.911990716811147, 77.929921676975113, 77.947834084667917,
+	77.965727978240963, 77.983603395926792, 78.001460375839713, 78.019298955976126,
+	78.037119174215192, 78.05492106831916, 78.072704675933934, 78.090470034589501,
+	78.108217181700468, 78.125946154566449, 78.143656990372634, 78.161349726190167,
+	78.179024398976679, 78.196681045576696, 78.214319702722136, 78.231940407032795,
+	78.249543195016699, 78.267128103070689, 78.284695167480763, 78.302244424422597,
+	78.319775909961962, 78.337289660055148, 78.354785710549493, 78.372264097183688,
+	78.389724855588327, 78.40716802128631, 78.424593629693263, 78.442001716117957,
+	78.459392315762798, 78.476765463724178, 78.494121194992957, 78.511459544454851,
+	78.528780546890872, 78.546084236977748, 78.563370649288331, 78.580639818291985,
+	78.597891778355091, 78.615126563741313, 78.632344208612153, 78.649544747027235,
+	78.666728212944818, 78.683894640222121, 78.701044062615708, 78.718176513781998,
+	78.735292027277552, 78.752390636559483, 78.769472374985909, 78.786537275816286,
+	78.803585372211813, 78.820616697235835, 78.837631283854165, 78.854629164935588,
+	78.871610373252125, 78.888574941479447, 78.905522902197276, 78.922454287889764,
+},
+{
+	-HUGE_VAL, -29.060630869054165, -17.060630869054165, -10.041080860400299,
+	-5.0606308690541653, -1.1974937304058244, 1.9589191395997005, 4.6276281956370724,
+	6.9393691309458276, 8.9784691482535735, 10.802506269594168, 12.452548554593392,
+	13.958919139599701, 15.344645748638925, 16.627628195637072, 17.822056278248056,
+	18.939369130945828, 19.988923225949897, 20.978469148253573, 21.91449929226885,
+	22.802506269594176, 23.647178204290952, 24.452548554593392, 25.222112603629981,
+	25.958919139599701, 26.665643408242516, 27.344645748638932, 27.998019156907446,
+	28.62762819563708, 29.235141072476694, 29.822056278248048, 30.389724855588327,
+	30.939369130945828, 31.472098563247272, 31.988923225949897, 32.490765334285427,
+	32.978469148253573, 33.452809518493225, 33.91449929226885, 34.364195757292805,
+	34.802506269594176, 35.229993186362826, 35.647178204290952, 36.054546187370995,
+	36.452548554593392, 36.841606286901921, 37.222112603629981, 37.594435351077472,
+	37.958919139599701, 38.315887260328324, 38.665643408242516, 39.00847323460377,
+	39.344645748638932, 39.67441458570422, 39.998019156907446, 40.31568569324174,
+	40.62762819563708, 40.934049300922723, 41.235141072476694, 41.531085723287923,
+	41.822056278248048, 42.108217181700461, 42.389724855588327, 42.666728212944825,
+	42.939369130945828, 43.20778288728728, 43.472098563247272, 43.732439416439099,
+	43.988923225949897, 44.241662612283854, 44.490765334285427, 44.736334565002011,
+	44.978469148253573, 45.217263837506032, 45.452809518493225, 45.685193416896396,
+	45.91449929226885, 46.140807619284644, 46.364195757292805, 46.584738109071061,
+	46.802506269594176, 47.017569165561326, 47.229993186362833, 47.439842307108918,
+	47.647178204290952, 47.852060364598245, 48.054546187371002, 48.254691081130566,
+	48.452548554593392, 48.648170302542596, 48.841606286901921, 49.032904813330177,
+	49.222112603629981, 49.409274864242207, 49.594435351077472, 49.777636430917198,
+	49.958919139599701, 50.138323237191358, 50.315887260328324, 50.491648571901138,
+	50.665643408242524, 50.837906923967367, 51.00847323460377, 51.177375457144443,
+	51.344645748638932, 51.510315342939293, 51.674414585704213, 51.836972967759593,
+	51.998019156907446, 52.157581028268943, 52.31568569324174, 52.472359527147098,
+	52.627628195637072, 52.781516679928075, 52.934049300922723, 53.085249742278329,
+	53.235141072476694, 53.383745765946678, 53.531085723287923, 53.677182290641149,
+	53.822056278248048, 53.965727978240963, 54.108217181700461, 54.249543195016706,
+	54.389724855588327, 54.528780546890872, 54.666728212944825, 54.803585372211813,
+	54.939369130945821, 55.074096196024875, 55.20778288728728, 55.340445149395229,
+	55.472098563247265, 55.602758356960102, 55.732439416439092, 55.861156295555794,
+	55.988923225949897, 56.115754126472147, 56.241662612283854, 56.366662003627916,
+	56.490765334285427, 56.613985359731345, 56.736334565002011, 56.857825172286496,
+	56.978469148253573, 57.098278211125042, 57.217263837506032, 57.335437268982197,
+	57.452809518493225, 57.569391376491765, 57.685193416896396, 57.80022600284677,
+	57.91449929226885, 58.02802324325765, 58.140807619284644, 58.252861994236675,
+	58.364195757292805, 58.474818117645349, 58.584738109071061, 58.693964594358093,
+	58.802506269594176, 58.910371668321226, 59.017569165561326, 59.124106981718754,
+	59.229993186362833, 59.335235701895613, 59.439842307108925, 59.543820640634451,
+	59.647178204290952, 59.749922366332036, 59.852060364598245, 59.953599309576603,
+	60.054546187371002, 60.154907862586519, 60.254691081130566, 60.353902472933768,
+	60.452548554593392, 60.550635731941796, 60.648170302542596, 60.745158458116904,
+	60.841606286901921, 60.937519775944295, 61.032904813330177, 61.127767190354334,
+	61.222112603629981, 61.315946657141573, 61.409274864242199, 61.502102649597468,
+	61.594435351077479, 61.686278221598698, 61.777636430917198, 61.868515067374808,
+	61.958919139599701, 62.048853578162792, 62.138323237191358, 62.227332895941153,
+	62.315887260328324, 62.403990964422341, 62.491648571901138, 62.578864577469609,
+	62.665643408242524, 62.751989425092972, 62.837906923967367, 62.923400137167945,
+	63.00847323460377, 63.093130325011174, 63.177375457144443, 63.261212620937727,
+	63.344645748638932, 63.427678715916421, 63.5103153429393, 63.592559395432048,
+	63.674414585704213, 63.755884573655884, 63.836972967759593, 63.91768332601935,
+	63.998019156907446, 64.077983920279578, 64.157581028268936, 64.236813846159905,
+	64.315685693241747, 64.394199843643008, 64.472359527147091, 64.550167929989485,
+	64.627628195637072, 64.704743425550276, 64.781516679928075, 64.857950978436804,
+	64.934049300922723, 65.009814588109151, 65.085249742278322, 65.160357627938509,
+	65.235141072476694, 65.309602866797192, 65.383745765946685, 65.45757248972582,
+	65.531085723287916, 65.604288117724934, 65.677182290641142, 65.749770826714808,
+	65.822056278248041, 65.89404116570536, 65.965727978240963, 66.037119174215192,
+	66.108217181700468, 66.179024398976679, 66.249543195016699, 66.319775909961962,
+	66.389724855588327, 66.459392315762798, 66.528780546890872, 66.597891778355091,
+	66.666728212944818, 66.735292027277552, 66.803585372211813, 66.871610373252125,
+	66.939369130945821, 67.006863721272367, 67.074096196024882, 67.141068583184477,
+	67.20778288728728, 67.274241089784439, 67.340445149395222, 67.40639700245346,
+	67.472098563247272, 67.537551724352568, 67.602758356960095, 67.667720311196476,
+	67.732439416439092, 67.796917481625314, 67.861156295555801, 67.925157627192277,
+	67.988923225949904, 68.052454821984057, 68.11575412647214, 68.178822831890088,
+	68.241662612283861, 68.304275123536087, 68.366662003627908, 68.428824872896072,
+	68.490765334285427, 68.552484973596933, 68.613985359731345, 68.675268044928416,
+	68.736334565002011, 68.797186439571078, 68.857825172286496, 68.918252251054085,
+	68.978469148253581, 69.038477320953973, 69.098278211125034, 69.157873245845238,
+	69.217263837506039, 69.276451384012802, 69.335437268982204, 69.394222861936271,
+	69.452809518493225, 69.511198580555018, 69.569391376491765, 69.627389221323085,
+	69.685193416896396, 69.742805252062254, 69.80022600284677, 69.857456932621233,
+	69.914499292268857, 69.971354320348809, 70.02802324325765, 70.084507275387978,
+	70.140807619284644, 70.196925465798316, 70.252861994236682, 70.308618372513052,
+	70.364195757292805, 70.419595294137238, 70.474818117645356, 70.529865351593173,
+	70.584738109071068, 70.639437492618711, 70.693964594358093, 70.748320496124265,
+	70.802506269594176, 70.856522976413459, 70.910371668321233, 70.964053387272926,
+	71.017569165561326, 71.070920025935635, 71.124106981718754, 71.177131036922816,
+	71.229993186362833, 71.282694415768731, 71.335235701895613, 71.38761801263243,
+	71.439842307108918, 71.491909535800971, 71.543820640634451, 71.595576555087447,
+	71.647178204290952, 71.698626505128132, 71.749922366332044, 71.801066688581955,
+	71.852060364598245, 71.902904279235898, 71.953599309576603, 72.004146325019576,
+	72.054546187371002, 72.104799750932202, 72.154907862586526, 72.204871361884955,
+	72.254691081130559, 72.304367845461655, 72.353902472933768, 72.403295774600551,
+	72.452548554593392, 72.501661610199989, 72.550635731941796, 72.599471703650352,
+	72.648170302542596, 72.696732299295022, 72.745158458116904, 72.793449536822436,
+	72.841606286901921, 72.88962945359188, 72.937519775944295, 72.985277986894829,
+	73.032904813330177, 73.08040097615438, 73.127767190354334, 73.175004165064379,
+	73.222112603629981, 73.269093203670579, 73.315946657141566, 73.362673650395465,
+	73.409274864242207, 73.45575097400868, 73.502102649597461, 73.548330555544737,
+	73.594435351077479, 73.640417690169798, 73.686278221598698, 73.732017588998929,
+	73.777636430917198, 73.823135380865693, 73.868515067374815, 73.913776114045305,
+	73.958919139599701, 74.003944757932985, 74.048853578162792, 74.093646204678748,
+	74.138323237191358, 74.182885270780133, 74.227332895941146, 74.27166669863405,
+	74.315887260328324, 74.359995158049102, 74.403990964422334, 74.447875247719409,
+	74.491648571901138, 74.535311496661322, 74.578864577469616, 74.622308365613975,
+	74.665643408242516, 74.708870248404864, 74.751989425092972, 74.795001473281431,
+	74.837906923967367, 74.880706304209667, 74.923400137167945, 74.965988942140797,
+	75.00847323460377, 75.050853526246811, 75.093130325011174, 75.13530413512602,
+	75.17737545714445, 75.219344787979168, 75.261212620937727, 75.302979445757273,
+	75.344645748638925, 75.386212012281788, 75.427678715916414, 75.469046335338049,
+	75.510315342939293, 75.551486207742585, 75.592559395432048, 75.633535368385225,
+	75.674414585704213, 75.7151975032466, 75.755884573655891, 75.796476246391705,
+	75.836972967759593, 75.877375180940376, 75.917683326019343, 75.957897840015008,
+	75.998019156907446, 76.038047707666522, 76.077983920279578, 76.117828219778914,
+	76.157581028268936, 76.197242764953003, 76.236813846159905, 76.276294685370118,
+	76.315685693241733, 76.35498727763607, 76.394199843643008, 76.43332379360605,
+	76.472359527147091, 76.511307441190951, 76.550167929989485, 76.588941385145631,
+	76.627628195637072, 76.666228747839597, 76.704743425550276, 76.74317261001039,
+	76.781516679928075, 76.81977601150065, 76.857950978436804, 76.896041951978532,
+	76.934049300922723, 76.971973391642663, 77.009814588109151, 77.04757325191153,
+	77.085249742278336, 77.122844416097877, 77.160357627938509, 77.197789730068664,
+	77.235141072476694, 77.272412002890547, 77.309602866797192, 77.34671400746177,
+	77.383745765946685, 77.420698481130344, 77.45757248972582, 77.494368126299221,
+	77.531085723287916, 77.567725611018574, 77.604288117724934, 77.640773569565553,
+	77.677182290641142, 77.713514603011959, 77.749770826714808, 77.785951279779994,
+	77.822056278248056, 77.85808613618633, 77.89404116570536, 77.929921676975113,
+	77.965727978240963, 78.001460375839713, 78.037119174215192, 78.072704675933934,
+	78.108217181700468, 78.143656990372634, 78.179024398976679, 78.214319702722136,
+	78.249543195016699, 78.284695167480763, 78.319775909961962, 78.354785710549493,
+	78.389724855588327, 78.424593629693263, 78.459392315762798, 78.494121194992957,
+	78.528780546890872, 78.563370649288331, 78.597891778355091, 78.632344208612153,
+	78.666728212944818, 78.701044062615708, 78.735292027277552, 78.769472374985909,
+	78.803585372211813, 78.837631283854165, 78.871610373252125, 78.905522902197276,
+	78.939369130945821, 78.973149318230469, 79.006863721272367, 79.040512595792791,
+	79.074096196024868, 79.107614774725036, 79.141068583184477, 79.174457871240392,
+	79.20778288728728, 79.241043878287925, 79.274241089784439, 79.307374765909117,
+	79.340445149395222, 79.373452481587648, 79.40639700245346, 79.43927895059241,
+	79.472098563247272, 79.504856076314127, 79.537551724352568, 79.570185740595662,
+	79.602758356960095, 79.635269804055937, 79.667720311196476, 79.700110106407934,
+	79.732439416439092, 79.76470846677077, 79.796917481625314, 79.829066683975896,
+	79.861156295555787, 79.893186536867603, 79.925157627192277, 79.957069784598161,
+	79.988923225949904, 80.020718166917291, 80.052454821984057, 80.084133404456509,
+	80.115754126472154, 80.147317199008214, 80.178822831890088, 80.210271233799716,
+	80.241662612283847, 80.272997173762306, 80.304275123536087, 80.335496665795446,
+	80.366662003627908, 80.397771339026207, 80.428824872896072, 80.459822805064107,
+	80.490765334285427, 80.521652658251341, 80.552484973596933, 80.583262475908583,
+	80.613985359731345, 80.64465381857643, 80.675268044928416, 80.705828230252564,
+	80.736334565002011, 80.766787238624815, 80.797186439571078, 80.827532355299937,
+	80.857825172286496, 80.888065076028681, 80.918252251054085, 80.948386880926677,
+	80.978469148253581, 81.008499234691612, 81.038477320953973, 81.068403586816657,
+	81.098278211125034, 81.12810137180017, 81.157873245845224, 81.187594009351784,
+	81.217263837506039, 81.246882904595026, 81.276451384012802, 81.305969448266453,
+	81.335437268982204, 81.364855016911349, 81.394222861936271, 81.423540973076214,
+	81.452809518493225, 81.482028665497864, 81.511198580555018, 81.540319429289497,
+	81.569391376491765, 81.598414586123482, 81.627389221323085, 81.656315444411263,
+	81.685193416896396, 81.714023299480047, 81.742805252062254, 81.771539433746838,
+	81.80022600284677, 81.828865116889304, 81.857456932621233, 81.886001606014005,
+	81.914499292268857, 81.942950145821811, 81.971354320348809, 81.999711968770583,
+	82.02802324325765, 82.056288295235206, 82.084507275387978, 82.112680333665054,
+	82.140807619284644, 82.168889280738838, 82.196925465798316, 82.224916321517,
+	82.252861994236667, 82.280762629591607, 82.308618372513052, 82.336429367233848,
+	82.364195757292805, 82.391917685539227, 82.419595294137252, 82.447228724570294,
+	82.474818117645356, 82.502363613497295, 82.529865351593173, 82.557323470736407,
+	82.584738109071054, 82.612109404085913, 82.639437492618711, 82.666722510860168,
+	82.693964594358093, 82.721163878021429, 82.748320496124251, 82.775434582309757,
+	82.802506269594176, 82.829535690370719, 82.856522976413459, 82.883468258881194,
+	82.910371668321233, 82.937233334673223, 82.964053387272926, 82.990831954855921,
+	83.017569165561326, 83.044265146935487, 83.070920025935635, 83.097533928933444,
+	83.124106981718754, 83.150639309502992, 83.177131036922816, 83.203582288043577,
+	83.229993186362833, 83.256363854813785, 83.282694415768731, 83.30898499104245,
+	83.335235701895613, 83.361446669038131, 83.38761801263243, 83.413749852296874,
+	83.439842307108918, 83.46589549560845, 83.491909535800971, 83.51788454516084,
+	83.543820640634451, 83.56971793864335, 83.595576555087433, 83.621396605348025,
+	83.647178204290952, 83.672921466269628, 83.698626505128132, 83.724293434204142,
+	83.749922366332044, 83.775513413845786, 83.801066688581955, 83.82658230188261,
+	83.852060364598245, 83.877500987090684, 83.902904279235898, 83.928270350426914,
+	83.953599309576603, 83.978891265120495, 84.004146325019576, 84.029364596763031,
+	84.054546187371002, 84.079691203397317, 84.104799750932202, 84.129871935604925,
+	84.154907862586526, 84.17990763659239, 84.204871361884955, 84.229799142276264,
+	84.254691081130574, 84.279547281366902, 84.304367845461655, 84.329152875451058,
+	84.353902472933768, 84.378616739073308, 84.403295774600551, 84.427939679816248,
+	84.452548554593392, 84.4771224983797, 84.501661610199989, 84.526165988658619,
+	84.550635731941796, 84.575070937820016, 84.599471703650352, 84.623838126378814,
+	84.648170302542596, 84.672468328272487, 84.696732299295022, 84.720962310934851,
+	84.745158458116904, 84.769320835368688, 84.793449536822436, 84.817544656217393,
+	84.841606286901921, 84.865634521835688, 84.88962945359188, 84.91359117435924,
+	84.937519775944295, 84.961415349773389, 84.985277986894829, 85.009107777980958,
+	85.032904813330177, 85.056669182869072, 85.08040097615438, 85.104100282375072,
+	85.127767190354334, 85.151401788551567, 85.175004165064379, 85.198574407630545,
+	85.222112603629981, 85.245618840086664, 85.269093203670579, 85.292535780699637,
+	85.315946657141566, 85.339325918615828, 85.362673650395465, 85.385989937408979,
+	85.409274864242207, 85.43252851514012, 85.45575097400868, 85.478942324416664,
+	85.502102649597461, 85.525232032450845, 85.548330555544737, 85.571398301117085,
+	85.594435351077465, 85.617441787008971, 85.640417690169798, 85.663363141495125,
+	85.686278221598698, 85.709163010774603, 85.732017588998929, 85.754842035931418,
+	85.777636430917198, 85.800400852988361, 85.823135380865693, 85.845840092960188,
+	85.868515067374815, 85.891160381905991, 85.913776114045305, 85.93636234098102,
+	85.958919139599701, 85.981446586487749, 86.003944757932985, 86.026413729926233,
+	86.048853578162792, 86.071264378043992, 86.093646204678748, 86.115999132885023,
+	86.138323237191358, 86.160618591838343, 86.182885270780133, 86.205123347685856,
+	86.227332895941146, 86.249513988649568, 86.27166669863405, 86.293791098438305,
+	86.315887260328324, 86.337955256293696, 86.359995158049102, 86.382007037035663,
+	86.403990964422348, 86.425947011107326, 86.447875247719409, 86.469775744619326,
+	86.491648571901138, 86.513493799393572, 86.535311496661322, 86.557101733006434,
+	86.578864577469616, 86.600600098831478, 86.622308365613975, 86.643989446081548,
+	86.665643408242516, 86.687270319850342, 86.708870248404878, 86.730443261153596,
+	86.751989425092972, 86.773508806969573, 86.795001473281431, 86.816467490279194,
+	86.837906923967367, 86.859319840105556, 86.880706304209667, 86.902066381553098,
+	86.923400137167945, 86.944707635846157, 86.965988942140797, 86.987244120367109,
+	87.00847323460377, 87.029676348694025, 87.050853526246811, 87.072004830637923,
+	87.093130325011174, 87.114230072279483, 87.13530413512602, 87.156352576005332,
+	87.17737545714445, 87.198372840543968, 87.219344787979168, 87.240291361001113,
+	87.261212620937727, 87.282108628894832, 87.302979445757273, 87.323825132189967,
+	87.344645748638925, 87.365441355332393, 87.386212012281788, 87.406957779282806,
+	87.427678715916414, 87.448374881549952, 87.469046335338049, 87.489693136223707,
+	87.510315342939293, 87.530913014007552, 87.551486207742585, 87.572034982250813,
+	87.592559395432048, 87.613059504980384, 87.633535368385225, 87.653987042932215,
+	87.674414585704213, 87.694818053582281, 87.7151975032466, 87.735552991177371,
+	87.755884573655891, 87.77619230676531, 87.796476246391705, 87.816736448224944,
+	87.836972967759593, 87.857185860295829, 87.877375180940376, 87.897540984607389,
+	87.917683326019358, 87.937802259707951, 87.957897840015008, 87.977970121093279,
+	87.998019156907446, 88.018045001234867, 88.038047707666522, 88.058027329607853,
+	88.077983920279578, 88.097917532718625, 88.117828219778914, 88.137716034132197,
+	88.157581028268936, 88.177423254499104, 88.197242764953003, 88.217039611582123,
+	88.236813846159905, 88.256565520282621, 88.276294685370118, 88.296001392666682,
+	88.315685693241733, 88.335347637990793, 88.35498727763607, 88.374604662727421,
+	88.394199843643008, 88.413772870590151, 88.43332379360605, 88.452852662558598,
+	88.472359527147091, 88.491844436903065, 88.511307441190951, 88.530748589208883,
+	88.550167929989485, 88.569565512400501, 88.588941385145631, 88.608295596765259,
+	88.627628195637072, 88.646939229976965, 88.666228747839597, 88.685496797119185,
+	88.704743425550276, 88.723968680708282, 88.74317261001039, 88.762355260716134,
+	88.781516679928075, 88.800656914592636, 88.81977601150065, 88.838874017288092,
+	88.857950978436804, 88.877006941275113, 88.896041951978532, 88.915056056570435,
+	88.934049300922723, 88.95302173075649, 88.971973391642663, 88.990904329002689,
+	89.009814588109151, 89.028704214086474, 89.04757325191153, 89.066421746414235,
+	89.085249742278336, 89.104057284041858, 89.122844416097877, 89.141611182695115,
+	89.160357627938509, 89.179083795789921, 89.197789730068664, 89.216475474452196,
+	89.235141072476694, 89.253786567537659, 89.272412002890547, 89.291017421651347,
+	89.309602866797192, 89.328168381166932, 89.34671400746177, 89.365239788245816,
+	89.383745765946685, 89.402231982856065, 89.420698481130344, 89.439145302791118,
+	89.45757248972582, 89.47598008368827, 89.494368126299221, 89.512736659046993,
+	89.53108572328793, 89.549415360247053, 89.567725611018574, 89.586016516566445,
+	89.604288117724934, 89.622540455199129, 89.640773569565539, 89.658987501272591,
+	89.677182290641156, 89.695357977865129, 89.713514603011959, 89.731652206023156,
+	89.749770826714808, 89.767870504778131, 89.785951279779994, 89.804013191163392,
+	89.822056278248056, 89.840080580230833, 89.85808613618633, 89.876072985067339,
+	89.894041165705374, 89.911990716811147, 89.929921676975113, 89.947834084667917,
+	89.965727978240963, 89.983603395926792, 90.001460375839713, 90.019298955976126,
+	90.037119174215206, 90.05492106831916, 90.072704675933934, 90.090470034589501,
+	90.108217181700468, 90.125946154566449, 90.143656990372634, 90.161349726190167,
+	90.179024398976679, 90.196681045576696, 90.21431970272215, 90.231940407032795,
+	90.249543195016713, 90.267128103070689, 90.284695167480763, 90.302244424422597,
+	90.319775909961962, 90.337289660055148, 90.354785710549493, 90.372264097183688,
+	90.389724855588327, 90.40716802128631, 90.424593629693263, 90.442001716117957,
+	90.459392315762798, 90.476765463724178, 90.494121194992957, 90.511459544454851,
+	90.528780546890872, 90.546084236977748, 90.563370649288331, 90.580639818291985,
+	90.597891778355091, 90.615126563741313, 90.632344208612153, 90.64954474702725,
+	90.666728212944832, 90.683894640222121, 90.701044062615708, 90.718176513781998,
+	90.735292027277552, 90.752390636559483, 90.769472374985909, 90.786537275816286,
+	90.803585372211813, 90.820616697235835, 90.837631283854165, 90.854629164935588,
+	90.871610373252125, 90.888574941479447, 90.905522902197276, 90.922454287889764,
+},
+{
+	-HUGE_VAL, -17.060630869054165, -5.0606308690541653, 1.9589191395997005,
+	6.9393691309458276, 10.802506269594168, 13.958919139599701, 16.627628195637072,
+	18.939369130945828, 20.978469148253573, 22.802506269594176, 24.452548554593392,
+	25.958919139599701, 27.344645748638932, 28.62762819563708, 29.822056278248048,
+	30.939369130945828, 31.988923225949897, 32.978469148253573, 33.91449929226885,
+	34.802506269594176, 35.647178204290952, 36.452548554593392, 37.222112603629981,
+	37.958919139599701, 38.665643408242516, 39.344645748638932, 39.998019156907446,
+	40.62762819563708, 41.235141072476694, 41.822056278248048, 42.389724855588327,
+	42.939369130945828, 43.472098563247272, 43.988923225949897, 44.490765334285427,
+	44.978469148253573, 45.452809518493225, 45.91449929226885, 46.364195757292805,
+	46.802506269594176, 47.229993186362833, 47.647178204290952, 48.054546187371002,
+	48.452548554593392, 48.841606286901921, 49.222112603629981, 49.594435351077472,
+	49.958919139599701, 50.315887260328324, 50.665643408242524, 51.00847323460377,
+	51.344645748638932, 51.674414585704213, 51.998019156907446, 52.31568569324174,
+	52.627628195637072, 52.934049300922723, 53.235141072476694, 53.531085723287923,
+	53.822056278248048, 54.108217181700461, 54.389724855588327, 54.666728212944825,
+	54.939369130945821, 55.20778288728728, 55.472098563247265, 55.732439416439092,
+	55.988923225949897, 56.241662612283854, 56.490765334285427, 56.736334565002011,
+	56.978469148253573, 57.217263837506032, 57.452809518493225, 57.685193416896396,
+	57.91449929226885, 58.140807619284644, 58.364195757292805, 58.584738109071061,
+	58.802506269594176, 59.017569165561326, 59.229993186362833, 59.439842307108925,
+	59.647178204290952, 59.852060364598245, 60.054546187371002, 60.254691081130566,
+	60.452548554593392, 60.648170302542596, 60.841606286901921, 61.032904813330177,
+	61.222112603629981, 61.409274864242199, 61.594435351077479, 61.777636430917198,
+	61.958919139599701, 62.138323237191358, 62.315887260328324, 62.491648571901138,
+	62.665643408242524, 62.837906923967367, 63.00847323460377, 63.177375457144443,
+	63.344645748638932, 63.5103153429393, 63.674414585704213, 63.836972967759593,
+	63.998019156907446, 64.157581028268936, 64.315685693241747, 64.472359527147091,
+	64.627628195637072, 64.781516679928075, 64.934049300922723, 65.085249742278322,
+	65.235141072476694, 65.383745765946685, 65.531085723287916, 65.677182290641142,
+	65.822056278248041, 65.965727978240963, 66.108217181700468, 66.249543195016699,
+	66.389724855588327, 66.528780546890872, 66.666728212944818, 66.803585372211813,
+	66.939369130945821, 67.074096196024882, 67.20778288728728, 67.340445149395222,
+	67.472098563247272, 67.602758356960095, 67.732439416439092, 67.861156295555801,
+	67.988923225949904, 68.11575412647214, 68.241662612283861, 68.366662003627908,
+	68.490765334285427, 68.613985359731345, 68.736334565002011, 68.857825172286496,
+	68.978469148253581, 69.098278211125034, 69.217263837506039, 69.335437268982204,
+	69.452809518493225, 69.569391376491765, 69.685193416896396, 69.80022600284677,
+	69.914499292268857, 70.02802324325765, 70.140807619284644, 70.252861994236682,
+	70.364195757292805, 70.474818117645356, 70.584738109071068, 70.693964594358093,
+	70.802506269594176, 70.910371668321233, 71.017569165561326, 71.124106981718754,
+	71.229993186362833, 71.335235701895613, 71.439842307108918, 71.543820640634451,
+	71.647178204290952, 71.749922366332044, 71.852060364598245, 71.953599309576603,
+	72.054546187371002, 72.154907862586526, 72.254691081130559, 72.353902472933768,
+	72.452548554593392, 72.550635731941796, 72.648170302542596, 72.745158458116904,
+	72.841606286901921, 72.937519775944295, 73.032904813330177, 73.127767190354334,
+	73.222112603629981, 73.315946657141566, 73.409274864242207, 73.502102649597461,
+	73.594435351077479, 73.686278221598698, 73.777636430917198, 73.868515067374815,
+	73.958919139599701, 74.048853578162792, 74.138323237191358, 74.227332895941146,
+	74.315887260328324, 74.403990964422334, 74.491648571901138, 74.578864577469616,
+	74.665643408242516, 74.751989425092972, 74.837906923967367, 74.923400137167945,
+	75.00847323460377, 75.093130325011174, 75.17737545714445, 75.261212620937727,
+	75.344645748638925, 75.427678715916414, 75.510315342939293, 75.592559395432048,
+	75.674414585704213, 75.755884573655891, 75.836972967759593, 75.917683326019343,
+	75.998019156907446, 76.077983920279578, 76.157581028268936, 76.236813846159905,
+	76.315685693241733, 76.394199843643008, 76.472359527147091, 76.550167929989485,
+	76.627628195637072, 76.704743425550276, 76.781516679928075, 76.857950978436804,
+	76.934049300922723, 77.009814588109151, 77.085249742278336, 77.160357627938509,
+	77.235141072476694, 77.309602866797192, 77.383745765946685, 77.45757248972582,
+	77.531085723287916, 77.604288117724934, 77.677182290641142, 77.749770826714808,
+	77.822056278248056, 77.89404116570536, 77.965727978240963, 78.037119174215192,
+	78.108217181700468, 78.179024398976679, 78.249543195016699, 78.319775909961962,
+	78.389724855588327, 78.459392315762798, 78.528780546890872, 78.597891778355091,
+	78.666728212944818, 78.735292027277552, 78.803585372211813, 78.871610373252125,
+	78.939369130945821, 79.006863721272367, 79.074096196024868, 79.141068583184477,
+	79.20778288728728, 79.274241089784439, 79.340445149395222, 79.40639700245346,
+	79.472098563247272, 79.537551724352568, 79.602758356960095, 79.667720311196476,
+	79.732439416439092, 79.796917481625314, 79.861156295555787, 79.925157627192277,
+	79.988923225949904, 80.052454821984057, 80.115754126472154, 80.178822831890088,
+	80.241662612283847, 80.304275123536087, 80.366662003627908, 80.428824872896072,
+	80.490765334285427, 80.552484973596933, 80.613985359731345, 80.675268044928416,
+	80.736334565002011, 80.797186439571078, 80.857825172286496, 80.918252251054085,
+	80.978469148253581, 81.038477320953973, 81.098278211125034, 81.157873245845224,
+	81.217263837506039, 81.276451384012802, 81.335437268982204, 81.394222861936271,
+	81.452809518493225, 81.511198580555018, 81.569391376491765, 81.627389221323085,
+	81.685193416896396, 81.742805252062254, 81.80022600284677, 81.857456932621233,
+	81.914499292268857, 81.971354320348809, 82.02802324325765, 82.084507275387978,
+	82.140807619284644, 82.196925465798316, 82.252861994236667, 82.308618372513052,
+	82.364195757292805, 82.419595294137252, 82.474818117645356, 82.529865351593173,
+	82.584738109071054, 82.639437492618711, 82.693964594358093, 82.748320496124251,
+	82.802506269594176, 82.856522976413459, 82.910371668321233, 82.964053387272926,
+	83.017569165561326, 83.070920025935635, 83.124106981718754, 83.177131036922816,
+	83.229993186362833, 83.282694415768731, 83.335235701895613, 83.38761801263243,
+	83.439842307108918, 83.491909535800971, 83.543820640634451, 83.595576555087433,
+	83.647178204290952, 83.698626505128132, 83.749922366332044, 83.801066688581955,
+	83.852060364598245, 83.902904279235898, 83.953599309576603, 84.004146325019576,
+	84.054546187371002, 84.104799750932202, 84.154907862586526, 84.204871361884955,
+	84.254691081130574, 84.304367845461655, 84.353902472933768, 84.403295774600551,
+	84.452548554593392, 84.501661610199989, 84.550635731941796, 84.599471703650352,
+	84.648170302542596, 84.696732299295022, 84.745158458116904, 84.793449536822436,
+	84.841606286901921, 84.88962945359188, 84.937519775944295, 84.985277986894829,
+	85.032904813330177, 85.08040097615438, 85.127767190354334, 85.175004165064379,
+	85.222112603629981, 85.269093203670579, 85.315946657141566, 85.362673650395465,
+	85.409274864242207, 85.45575097400868, 85.502102649597461, 85.548330555544737,
+	85.594435351077465, 85.640417690169798, 85.686278221598698, 85.732017588998929,
+	85.777636430917198, 85.823135380865693, 85.868515067374815, 85.913776114045305,
+	85.958919139599701, 86.003944757932985, 86.048853578162792, 86.093646204678748,
+	86.138323237191358, 86.182885270780133, 86.227332895941146, 86.27166669863405,
+	86.315887260328324, 86.359995158049102, 86.403990964422348, 86.447875247719409,
+	86.491648571901138, 86.535311496661322, 86.578864577469616, 86.622308365613975,
+	86.665643408242516, 86.708870248404878, 86.751989425092972, 86.795001473281431,
+	86.837906923967367, 86.880706304209667, 86.923400137167945, 86.965988942140797,
+	87.00847323460377, 87.050853526246811, 87.093130325011174, 87.13530413512602,
+	87.17737545714445, 87.219344787979168, 87.261212620937727, 87.302979445757273,
+	87.344645748638925, 87.386212012281788, 87.427678715916414, 87.469046335338049,
+	87.510315342939293, 87.551486207742585, 87.592559395432048, 87.633535368385225,
+	87.674414585704213, 87.7151975032466, 87.755884573655891, 87.796476246391705,
+	87.836972967759593, 87.877375180940376, 87.917683326019358, 87.957897840015008,
+	87.998019156907446, 88.038047707666522, 88.077983920279578, 88.117828219778914,
+	88.157581028268936, 88.197242764953003, 88.236813846159905, 88.276294685370118,
+	88.315685693241733, 88.35498727763607, 88.394199843643008, 88.43332379360605,
+	88.472359527147091, 88.511307441190951, 88.550167929989485, 88.588941385145631,
+	88.627628195637072, 88.666228747839597, 88.704743425550276, 88.74317261001039,
+	88.781516679928075, 88.81977601150065, 88.857950978436804, 88.896041951978532,
+	88.934049300922723, 88.971973391642663, 89.009814588109151, 89.04757325191153,
+	89.085249742278336, 89.122844416097877, 89.160357627938509, 89.197789730068664,
+	89.235141072476694, 89.272412002890547, 89.309602866797192, 89.34671400746177,
+	89.383745765946685, 89.420698481130344, 89.45757248972582, 89.494368126299221,
+	89.53108572328793, 89.567725611018574, 89.604288117724934, 89.640773569565539,
+	89.677182290641156, 89.713514603011959, 89.749770826714808, 89.785951279779994,
+	89.822056278248056, 89.85808613618633, 89.894041165705374, 89.929921676975113,
+	89.965727978240963, 90.001460375839713, 90.037119174215206, 90.072704675933934,
+	90.108217181700468, 90.143656990372634, 90.179024398976679, 90.21431970272215,
+	90.249543195016713, 90.284695167480763, 90.319775909961962, 90.354785710549493,
+	90.389724855588327, 90.424593629693263, 90.459392315762798, 90.494121194992957,
+	90.528780546890872, 90.563370649288331, 90.597891778355091, 90.632344208612153,
+	90.666728212944832, 90.701044062615708, 90.735292027277552, 90.769472374985909,
+	90.803585372211813, 90.837631283854165, 90.871610373252125, 90.905522902197276,
+	90.939369130945821, 90.973149318230469, 91.006863721272367, 91.040512595792791,
+	91.074096196024868, 91.10761477472505, 91.141068583184477, 91.174457871240392,
+	91.20778288728728, 91.241043878287925, 91.274241089784439, 91.307374765909117,
+	91.340445149395237, 91.373452481587648, 91.406397002453446, 91.43927895059241,
+	91.472098563247272, 91.504856076314127, 91.537551724352568, 91.570185740595662,
+	91.602758356960095, 91.635269804055937, 91.667720311196476, 91.700110106407934,
+	91.732439416439092, 91.76470846677077, 91.796917481625314, 91.829066683975896,
+	91.861156295555787, 91.893186536867603, 91.925157627192277, 91.957069784598161,
+	91.98892322594989, 92.020718166917291, 92.052454821984057, 92.084133404456509,
+	92.115754126472154, 92.147317199008214, 92.178822831890088, 92.210271233799716,
+	92.241662612283847, 92.272997173762306, 92.304275123536087, 92.335496665795446,
+	92.366662003627908, 92.397771339026207, 92.428824872896087, 92.459822805064107,
+	92.490765334285427, 92.521652658251341, 92.552484973596933, 92.583262475908583,
+	92.613985359731345, 92.64465381857643, 92.675268044928416, 92.705828230252564,
+	92.736334565002011, 92.766787238624815, 92.797186439571078, 92.827532355299937,
+	92.857825172286496, 92.888065076028681, 92.918252251054085, 92.948386880926677,
+	92.978469148253566, 93.008499234691612, 93.038477320953973, 93.068403586816657,
+	93.098278211125034, 93.12810137180017, 93.157873245845224, 93.187594009351784,
+	93.217263837506039, 93.246882904595026, 93.276451384012802, 93.305969448266453,
+	93.335437268982204, 93.364855016911349, 93.394222861936271, 93.423540973076214,
+	93.452809518493225, 93.482028665497864, 93.511198580555018, 93.540319429289497,
+	93.569391376491765, 93.598414586123482, 93.627389221323085, 93.656315444411263,
+	93.685193416896396, 93.714023299480047, 93.742805252062254, 93.771539433746852,
+	93.80022600284677, 93.828865116889318, 93.857456932621233, 93.88600160601402,
+	93.914499292268857, 93.942950145821811, 93.971354320348809, 93.999711968770583,
+	94.02802324325765, 94.056288295235206, 94.084507275387978, 94.112680333665054,
+	94.140807619284644, 94.168889280738853, 94.196925465798316, 94.224916321517,
+	94.252861994236682, 94.280762629591607, 94.308618372513052, 94.336429367233848,
+	94.364195757292805, 94.391917685539227, 94.419595294137252, 94.447228724570294,
+	94.474818117645356, 94.502363613497295, 94.529865351593173, 94.557323470736407,
+	94.584738109071054, 94.612109404085913, 94.639437492618711, 94.666722510860168,
+	94.693964594358093, 94.721163878021429, 94.748320496124251, 94.775434582309757,
+	94.802506269594176, 94.829535690370719, 94.856522976413459, 94.883468258881194,
+	94.910371668321233, 94.937233334673223, 94.964053387272926, 94.990831954855906,
+	95.017569165561326, 95.044265146935487, 95.070920025935635, 95.097533928933444,
+	95.124106981718754, 95.150639309502992, 95.177131036922816, 95.203582288043577,
+	95.229993186362833, 95.25636385481377, 95.282694415768731, 95.30898499104245,
+	95.335235701895613, 95.361446669038131, 95.38761801263243, 95.413749852296874,
+	95.439842307108918, 95.46589549560845, 95.491909535800971, 95.517884545160854,
+	95.543820640634451, 95.56971793864335, 95.595576555087447, 95.621396605348025,
+	95.647178204290952, 95.672921466269628, 95.698626505128118, 95.724293434204142,
+	95.749922366332044, 95.775513413845786, 95.801066688581955, 95.82658230188261,
+	95.852060364598245, 95.877500987090684, 95.902904279235898, 95.928270350426914,
+	95.953599309576589, 95.978891265120495, 96.004146325019576, 96.029364596763031,
+	96.054546187370988, 96.079691203397317, 96.104799750932202, 96.129871935604939,
+	96.154907862586526, 96.17990763659239, 96.204871361884955, 96.229799142276264,
+	96.254691081130559, 96.279547281366902, 96.304367845461655, 96.329152875451058,
+	96.353902472933768, 96.378616739073294, 96.403295774600565, 96.427939679816248,
+	96.452548554593392, 96.4771224983797, 96.501661610199989, 96.526165988658619,
+	96.550635731941796, 96.575070937820016, 96.599471703650352, 96.623838126378814,
+	96.648170302542596, 96.672468328272487, 96.696732299295022, 96.720962310934851,
+	96.745158458116904, 96.769320835368688, 96.793449536822436, 96.817544656217393,
+	96.841606286901921, 96.865634521835688, 96.88962945359188, 96.91359117435924,
+	96.937519775944281, 96.961415349773389, 96.985277986894829, 97.009107777980958,
+	97.032904813330177, 97.056669182869072, 97.08040097615438, 97.104100282375072,
+	97.127767190354334, 97.151401788551567, 97.175004165064379, 97.198574407630545,
+	97.222112603629981, 97.245618840086664, 97.269093203670579, 97.292535780699637,
+	97.315946657141566, 97.339325918615828, 97.362673650395465, 97.385989937408979,
+	97.409274864242207, 97.43252851514012, 97.45575097400868, 97.478942324416664,
+	97.502102649597461, 97.525232032450845, 97.548330555544737, 97.571398301117085,
+	97.594435351077465, 97.617441787008971, 97.640417690169798, 97.663363141495125,
+	97.686278221598698, 97.709163010774603, 97.732017588998929, 97.754842035931418,
+	97.777636430917198, 97.800400852988361, 97.823135380865693, 97.845840092960188,
+	97.868515067374815, 97.891160381905991, 97.913776114045305, 97.93636234098102,
+	97.958919139599701, 97.981446586487749, 98.003944757932999, 98.026413729926233,
+	98.048853578162792, 98.071264378043992, 98.093646204678748, 98.115999132885023,
+	98.138323237191358, 98.160618591838343, 98.182885270780133, 98.205123347685856,
+	98.227332895941146, 98.249513988649568, 98.27166669863405, 98.293791098438305,
+	98.315887260328324, 98.337955256293696, 98.359995158049102, 98.382007037035663,
+	98.403990964422348, 98.425947011107326, 98.447875247719409, 98.469775744619326,
+	98.491648571901138, 98.513493799393572, 98.535311496661322, 98.557101733006434,
+	98.578864577469616, 98.600600098831478, 98.622308365613975, 98.643989446081548,
+	98.665643408242516, 98.687270319850342, 98.708870248404878, 98.730443261153596,
+	98.751989425092972, 98.773508806969573, 98.795001473281431, 98.816467490279194,
+	98.837906923967367, 98.859319840105556, 98.880706304209667, 98.902066381553098,
+	98.923400137167931, 98.944707635846157, 98.965988942140797, 98.987244120367109,
+	99.00847323460377, 99.029676348694025, 99.050853526246811, 99.072004830637923,
+	99.093130325011174, 99.114230072279483, 99.13530413512602, 99.156352576005332,
+	99.17737545714445, 99.198372840543954, 99.219344787979168, 99.240291361001127,
+	99.261212620937727, 99.282108628894832, 99.302979445757273, 99.323825132189967,
+	99.344645748638925, 99.365441355332393, 99.386212012281788, 99.406957779282806,
+	99.427678715916414, 99.448374881549952, 99.469046335338049, 99.489693136223707,
+	99.510315342939293, 99.530913014007552, 99.551486207742585, 99.572034982250813,
+	99.592559395432048, 99.613059504980384, 99.633535368385225, 99.653987042932215,
+	99.674414585704227, 99.694818053582281, 99.7151975032466, 99.735552991177371,
+	99.755884573655891, 99.77619230676531, 99.796476246391705, 99.816736448224944,
+	99.836972967759593, 99.857185860295829, 99.877375180940376, 99.897540984607389,
+	99.917683326019358, 99.937802259707951, 99.957897840015008, 99.977970121093279,
+	99.998019156907446, 100.01804500123487, 100.03804770766652, 100.05802732960785,
+	100.07798392027958, 100.09791753271863, 100.11782821977891, 100.1377160341322,
+	100.15758102826894, 100.1774232544991, 100.197242764953, 100.21703961158212,
+	100.2368138461599, 100.25656552028262, 100.27629468537012, 100.29600139266667,
+	100.31568569324173, 100.33534763799079, 100.35498727763607, 100.37460466272742,
+	100.39419984364301, 100.41377287059015, 100.43332379360604, 100.4528526625586,
+	100.47235952714709, 100.49184443690307, 100.51130744119095, 100.53074858920888,
+	100.55016792998948, 100.5695655124005, 100.58894138514563, 100.60829559676526,
+	100.62762819563707, 100.64693922997697, 100.6662287478396, 100.68549679711919,
+	100.70474342555028, 100.72396868070828, 100.74317261001039, 100.76235526071613,
+	100.78151667992807, 100.80065691459264, 100.81977601150065, 100.83887401728809,
+	100.8579509784368, 100.87700694127511, 100.89604195197853, 100.91505605657044,
+	100.93404930092272, 100.95302173075649, 100.97197339164266, 100.99090432900269,
+	101.00981458810915, 101.02870421408647, 101.04757325191153, 101.06642174641424,
+	101.08524974227834, 101.10405728404186, 101.12284441609788, 101.14161118269512,
+	101.16035762793851, 101.17908379578992, 101.19778973006866, 101.2164754744522,
+	101.23514107247669, 101.25378656753766, 101.27241200289055, 101.29101742165135,
+	101.30960286679719, 101.32816838116693, 101.34671400746177, 101.36523978824582,
+	101.38374576594668, 101.40223198285607, 101.42069848113034, 101.43914530279112,
+	101.45757248972583, 101.47598008368826, 101.49436812629922, 101.51273665904699,
+	101.53108572328793, 101.54941536024704, 101.56772561101857, 101.58601651656645,
+	101.60428811772493, 101.62254045519914, 101.64077356956554, 101.65898750127258,
+	101.67718229064116, 101.69535797786513, 101.71351460301196, 101.73165220602316,
+	101.74977082671481, 101.76787050477813, 101.78595127977999, 101.80401319116339,
+	101.82205627824806, 101.84008058023083, 101.85808613618633, 101.87607298506734,
+	101.89404116570537, 101.91199071681115, 101.9299216769751, 101.94783408466792,
+	101.96572797824095, 101.98360339592679, 102.0014603758397, 102.01929895597613,
+	102.03711917421521, 102.05492106831916, 102.07270467593393, 102.0904700345895,
+	102.10821718170047, 102.12594615456645, 102.14365699037263, 102.16134972619017,
+	102.17902439897668, 102.1966810455767, 102.21431970272215, 102.23194040703279,
+	102.24954319501671, 102.26712810307069, 102.28469516748076, 102.3022444244226,
+	102.31977590996195, 102.33728966005515, 102.35478571054949, 102.37226409718369,
+	102.38972485558833, 102.40716802128631, 102.42459362969326, 102.44200171611796,
+	102.4593923157628, 102.47676546372418, 102.49412119499296, 102.51145954445485,
+	102.52878054689087, 102.54608423697775, 102.56337064928833, 102.58063981829198,
+	102.59789177835509, 102.61512656374131, 102.63234420861215, 102.64954474702725,
+	102.66672821294483, 102.68389464022211, 102.70104406261571, 102.718176513782,
+	102.73529202727755, 102.75239063655948, 102.76947237498591, 102.78653727581629,
+	102.80358537221181, 102.82061669723583, 102.83763128385417, 102.85462916493559,
+	102.87161037325212, 102.88857494147945, 102.90552290219728, 102.92245428788976,
+},
+{
+	-HUGE_VAL, -5.0606308690541653, 6.9393691309458276, 13.958919139599701,
+	18.939369130945828, 22.802506269594176, 25.958919139599701, 28.62762819563708,
+	30.939369130945828, 32.978469148253573, 34.802506269594176, 36.452548554593392,
+	37.958919139599701, 39.344645748638932, 40.62762819563708, 41.822056278248048,
+	42.939369130945828, 43.988923225949897, 44.978469148253573, 45.91449929226885,
+	46.802506269594176, 47.647178204290952, 48.452548554593392, 49.222112603629981,
+	49.958919139599701, 50.665643408242524, 51.344645748638932, 51.998019156907446,
+	52.627628195637072, 53.235141072476694, 53.822056278248048, 54.389724855588327,
+	54.939369130945821, 55.472098563247265, 55.988923225949897, 56.490765334285427,
+	56.978469148253573, 57.452809518493225, 57.91449929226885, 58.364195757292805,
+	58.802506269594176, 59.229993186362833, 59.647178204290952, 60.054546187371002,
+	60.452548554593392, 60.841606286901921, 61.222112603629981, 61.594435351077479,
+	61.958919139599701, 62.315887260328324, 62.665643408242524, 63.00847323460377,
+	63.344645748638932, 63.674414585704213, 63.998019156907446, 64.315685693241747,
+	64.627628195637072, 64.934049300922723, 65.235141072476694, 65.531085723287916,
+	65.822056278248041, 66.108217181700468, 66.389724855588327, 66.666728212944818,
+	66.939369130945821, 67.20778288728728, 67.472098563247272, 67.732439416439092,
+	67.988923225949904, 68.241662612283861, 68.490765334285427, 68.736334565002011,
+	68.978469148253581, 69.217263837506039, 69.452809518493225, 69.685193416896396,
+	69.914499292268857, 70.140807619284644, 70.364195757292805, 70.584738109071068,
+	70.802506269594176, 71.017569165561326, 71.229993186362833, 71.439842307108918,
+	71.647178204290952, 71.852060364598245, 72.054546187371002, 72.254691081130559,
+	72.452548554593392, 72.648170302542596, 72.841606286901921, 73.032904813330177,
+	73.222112603629981, 73.409274864242207, 73.594435351077479, 73.777636430917198,
+	73.958919139599701, 74.138323237191358, 74.315887260328324, 74.491648571901138,
+	74.665643408242516, 74.837906923967367, 75.00847323460377, 75.17737545714445,
+	75.344645748638925, 75.510315342939293, 75.674414585704213, 75.836972967759593,
+	75.998019156907446, 76.157581028268936, 76.315685693241733, 76.472359527147091,
+	76.627628195637072, 76.781516679928075, 76.934049300922723, 77.085249742278336,
+	77.235141072476694, 77.383745765946685, 77.531085723287916, 77.677182290641142,
+	77.822056278248056, 77.965727978240963, 78.108217181700468, 78.249543195016699,
+	78.389724855588327, 78.528780546890872, 78.666728212944818, 78.803585372211813,
+	78.939369130945821, 79.074096196024868, 79.20778288728728, 79.340445149395222,
+	79.472098563247272, 79.602758356960095, 79.732439416439092, 79.861156295555787,
+	79.988923225949904, 80.115754126472154, 80.241662612283847, 80.366662003627908,
+	80.490765334285427, 80.613985359731345, 80.736334565002011, 80.857825172286496,
+	80.978469148253581, 81.098278211125034, 81.217263837506039, 81.335437268982204,
+	81.452809518493225, 81.569391376491765, 81.685193416896396, 81.80022600284677,
+	81.914499292268857, 82.02802324325765, 82.140807619284644, 82.252861994236667,
+	82.364195757292805, 82.474818117645356, 82.584738109071054, 82.693964594358093,
+	82.802506269594176, 82.910371668321233, 83.017569165561326, 83.124106981718754,
+	83.229993186362833, 83.335235701895613, 83.439842307108918, 83.543820640634451,
+	83.647178204290952, 83.749922366332044, 83.852060364598245, 83.953599309576603,
+	84.054546187371002, 84.154907862586526, 84.254691081130574, 84.353902472933768,
+	84.452548554593392, 84.550635731941796, 84.648170302542596, 84.745158458116904,
+	84.841606286901921, 84.937519775944295, 85.032904813330177, 85.127767190354334,
+	85.222112603629981, 85.315946657141566, 85.409274864242207, 85.502102649597461,
+	85.594435351077465, 85.686278221598698, 85.777636430917198, 85.868515067374815,
+	85.958919139599701, 86.048853578162792, 86.138323237191358, 86.227332895941146,
+	86.315887260328324, 86.403990964422348, 86.491648571901138, 86.578864577469616,
+	86.665643408242516, 86.751989425092972, 86.837906923967367, 86.923400137167945,
+	87.00847323460377, 87.093130325011174, 87.17737545714445, 87.261212620937727,
+	87.344645748638925, 87.427678715916414, 87.510315342939293, 87.592559395432048,
+	87.674414585704213, 87.755884573655891, 87.836972967759593, 87.917683326019358,
+	87.998019156907446, 88.077983920279578, 88.157581028268936, 88.236813846159905,
+	88.315685693241733, 88.394199843643008, 88.472359527147091, 88.550167929989485,
+	88.627628195637072, 88.704743425550276, 88.781516679928075, 88.857950978436804,
+	88.934049300922723, 89.009814588109151, 89.085249742278336, 89.160357627938509,
+	89.235141072476694, 89.309602866797192, 89.383745765946685, 89.45757248972582,
+	89.53108572328793, 89.604288117724934, 89.677182290641156, 89.749770826714808,
+	89.822056278248056, 89.894041165705374, 89.965727978240963, 90.037119174215206,
+	90.108217181700468, 90.179024398976679, 90.249543195016713, 90.319775909961962,
+	90.389724855588327, 90.459392315762798, 90.528780546890872, 90.597891778355091,
+	90.666728212944832, 90.735292027277552, 90.803585372211813, 90.871610373252125,
+	90.939369130945821, 91.006863721272367, 91.074096196024868, 91.141068583184477,
+	91.20778288728728, 91.274241089784439, 91.340445149395237, 91.406397002453446,
+	91.472098563247272, 91.537551724352568, 91.602758356960095, 91.667720311196476,
+	91.732439416439092, 91.796917481625314, 91.861156295555787, 91.925157627192277,
+	91.98892322594989, 92.052454821984057, 92.115754126472154, 92.178822831890088,
+	92.241662612283847, 92.304275123536087, 92.366662003627908, 92.428824872896087,
+	92.490765334285427, 92.552484973596933, 92.613985359731345, 92.675268044928416,
+	92.736334565002011, 92.797186439571078, 92.857825172286496, 92.918252251054085,
+	92.978469148253566, 93.038477320953973, 93.098278211125034, 93.157873245845224,
+	93.217263837506039, 93.276451384012802, 93.335437268982204, 93.394222861936271,
+	93.452809518493225, 93.511198580555018, 93.569391376491765, 93.627389221323085,
+	93.685193416896396, 93.742805252062254, 93.80022600284677, 93.857456932621233,
+	93.914499292268857, 93.971354320348809, 94.02802324325765, 94.084507275387978,
+	94.140807619284644, 94.196925465798316, 94.252861994236682, 94.308618372513052,
+	94.364195757292805, 94.419595294137252, 94.474818117645356, 94.529865351593173,
+	94.584738109071054, 94.639437492618711, 94.693964594358093, 94.748320496124251,
+	94.802506269594176, 94.856522976413459, 94.910371668321233, 94.964053387272926,
+	95.017569165561326, 95.070920025935635, 95.124106981718754, 95.177131036922816,
+	95.229993186362833, 95.282694415768731, 95.335235701895613, 95.38761801263243,
+	95.439842307108918, 95.491909535800971, 95.543820640634451, 95.595576555087447,
+	95.647178204290952, 95.698626505128118, 95.749922366332044, 95.801066688581955,
+	95.852060364598245, 95.902904279235898, 95.953599309576589, 96.004146325019576,
+	96.054546187370988, 96.104799750932202, 96.154907862586526, 96.204871361884955,
+	96.254691081130559, 96.304367845461655, 96.353902472933768, 96.403295774600565,
+	96.452548554593392, 96.501661610199989, 96.550635731941796, 96.599471703650352,
+	96.648170302542596, 96.696732299295022, 96.745158458116904, 96.793449536822436,
+	96.841606286901921, 96.88962945359188, 96.937519775944281, 96.985277986894829,
+	97.032904813330177, 97.08040097615438, 97.127767190354334, 97.175004165064379,
+	97.222112603629981, 97.269093203670579, 97.315946657141566, 97.362673650395465,
+	97.409274864242207, 97.45575097400868, 97.502102649597461, 97.548330555544737,
+	97.594435351077465, 97.640417690169798, 97.686278221598698, 97.732017588998929,
+	97.777636430917198, 97.823135380865693, 97.868515067374815, 97.913776114045305,
+	97.958919139599701, 98.003944757932999, 98.048853578162792, 98.093646204678748,
+	98.138323237191358, 98.182885270780133, 98.227332895941146, 98.27166669863405,
+	98.315887260328324, 98.359995158049102, 98.403990964422348, 98.447875247719409,
+	98.491648571901138, 98.535311496661322, 98.578864577469616, 98.622308365613975,
+	98.665643408242516, 98.708870248404878, 98.751989425092972, 98.795001473281431,
+	98.837906923967367, 98.880706304209667, 98.923400137167931, 98.965988942140797,
+	99.00847323460377, 99.050853526246811, 99.093130325011174, 99.13530413512602,
+	99.17737545714445, 99.219344787979168, 99.261212620937727, 99.302979445757273,
+	99.344645748638925, 99.386212012281788, 99.427678715916414, 99.469046335338049,
+	99.510315342939293, 99.551486207742585, 99.592559395432048, 99.633535368385225,
+	99.674414585704227, 99.7151975032466, 99.755884573655891, 99.796476246391705,
+	99.836972967759593, 99.877375180940376, 99.917683326019358, 99.957897840015008,
+	99.998019156907446, 100.03804770766652, 100.07798392027958, 100.11782821977891,
+	100.15758102826894, 100.197242764953, 100.2368138461599, 100.27629468537012,
+	100.31568569324173, 100.35498727763607, 100.39419984364301, 100.43332379360604,
+	100.47235952714709, 100.51130744119095, 100.55016792998948, 100.58894138514563,
+	100.62762819563707, 100.6662287478396, 100.70474342555028, 100.74317261001039,
+	100.78151667992807, 100.81977601150065, 100.8579509784368, 100.89604195197853,
+	100.93404930092272, 100.97197339164266, 101.00981458810915, 101.04757325191153,
+	101.08524974227834, 101.12284441609788, 101.16035762793851, 101.19778973006866,
+	101.23514107247669, 101.27241200289055, 101.30960286679719, 101.34671400746177,
+	101.38374576594668, 101.42069848113034, 101.45757248972583, 101.49436812629922,
+	101.53108572328793, 101.56772561101857, 101.60428811772493, 101.64077356956554,
+	101.67718229064116, 101.71351460301196, 101.74977082671481, 101.78595127977999,
+	101.82205627824806, 101.85808613618633, 101.89404116570537, 101.9299216769751,
+	101.96572797824095, 102.0014603758397, 102.03711917421521, 102.07270467593393,
+	102.10821718170047, 102.14365699037263, 102.17902439897668, 102.21431970272215,
+	102.24954319501671, 102.28469516748076, 102.31977590996195, 102.35478571054949,
+	102.38972485558833, 102.42459362969326, 102.4593923157628, 102.49412119499296,
+	102.52878054689087, 102.56337064928833, 102.59789177835509, 102.63234420861215,
+	102.66672821294483, 102.70104406261571, 102.73529202727755, 102.76947237498591,
+	102.80358537221181, 102.83763128385417, 102.87161037325212, 102.90552290219728,
+	102.93936913094583, 102.97314931823047, 103.00686372127237, 103.04051259579279,
+	103.07409619602487, 103.10761477472505, 103.14106858318448, 103.17445787124039,
+	103.20778288728728, 103.24104387828793, 103.27424108978444, 103.30737476590912,
+	103.34044514939524, 103.37345248158765, 103.40639700245345, 103.43927895059241,
+	103.47209856324727, 103.50485607631413, 103.53755172435257, 103.57018574059566,
+	103.60275835696009, 103.63526980405594, 103.66772031119648, 103.70011010640793,
+	103.73243941643909, 103.76470846677077, 103.79691748162531, 103.8290666839759,
+	103.8611562955558, 103.8931865368676, 103.92515762719228, 103.95706978459816,
+	103.98892322594989, 104.02071816691729, 104.05245482198406, 104.08413340445651,
+	104.11575412647214, 104.1473171990082, 104.17882283189009, 104.21027123379972,
+	104.24166261228385, 104.27299717376231, 104.30427512353609, 104.33549666579545,
+	104.36666200362791, 104.39777133902621, 104.42882487289609, 104.45982280506411,
+	104.49076533428543, 104.52165265825134, 104.55248497359693, 104.58326247590858,
+	104.61398535973134, 104.64465381857643, 104.6752680449284, 104.70582823025258,
+	104.73633456500201, 104.7667872386248, 104.79718643957108, 104.82753235529994,
+	104.8578251722865, 104.88806507602868, 104.91825225105407, 104.94838688092668,
+	104.97846914825357, 105.00849923469161, 105.03847732095397, 105.06840358681666,
+	105.09827821112503, 105.12810137180017, 105.15787324584522, 105.18759400935178,
+	105.21726383750604, 105.24688290459503, 105.2764513840128, 105.30596944826645,
+	105.3354372689822, 105.36485501691135, 105.39422286193627, 105.42354097307621,
+	105.45280951849323, 105.48202866549786, 105.51119858055502, 105.5403194292895,
+	105.56939137649177, 105.59841458612348, 105.62738922132309, 105.65631544441126,
+	105.6851934168964, 105.71402329948005, 105.74280525206225, 105.77153943374685,
+	105.80022600284677, 105.82886511688932, 105.85745693262123, 105.88600160601402,
+	105.91449929226886, 105.94295014582181, 105.97135432034881, 105.99971196877058,
+	106.02802324325765, 106.05628829523521, 106.08450727538798, 106.11268033366505,
+	106.14080761928464, 106.16888928073885, 106.19692546579832, 106.224916321517,
+	106.25286199423668, 106.28076262959161, 106.30861837251305, 106.33642936723385,
+	106.3641957572928, 106.39191768553923, 106.41959529413725, 106.44722872457029,
+	106.47481811764536, 106.50236361349729, 106.52986535159317, 106.55732347073641,
+	106.58473810907105, 106.61210940408591, 106.63943749261871, 106.66672251086017,
+	106.69396459435809, 106.72116387802143, 106.74832049612425, 106.77543458230976,
+	106.80250626959418, 106.82953569037072, 106.85652297641346, 106.88346825888119,
+	106.91037166832123, 106.93723333467322, 106.96405338727293, 106.99083195485591,
+	107.01756916556133, 107.04426514693549, 107.07092002593564, 107.09753392893344,
+	107.12410698171875, 107.15063930950299, 107.17713103692282, 107.20358228804358,
+	107.22999318636283, 107.25636385481377, 107.28269441576873, 107.30898499104245,
+	107.33523570189561, 107.36144666903813, 107.38761801263243, 107.41374985229687,
+	107.43984230710892, 107.46589549560845, 107.49190953580097, 107.51788454516085,
+	107.54382064063445, 107.56971793864335, 107.59557655508745, 107.62139660534802,
+	107.64717820429095, 107.67292146626963, 107.69862650512812, 107.72429343420414,
+	107.74992236633204, 107.77551341384579, 107.80106668858195, 107.82658230188261,
+	107.85206036459824, 107.87750098709068, 107.9029042792359, 107.92827035042691,
+	107.95359930957659, 107.9788912651205, 108.00414632501958, 108.02936459676303,
+	108.05454618737099, 108.07969120339732, 108.1047997509322, 108.12987193560494,
+	108.15490786258653, 108.17990763659239, 108.20487136188495, 108.22979914227626,
+	108.25469108113056, 108.2795472813669, 108.30436784546166, 108.32915287545106,
+	108.35390247293377, 108.37861673907329, 108.40329577460056, 108.42793967981625,
+	108.45254855459339, 108.4771224983797, 108.50166161019999, 108.52616598865862,
+	108.5506357319418, 108.57507093782002, 108.59947170365035, 108.62383812637881,
+	108.6481703025426, 108.67246832827249, 108.69673229929502, 108.72096231093485,
+	108.7451584581169, 108.76932083536869, 108.79344953682244, 108.81754465621739,
+	108.84160628690192, 108.86563452183569, 108.88962945359188, 108.91359117435924,
+	108.93751977594428, 108.96141534977339, 108.98527798689483, 109.00910777798096,
+	109.03290481333018, 109.05666918286907, 109.08040097615438, 109.10410028237507,
+	109.12776719035433, 109.15140178855157, 109.17500416506438, 109.19857440763055,
+	109.22211260362998, 109.24561884008666, 109.26909320367058, 109.29253578069964,
+	109.31594665714157, 109.33932591861583, 109.36267365039546, 109.38598993740898,
+	109.40927486424221, 109.43252851514012, 109.45575097400868, 109.47894232441666,
+	109.50210264959746, 109.52523203245084, 109.54833055554474, 109.57139830111709,
+	109.59443535107746, 109.61744178700897, 109.6404176901698, 109.66336314149513,
+	109.6862782215987, 109.7091630107746, 109.73201758899893, 109.75484203593142,
+	109.7776364309172, 109.80040085298836, 109.82313538086569, 109.84584009296019,
+	109.86851506737482, 109.89116038190599, 109.91377611404531, 109.93636234098102,
+	109.9589191395997, 109.98144658648775, 110.003944757933, 110.02641372992623,
+	110.04885357816279, 110.07126437804399, 110.09364620467875, 110.11599913288502,
+	110.13832323719136, 110.16061859183834, 110.18288527078013, 110.20512334768586,
+	110.22733289594115, 110.24951398864957, 110.27166669863405, 110.29379109843831,
+	110.31588726032832, 110.3379552562937, 110.3599951580491, 110.38200703703566,
+	110.40399096442235, 110.42594701110733, 110.44787524771941, 110.46977574461933,
+	110.49164857190114, 110.51349379939357, 110.53531149666132, 110.55710173300643,
+	110.57886457746962, 110.60060009883148, 110.62230836561397, 110.64398944608155,
+	110.66564340824252, 110.68727031985034, 110.70887024840488, 110.7304432611536,
+	110.75198942509297, 110.77350880696957, 110.79500147328143, 110.81646749027919,
+	110.83790692396737, 110.85931984010556, 110.88070630420967, 110.9020663815531,
+	110.92340013716793, 110.94470763584616, 110.9659889421408, 110.98724412036711,
+	111.00847323460377, 111.02967634869403, 111.05085352624681, 111.07200483063792,
+	111.09313032501117, 111.11423007227948, 111.13530413512602, 111.15635257600533,
+	111.17737545714445, 111.19837284054395, 111.21934478797917, 111.24029136100113,
+	111.26121262093773, 111.28210862889483, 111.30297944575727, 111.32382513218997,
+	111.34464574863892, 111.36544135533239, 111.38621201228179, 111.40695777928281,
+	111.42767871591641, 111.44837488154995, 111.46904633533805, 111.48969313622371,
+	111.51031534293929, 111.53091301400755, 111.55148620774258, 111.57203498225081,
+	111.59255939543205, 111.61305950498038, 111.63353536838522, 111.65398704293221,
+	111.67441458570423, 111.69481805358228, 111.7151975032466, 111.73555299117737,
+	111.75588457365589, 111.77619230676531, 111.79647624639171, 111.81673644822494,
+	111.83697296775959, 111.85718586029583, 111.87737518094038, 111.89754098460739,
+	111.91768332601936, 111.93780225970795, 111.95789784001501, 111.97797012109328,
+	111.99801915690745, 112.01804500123487, 112.03804770766652, 112.05802732960785,
+	112.07798392027958, 112.09791753271863, 112.11782821977891, 112.1377160341322,
+	112.15758102826894, 112.1774232544991, 112.197242764953, 112.21703961158212,
+	112.2368138461599, 112.25656552028262, 112.27629468537012, 112.29600139266667,
+	112.31568569324173, 112.33534763799079, 112.35498727763607, 112.37460466272742,
+	112.39419984364301, 112.41377287059015, 112.43332379360604, 112.4528526625586,
+	112.47235952714709, 112.49184443690307, 112.51130744119095, 112.53074858920888,
+	112.55016792998948, 112.5695655124005, 112.58894138514563, 112.60829559676526,
+	112.62762819563707, 112.64693922997697, 112.6662287478396, 112.68549679711919,
+	112.70474342555028, 112.72396868070828, 112.74317261001039, 112.76235526071613,
+	112.78151667992807, 112.80065691459264, 112.81977601150065, 112.83887401728809,
+	112.8579509784368, 112.87700694127511, 112.89604195197853, 112.91505605657044,
+	112.93404930092272, 112.95302173075649, 112.97197339164266, 112.99090432900269,
+	113.00981458810915, 113.02870421408647, 113.04757325191153, 113.06642174641424,
+	113.08524974227834, 113.10405728404186, 113.12284441609788, 113.14161118269512,
+	113.16035762793851, 113.17908379578992, 113.19778973006866, 113.2164754744522,
+	113.23514107247669, 113.25378656753766, 113.27241200289055, 113.29101742165135,
+	113.30960286679719, 113.32816838116693, 113.34671400746177, 113.36523978824582,
+	113.38374576594668, 113.40223198285607, 113.42069848113034, 113.43914530279112,
+	113.45757248972583, 113.47598008368826, 113.49436812629922, 113.51273665904699,
+	113.53108572328793, 113.54941536024704, 113.56772561101857, 113.58601651656645,
+	113.60428811772493, 113.62254045519914, 113.64077356956554, 113.65898750127258,
+	113.67718229064116, 113.69535797786513, 113.71351460301196, 113.73165220602316,
+	113.74977082671481, 113.76787050477813, 113.78595127977999, 113.80401319116339,
+	113.82205627824806, 113.84008058023083, 113.85808613618633, 113.87607298506734,
+	113.89404116570537, 113.91199071681115, 113.9299216769751, 113.94783408466792,
+	113.96572797824095, 113.98360339592679, 114.0014603758397, 114.01929895597613,
+	114.03711917421521, 114.05492106831916, 114.07270467593393, 114.0904700345895,
+	114.10821718170047, 114.12594615456645, 114.14365699037263, 114.16134972619017,
+	114.17902439897668, 114.1966810455767, 114.21431970272215, 114.23194040703279,
+	114.24954319501671, 114.26712810307069, 114.28469516748076, 114.3022444244226,
+	114.31977590996195, 114.33728966005515, 114.35478571054949, 114.37226409718369,
+	114.38972485558833, 114.40716802128631, 114.42459362969326, 114.44200171611796,
+	114.4593923157628, 114.47676546372418, 114.49412119499296, 114.51145954445485,
+	114.52878054689087, 114.54608423697775, 114.56337064928833, 114.58063981829198,
+	114.59789177835509, 114.61512656374131, 114.63234420861215, 114.64954474702725,
+	114.66672821294483, 114.68389464022211, 114.70104406261571, 114.718176513782,
+	114.73529202727755, 114.75239063655948, 114.76947237498591, 114.78653727581629,
+	114.80358537221181, 114.82061669723583, 114.83763128385417, 114.85462916493559,
+	114.87161037325212, 114.88857494147945, 114.90552290219728, 114.92245428788976,
+},
+};
+
+#endif
@@ -0,0 +1,63 @@
+//
+// gen_freqtable.cpp
+//
+// Generate freqtable.h, the precalculated OPL frequency -> MIDI key tables for
+// the two standard conversion constants (see ConversionContext::freq2key() in
+// libdro2midi.hpp.)
+//
+//   $ make freqtable.h
+//
+// The formula here must be kept identical to calcFreqKey() in libdro2midi.cpp,
+// otherwise conversions will come out differently depending on whether the
+// conversion constant is a standard one or not.
+//
+
+#include <math.h>
+#include <stdio.h>
+
+#ifdef _MSC_VER
+// Keep MS VC++ happy
+#define log2(x) (log(x) / log(2.))
+#endif
+
+double calcfreqkey(double dbConversionVal, int iFNum, int iBlock)
+{
+	double dbOriginalFreq = dbConversionVal * (double)iFNum * pow(2, (double)(iBlock - 20));
+	return 69.0 + 12.0 * log2(dbOriginalFreq / 440.0);
+}
+
+void table(const char* name, double dbConversionVal)
+{
+	printf("const double %s[8][1024] = {\n", name);
+	for (int iBlock = 0; iBlock < 8; iBlock++) {
+		printf("{");
+		for (int iFNum = 0; iFNum < 1024; iFNum++) {
+			printf(((iFNum % 4) == 0) ? "\n\t" : " ");
+			double key = calcfreqkey(dbConversionVal, iFNum, iBlock);
+			if (isinf(key)) printf("-HUGE_VAL,"); // F-num of zero
+			else printf("%.17g,", key);
+		}
+		printf("\n},\n");
+	}
+	printf("};\n\n");
+}
+
+int main(int argc, char**argv)
+{
+	printf("// Generated by gen_freqtable.cpp - do not edit\n"
+		"//\n"
+		"// To regenerate it after changing the formula: make freqtable.h\n"
+		"//\n"
+		"// MIDI key number (with fraction) for each OPL block and F-number, as\n"
+		"// freqtable_X[block][fnum], for the conversion constant X.\n"
+		"\n"
+		"#ifndef __FREQTABLE__\n"
+		"#define __FREQTABLE__\n"
+		"\n"
+		"#include <math.h>\n"
+		"\n");
+	table("freqtable_49716", 49716.0);
+	table("freqtable_50000", 50000.0);
+	printf("#endif\n");
+	return 0;
+}
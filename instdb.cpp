@@ -0,0 +1,487 @@
+// instdb.cpp - list of known instruments and matching against it
+#include "instdb.hpp"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+// Round up to the start of the next section in a compiled list
+#define INSTDB_ALIGN(x)  (((x) + 15) & ~(uint64_t)15)
+
+InstrumentDB::InstrumentDB()
+{
+  block_ = 0;
+  blockcount_ = imageblocks_ = 0;
+  hash_ = 0;
+  node_ = 0;
+  stack_ = 0;
+  clear();
+}
+
+void InstrumentDB::setbase(const InstrumentDB* base)
+{
+  clear();
+  base_ = base;
+  basecount_ = base->count();
+  growstack(base->nodecount_);
+}
+
+InstrumentDB::~InstrumentDB()
+{
+  clear();
+}
+
+// Empty the list
+void InstrumentDB::clear()
+{
+  // Blocks inside a loaded file weren't allocated separately
+  for (int b = imageblocks_; b < blockcount_; b++) delete block_[b];
+  delete[] block_;
+  delete[] hash_;
+  delete[] node_;
+  delete[] stack_;
+  image_.close();
+  block_ = 0;
+  blockcount_ = blocksize_ = 0;
+  imageblocks_ = 0;
+  count_ = 0;
+  hash_ = 0;
+  hashsize_ = 0;
+  hashcount_ = 0;
+  node_ = 0;
+  nodecount_ = nodesize_ = 0;
+  for (int t = 0; t < IVSET_COUNT; t++) root_[t] = -1;
+  stack_ = 0;
+  stacksize_ = 0;
+  base_ = 0;
+  basecount_ = 0;
+}
+
+int InstrumentDB::regset(int type)
+{
+  switch (type)
+  {
+    case TomTom:
+    case HiHat:
+      return IVSET_MODULATOR;
+    case SnareDrum:
+    case TopCymbal:
+      return IVSET_CARRIER;
+    default:
+      return IVSET_BOTH;
+  }
+}
+
+int InstrumentDB::add(const unsigned char* regs, const INSTRINFO& info)
+{
+  if (count_ == blockcount_ * INSTDB_BLOCK)
+  {
+    if (blockcount_ == blocksize_)
+    {
+      blocksize_ = blocksize_ ? blocksize_ * 2 : 16;
+      BLOCK** old = block_;
+      block_ = new BLOCK*[blocksize_];
+      if (old) memcpy(block_, old, blockcount_ * sizeof(BLOCK*));
+      delete[] old;
+    }
+    block_[blockcount_] = new BLOCK;
+    memset(block_[blockcount_++], 0, sizeof(BLOCK));
+  }
+  int i = count_++;
+  memcpy(block_[i / INSTDB_BLOCK]->regs[i % INSTDB_BLOCK], regs, INSTVEC_LEN);
+  block_[i / INSTDB_BLOCK]->info[i % INSTDB_BLOCK] = info;
+  i += basecount_;
+  addtohash(i);
+  addtotrees(i);
+  return i;
+}
+
+unsigned long InstrumentDB::memused(bool base) const
+{
+  return blockcount_ * sizeof(BLOCK) + blocksize_ * sizeof(BLOCK*)
+    + hashsize_ * sizeof(int)
+    + nodesize_ * sizeof(NODE) + stacksize_ * sizeof(SEARCH)
+    + ((base && base_) ? base_->memused() : 0);
+}
+
+// Keep only the bytes compared for this type of instrument.  Two instruments
+// have a difference of zero exactly when their keys are equal.
+void InstrumentDB::makekey(const unsigned char* regs, unsigned char* key) const
+{
+  const unsigned char* weight = instvecweight[regset(regs[IV_TYPE])];
+  for (int j = 0; j < INSTVEC_LEN; j++) key[j] = weight[j] ? regs[j] : 0;
+}
+
+// Return the slot in hash_ holding the instrument matching key, or the empty
+// slot where it should go.
+unsigned int InstrumentDB::findslot(const unsigned char* key) const
+{
+  unsigned int h = 2166136261u; // FNV-1a
+  for (int j = 0; j < INSTVEC_LEN; j++)
+  {
+    h ^= key[j];
+    h *= 16777619u;
+  }
+  unsigned char other[INSTVEC_LEN];
+  unsigned int slot = h & (hashsize_ - 1);
+  while (hash_[slot] >= 0)
+  {
+    makekey(regs(hash_[slot]), other);
+    if (memcmp(key, other, INSTVEC_LEN) == 0) break;
+    slot = (slot + 1) & (hashsize_ - 1);
+  }
+  return slot;
+}
+
+// Add instrument i to the hash table, unless an earlier one already matches
+void InstrumentDB::addtohash(int i)
+{
+  unsigned char key[INSTVEC_LEN];
+  if ((unsigned int)(hashcount_ + 1) * 2 > hashsize_)
+  {
+    // Keep the table at most half full
+    int* old = hash_;
+    unsigned int oldsize = hashsize_;
+    hashsize_ = oldsize ? oldsize * 2 : 256;
+    hash_ = new int[hashsize_];
+    for (unsigned int s = 0; s < hashsize_; s++) hash_[s] = -1;
+    for (unsigned int s = 0; s < oldsize; s++)
+    {
+      if (old[s] < 0) continue;
+      makekey(regs(old[s]), key);
+      hash_[findslot(key)] = old[s];
+    }
+    delete[] old;
+  }
+  makekey(regs(i), key);
+  unsigned int slot = findslot(key);
+  if (hash_[slot] < 0)
+  {
+    hash_[slot] = i;
+    hashcount_++;
+  }
+}
+
+int InstrumentDB::find(const unsigned char* query) const
+{
+  if (base_)
+  {
+    int i = base_->find(query);
+    if (i >= 0) return i;
+  }
+  if (!hashsize_) return -1;
+  unsigned char key[INSTVEC_LEN];
+  makekey(query, key);
+  return hash_[findslot(key)];
+}
+
+// instvecdistance() is a weighted L1 distance, so for each of the three sets
+// of registers it can compare there is a BK-tree holding every instrument (an
+// instrument of one type can be the closest match for another, it just has a
+// penalty for the type difference.)  Each child hangs off its parent by its
+// distance from it, so by the triangle inequality only children whose
+// distance is within the best match so far of the query's distance from the
+// parent need to be searched.
+//
+// Instruments identical (in the registers the tree compares) to one already
+// in it aren't added, as the earlier one will always win a tie anyway.
+int InstrumentDB::newnode(int i, long dist)
+{
+  if (nodecount_ == nodesize_)
+  {
+    nodesize_ = nodesize_ ? nodesize_ * 2 : 256;
+    NODE* old = node_;
+    node_ = new NODE[nodesize_];
+    if (old) memcpy(node_, old, nodecount_ * sizeof(NODE));
+    delete[] old;
+    growstack(nodesize_);
+  }
+  NODE& n = node_[nodecount_];
+  n.instr = i;
+  n.dist = dist;
+  n.child = -1;
+  n.next = -1;
+  return nodecount_++;
+}
+
+void InstrumentDB::addtotrees(int i)
+{
+  for (int t = 0; t < IVSET_COUNT; t++)
+  {
+    if (root_[t] < 0)
+    {
+      root_[t] = newnode(i, 0);
+      continue;
+    }
+    int n = root_[t];
+    for (;;)
+    {
+      long dist = instvecdistance(regs(node_[n].instr), regs(i), t);
+      if (dist == 0) break; // already have an identical one
+      int c = node_[n].child;
+      while ((c >= 0) && (node_[c].dist != dist)) c = node_[c].next;
+      if (c < 0)
+      {
+        c = newnode(i, dist);
+        node_[c].next = node_[n].child;
+        node_[n].child = c;
+        break;
+      }
+      n = c;
+    }
+  }
+}
+
+// Make sure stack_ has room for at least size entries
+void InstrumentDB::growstack(int size)
+{
+  if (size <= stacksize_) return;
+  delete[] stack_;
+  stack_ = new SEARCH[size];
+  stacksize_ = size;
+}
+
+int InstrumentDB::nearest(const unsigned char* query, long* diff)
+{
+  int besti = search(query, diff, stack_);
+  if (base_)
+  {
+    // Anything in the base list comes first, so it wins a tie
+    long basediff;
+    int basei = base_->search(query, &basediff, stack_);
+    if ((basei >= 0) && ((besti < 0) || (basediff <= *diff)))
+    {
+      besti = basei;
+      *diff = basediff;
+    }
+  }
+  return besti;
+}
+
+// Search this list's own trees (not the base's) for nearest(), using stack
+// for the nodes waiting to be visited.
+int InstrumentDB::search(const unsigned char* query, long* diff,
+  SEARCH* stack) const
+{
+  int t = regset(query[IV_TYPE]);
+  int besti = -1;
+  *diff = -1;
+  if (root_[t] < 0) return -1;
+
+  // Each node waiting to be searched is stacked along with the least
+  // distance anything below it can be from the query, so it can be skipped
+  // if a closer match has turned up by the time it's reached.
+  int sp = 0;
+  stack[sp].node = root_[t];
+  stack[sp++].bound = 0;
+  while (sp > 0)
+  {
+    sp--;
+    if ((besti >= 0) && (stack[sp].bound > *diff)) continue;
+    const NODE& n = node_[stack[sp].node];
+    long dist = instvecdistance(regs(n.instr), query, t);
+    if ((besti < 0) || (dist < *diff) || ((dist == *diff) && (n.instr < besti)))
+    {
+      *diff = dist;
+      besti = n.instr;
+    }
+    for (int c = n.child; c >= 0; c = node_[c].next)
+    {
+      long bound = labs(node_[c].dist - dist);
+      if (bound <= *diff)
+      {
+        stack[sp].node = c;
+        stack[sp++].bound = bound;
+      }
+    }
+  }
+  return besti;
+}
+
+bool InstrumentDB::save(const char* filename, const uint64_t* source)
+{
+  HEADER hdr;
+  memset(&hdr, 0, sizeof(hdr));
+  memcpy(hdr.sig, INSTDB_SIG, sizeof(hdr.sig));
+  hdr.version = INSTDB_VERSION;
+  hdr.layout[0] = sizeof(HEADER);
+  hdr.layout[1] = sizeof(BLOCK);
+  hdr.layout[2] = sizeof(int);
+  hdr.layout[3] = sizeof(NODE);
+  memcpy(hdr.source, source, sizeof(hdr.source));
+  hdr.count = count_;
+  hdr.blockcount = blockcount_;
+  hdr.hashsize = hashsize_;
+  hdr.hashcount = hashcount_;
+  hdr.nodecount = nodecount_;
+  for (int t = 0; t < IVSET_COUNT; t++) hdr.root[t] = root_[t];
+
+  FILE* f = fopen(filename, "wb");
+  if (!f) return false;
+  static const char pad[16] = {0};
+  unsigned long len = sizeof(hdr);
+  bool ok = fwrite(&hdr, len, 1, f) == 1;
+  ok = ok && (fwrite(pad, 1, INSTDB_ALIGN(len) - len, f) == INSTDB_ALIGN(len) - len);
+  for (int b = 0; b < blockcount_; b++)
+  {
+    ok = ok && (fwrite(block_[b], sizeof(BLOCK), 1, f) == 1);
+  }
+  len = blockcount_ * sizeof(BLOCK);
+  ok = ok && (fwrite(pad, 1, INSTDB_ALIGN(len) - len, f) == INSTDB_ALIGN(len) - len);
+  len = hashsize_ * sizeof(int);
+  ok = ok && (fwrite(hash_, 1, len, f) == len);
+  ok = ok && (fwrite(pad, 1, INSTDB_ALIGN(len) - len, f) == INSTDB_ALIGN(len) - len);
+  len = nodecount_ * sizeof(NODE);
+  ok = ok && (fwrite(node_, 1, len, f) == len);
+  if (fclose(f) != 0) ok = false;
+  return ok;
+}
+
+int InstrumentDB::load(const char* filename, const uint64_t* source)
+{
+  clear();
+  if (!image_.open(filename)) return INSTDB_MISSING;
+
+  HEADER hdr;
+  const unsigned char* data = image_.peek();
+  uint64_t len = image_.size();
+  if (len < sizeof(hdr))
+  {
+    clear();
+    return INSTDB_INVALID;
+  }
+  memcpy(&hdr, data, sizeof(hdr));
+  if (
+    (memcmp(hdr.sig, INSTDB_SIG, sizeof(hdr.sig)) != 0) ||
+    (hdr.version != INSTDB_VERSION) ||
+    (hdr.layout[0] != sizeof(HEADER)) ||
+    (hdr.layout[1] != sizeof(BLOCK)) ||
+    (hdr.layout[2] != sizeof(int)) ||
+    (hdr.layout[3] != sizeof(NODE))
+  )
+  {
+    clear();
+    return INSTDB_INVALID;
+  }
+  if (memcmp(hdr.source, source, sizeof(hdr.source)) != 0)
+  {
+    clear();
+    return INSTDB_STALE;
+  }
+
+  // Make sure everything is where it should be before using any of it, so a
+  // damaged file can't send anything out of bounds or leave a lookup going
+  // round in circles
+  uint64_t blockoff = INSTDB_ALIGN(sizeof(HEADER));
+  uint64_t hashoff = blockoff + INSTDB_ALIGN((uint64_t)hdr.blockcount * sizeof(BLOCK));
+  uint64_t nodeoff = hashoff + INSTDB_ALIGN((uint64_t)hdr.hashsize * sizeof(int));
+  uint64_t end = nodeoff + (uint64_t)hdr.nodecount * sizeof(NODE);
+  bool valid = (end <= len) &&
+    ((uint64_t)hdr.blockcount * INSTDB_BLOCK >= hdr.count) &&
+    ((uint64_t)hdr.blockcount * INSTDB_BLOCK < (uint64_t)hdr.count + INSTDB_BLOCK) &&
+    (hdr.count <= 0x7FFFFFFF) &&
+    ((hdr.hashsize & (hdr.hashsize - 1)) == 0) &&
+    (hdr.hashcount * 2 <= (uint64_t)hdr.hashsize) &&
+    (hdr.nodecount <= 0x7FFFFFFF);
+  const int* hash = (const int*)(data + hashoff);
+  const NODE* node = (const NODE*)(data + nodeoff);
+  BLOCK* blocks = (BLOCK*)(data + blockoff);
+  for (uint32_t i = 0; valid && (i < hdr.count); i++)
+  {
+    // A redirect always points back to an earlier instrument, so following
+    // them can't loop
+    const INSTRINFO& in = blocks[i / INSTDB_BLOCK].info[i % INSTDB_BLOCK];
+    valid = (in.redirect >= -1) && (in.redirect < (int)i) &&
+      (memchr(in.name, '\0', sizeof(in.name)) != 0) &&
+      (in.isdrum ? (in.note >= 0) && (in.note <= 127)
+        : (in.prog >= 0) && (in.prog <= 127));
+  }
+  // findslot() needs an empty slot to stop at, and the table is kept at most
+  // half full
+  uint32_t used = 0;
+  for (uint32_t s = 0; valid && (s < hdr.hashsize); s++)
+  {
+    valid = (hash[s] >= -1) && (hash[s] < (int)hdr.count);
+    if (hash[s] >= 0) used++;
+  }
+  valid = valid && (used == hdr.hashcount);
+  for (uint32_t n = 0; valid && (n < hdr.nodecount); n++)
+  {
+    valid = (node[n].instr >= 0) && (node[n].instr < (int)hdr.count) &&
+      (node[n].child >= -1) && (node[n].child < (int)hdr.nodecount) &&
+      (node[n].next >= -1) && (node[n].next < (int)hdr.nodecount);
+  }
+  for (int t = 0; valid && (t < IVSET_COUNT); t++)
+  {
+    valid = (hdr.root[t] >= -1) && (hdr.root[t] < (int)hdr.nodecount);
+  }
+  if (valid && hdr.nodecount)
+  {
+    // No node can be reached more than once going down from the roots, or
+    // search() could loop forever or overflow stack_ (which has one entry
+    // per node)
+    unsigned char* seen = new unsigned char[hdr.nodecount];
+    int* todo = new int[hdr.nodecount];
+    memset(seen, 0, hdr.nodecount);
+    int sp = 0;
+    for (int t = 0; valid && (t < IVSET_COUNT); t++)
+    {
+      int r = hdr.root[t];
+      if (r < 0) continue;
+      valid = !seen[r];
+      seen[r] = 1;
+      todo[sp++] = r;
+      while (valid && (sp > 0))
+      {
+        for (int c = node[todo[--sp]].child; valid && (c >= 0); c = node[c].next)
+        {
+          valid = !seen[c];
+          seen[c] = 1;
+          todo[sp++] = c;
+        }
+      }
+    }
+    delete[] seen;
+    delete[] todo;
+  }
+  if (!valid)
+  {
+    clear();
+    return INSTDB_INVALID;
+  }
+
+  // Full blocks are used straight from the file.  The last one will have
+  // more instruments added to it, so it's copied.
+  blocksize_ = 16;
+  while (blocksize_ < (int)hdr.blockcount) blocksize_ *= 2;
+  block_ = new BLOCK*[blocksize_];
+  imageblocks_ = hdr.count / INSTDB_BLOCK;
+  for (blockcount_ = 0; blockcount_ < imageblocks_; blockcount_++)
+  {
+    block_[blockcount_] = &blocks[blockcount_];
+  }
+  if (blockcount_ < (int)hdr.blockcount)
+  {
+    block_[blockcount_] = new BLOCK;
+    memcpy(block_[blockcount_], &blocks[blockcount_], sizeof(BLOCK));
+    blockcount_++;
+  }
+  count_ = hdr.count;
+
+  // The indices are updated as instruments are added, so they're copied too
+  if (hdr.hashsize)
+  {
+    hashsize_ = hdr.hashsize;
+    hashcount_ = hdr.hashcount;
+    hash_ = new int[hashsize_];
+    memcpy(hash_, hash, hashsize_ * sizeof(int));
+  }
+  if (hdr.nodecount)
+  {
+    nodecount_ = nodesize_ = hdr.nodecount;
+    node_ = new NODE[nodesize_];
+    growstack(nodesize_);
+    memcpy(node_, node, nodecount_ * sizeof(NODE));
+  }
+  for (int t = 0; t < IVSET_COUNT; t++) root_[t] = hdr.root[t];
+  return INSTDB_OK;
+}
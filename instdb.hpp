@@ -0,0 +1,196 @@
+#ifndef __INSTDB__
+#define __INSTDB__
+
+#include "instvec.hpp"
+#include "capture.hpp"
+
+#include <stdint.h>
+
+// Rhythm instruments
+enum RHYTHM_INSTRUMENT {
+  NormalInstrument,
+  BassDrum,
+  SnareDrum,
+  TomTom,
+  TopCymbal,
+  HiHat
+};
+
+// Number of instruments allocated at a time
+#define INSTDB_BLOCK  256
+
+// Compiled instrument lists (see InstrumentDB::save()) start with this
+#define INSTDB_SIG      "DRO2MIDB"
+#define INSTDB_VERSION  1
+
+// Number of values the caller can store in a compiled list to identify the
+// files it was compiled from
+#define INSTDB_SOURCE  8
+
+// Results of InstrumentDB::load()
+#define INSTDB_OK       0
+#define INSTDB_MISSING  1  // file doesn't exist or couldn't be read
+#define INSTDB_INVALID  2  // not a compiled list, for a different version, or
+                           // damaged
+#define INSTDB_STALE    3  // compiled from different files
+
+// What an instrument is mapped to.  This is kept apart from the instrument's
+// registers, which are all that's needed while searching for a match.
+// Instruments are never moved or removed, so an instrument number stays
+// valid for as long as the list exists.
+typedef struct
+{
+  int prog;  // MIDI patch (or -1 if a drum)
+  int isdrum;
+  int note; // note to play if drum
+  bool muted; // true if this instrument is muted
+  char name[128];
+
+  signed int iTranspose; // number of semitones to transpose this instrument
+
+  // The instrument can be redirected to another.  This is used when a new
+  // instrument is encountered - its info is printed to the screen then it's
+  // recorded (pointing to its best match) to prevent it appearing as a new
+  // instrument hundreds of times and cluttering the output.
+  int redirect; // if >= 0, use instrument number redirect instead of this one
+} INSTRINFO;
+
+// The list of known instruments, with indices for finding an exact or the
+// closest match to a set of registers.  Instruments are stored packed (see
+// instvec.hpp) with the instrument type in the IV_TYPE byte, and the packed
+// registers for all of them sit together in one array so a search doesn't
+// have to drag the mapping details through the cache as well.
+//
+// A list can be layered over another one (see setbase()), so several
+// conversions can share one set of loaded instruments while each keeps the
+// ones it finds in the song to itself.
+class InstrumentDB
+{
+public:
+  InstrumentDB();
+  ~InstrumentDB();
+
+  // Put this (empty) list on top of base, which then looks like the first
+  // base->count() instruments of this one.  base isn't changed by anything
+  // done to this list, and must not be changed or deleted while this list
+  // is in use, but any number of lists can share it (on any thread.)
+  void setbase(const InstrumentDB* base);
+
+  int count() const { return basecount_ + count_; }
+  const unsigned char* regs(int i) const
+  {
+    if (i < basecount_) return base_->regs(i);
+    i -= basecount_;
+    return block_[i / INSTDB_BLOCK]->regs[i % INSTDB_BLOCK];
+  }
+  const INSTRINFO& info(int i) const
+  {
+    if (i < basecount_) return base_->info(i);
+    i -= basecount_;
+    return block_[i / INSTDB_BLOCK]->info[i % INSTDB_BLOCK];
+  }
+
+  // Add an instrument, returning its index.
+  int add(const unsigned char* regs, const INSTRINFO& info);
+
+  // Number of bytes allocated for the list and its indices (including the
+  // base list's, unless base is false)
+  unsigned long memused(bool base = true) const;
+
+  // Return the first instrument exactly matching the query, or -1 if there
+  // isn't one.  The query is packed like a stored instrument, with the type
+  // of instrument being looked for in the IV_TYPE byte.
+  int find(const unsigned char* query) const;
+
+  // Return the instrument closest to the query (the first one if several are
+  // equally close) and its difference in diff, or -1 if there are none.
+  int nearest(const unsigned char* query, long* diff);
+
+  // Which set of registers is compared for this type of instrument
+  static int regset(int type);
+
+  // Write the list and its indices to a file that can be loaded back by
+  // load() without having to parse or index anything again.  Only a list
+  // without a base can be saved.  source is
+  // stored along with it, so a later load() can tell whether the list is
+  // still current.  Returns false (with errno set) on error.
+  bool save(const char* filename, const uint64_t* source);
+
+  // Replace the list with one written by save(), if it was saved with the
+  // same source values.  The file is mapped into memory and used in place
+  // where possible, and instruments added afterwards are kept separately.
+  // Returns one of the INSTDB_* values, and leaves the list empty unless
+  // it's INSTDB_OK.
+  int load(const char* filename, const uint64_t* source);
+
+protected:
+  // The list grows a block at a time, with each block holding the packed
+  // registers of all its instruments together, followed by their details.
+  typedef struct
+  {
+    unsigned char regs[INSTDB_BLOCK][INSTVEC_LEN];
+    INSTRINFO info[INSTDB_BLOCK];
+  } BLOCK;
+  BLOCK** block_;
+  int blockcount_, blocksize_; // blocks in use, and room in block_
+  int count_; // not including the base list
+  const InstrumentDB* base_;
+  int basecount_; // base_->count(), or 0 if there's no base
+  CaptureReader image_; // file given to load()
+  int imageblocks_; // number of blocks at the start of block_ inside image_
+
+  // Open addressing hash table of instrument numbers (-1 if empty) by the
+  // registers compared for their type.  It only ever holds the first
+  // instrument for a given set of registers, which is the one a linear search
+  // would stop at.  When there's a base list this only covers the
+  // instruments added on top of it, and the base is looked in first.
+  int* hash_;
+  unsigned int hashsize_; // always a power of two
+  int hashcount_;
+
+  // For finding the closest match there is a BK-tree for each register set
+  // (see instdb.cpp.)
+  typedef struct
+  {
+    int instr;   // instrument number
+    long dist;   // distance from the parent node
+    int child;   // first child node, or -1
+    int next;    // next sibling node, or -1
+  } NODE;
+  typedef struct
+  {
+    int node;
+    long bound;  // the least distance anything below node can be
+  } SEARCH;
+  NODE* node_;
+  int nodecount_, nodesize_;
+  int root_[IVSET_COUNT];
+  SEARCH* stack_;  // one entry per node is always enough, and there's room
+                   // for the base list's nodes too so it can be searched
+                   // without touching it
+  int stacksize_;
+
+  // Layout of a compiled list.  Each section starts on a 16 byte boundary.
+  typedef struct
+  {
+    char sig[8];
+    uint32_t version;
+    uint32_t layout[4]; // sizes of the structures below, to catch a file
+                        // written by a build for a different platform
+    uint64_t source[INSTDB_SOURCE];
+    uint32_t count, blockcount, hashsize, hashcount, nodecount;
+    int32_t root[IVSET_COUNT];
+    // followed by blockcount BLOCKs, hashsize ints and nodecount NODEs
+  } HEADER;
+
+  void clear();
+  void makekey(const unsigned char* regs, unsigned char* key) const;
+  unsigned int findslot(const unsigned char* key) const;
+  void addtohash(int i);
+  int newnode(int i, long dist);
+  void addtotrees(int i);
+  void growstack(int size);
+  int search(const unsigned char* query, long* diff, SEARCH* stack) const;
+};
+
+#endif
@@ -0,0 +1,70 @@
+// instvec.cpp - weighted difference between packed instruments
+#include "instvec.hpp"
+#include <assert.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define INSTVEC_SSE2
+#endif
+
+// The type of instrument always counts, then:
+//
+// Normal instruments (which occupy a whole channel) and the one rhythm mode
+// instrument which also occupies a whole channel (BD) compare the full
+// register set, both operators plus the connection byte.  The carrier level
+// is left out, as that's only the note volume.
+//
+// TT and HH only use one operator's settings, the settings of the other
+// operator (should) be ignored.  There is also only one Connection byte, but
+// there is no documentation to say whether this applies to these
+// modulator-only rhythm instruments or to the other carrier-only ones
+// (below.)  I'm guessing and putting it here.
+//
+// SD and TC only use one operator - but the other one compared to the
+// previous set above.  They also don't use the single Connection byte (I
+// think.)
+const unsigned char instvecweight[IVSET_COUNT][INSTVEC_LEN] = {
+  // type 20 20  40 40  60 60  80 80  C0  E0 E0
+  {     4,  2, 2,  1, 0,  2, 2,  2, 2,  3,  1, 1,  0, 0, 0, 0 },
+  {     4,  2, 0,  1, 0,  2, 0,  2, 0,  3,  1, 0,  0, 0, 0, 0 },
+  {     4,  0, 2,  0, 0,  0, 2,  0, 2,  0,  0, 1,  0, 0, 0, 0 },
+};
+
+long instvecdistance_ref(const unsigned char* a, const unsigned char* b, int set)
+{
+  long total = 0;
+  for (int i = 0; i < INSTVEC_LEN; i++)
+  {
+    long diff = (long)a[i] - (long)b[i];
+    if (diff < 0) diff = -diff;
+    total += diff * instvecweight[set][i];
+  }
+  return total;
+}
+
+long instvecdistance(const unsigned char* a, const unsigned char* b, int set)
+{
+#ifdef INSTVEC_SSE2
+  // psadbw adds up byte differences without any weighting, so the weights
+  // are applied by summing the differences once for every lane with a
+  // weight of at least 1, again for those of at least 2, and so on.
+  __m128i va = _mm_loadu_si128((const __m128i*)a);
+  __m128i vb = _mm_loadu_si128((const __m128i*)b);
+  __m128i w = _mm_loadu_si128((const __m128i*)instvecweight[set]);
+  __m128i diff = _mm_sub_epi8(_mm_max_epu8(va, vb), _mm_min_epu8(va, vb));
+  __m128i zero = _mm_setzero_si128();
+  __m128i sum = zero;
+  for (int k = 0; k < 4; k++)
+  {
+    __m128i mask = _mm_cmpgt_epi8(w, _mm_set1_epi8((char)k));
+    sum = _mm_add_epi64(sum, _mm_sad_epu8(_mm_and_si128(diff, mask), zero));
+  }
+  long total = _mm_cvtsi128_si32(sum) + _mm_cvtsi128_si32(_mm_srli_si128(sum, 8));
+#ifdef INSTVEC_VERIFY
+  assert(total == instvecdistance_ref(a, b, set));
+#endif
+  return total;
+#else
+  return instvecdistance_ref(a, b, set);
+#endif
+}
@@ -0,0 +1,37 @@
+#ifndef __INSTVEC__
+#define __INSTVEC__
+
+// Instruments packed into a 16 byte vector, one byte per register, so the
+// weighted difference used for instrument matching can be worked out with a
+// handful of SIMD instructions rather than field by field.
+#define INSTVEC_LEN  16
+
+// Byte offsets of each value within a packed instrument.  Registers with a
+// value for each operator have the modulator first and the carrier next to
+// it, so e.g. the carrier's 0x40 register is at IV_40 + 1.
+#define IV_TYPE   0  // RHYTHM_INSTRUMENT (always 0 for channel registers)
+#define IV_20     1
+#define IV_40     3
+#define IV_60     5
+#define IV_80     7
+#define IV_C0     9
+#define IV_E0    10
+
+// Which registers are compared
+#define IVSET_BOTH      0  // both operators and connection (normal, BD)
+#define IVSET_MODULATOR 1  // modulator and connection (TT, HH)
+#define IVSET_CARRIER   2  // carrier only (SD, TC)
+#define IVSET_COUNT     3
+
+// How much a difference in each byte counts for, or 0 if it isn't compared
+extern const unsigned char instvecweight[IVSET_COUNT][INSTVEC_LEN];
+
+// Weighted difference between two packed instruments
+long instvecdistance(const unsigned char* a, const unsigned char* b, int set);
+
+// Plain C version of the above, used when SIMD isn't available.  Define
+// INSTVEC_VERIFY when compiling instvec.cpp to check every SIMD result
+// against it.
+long instvecdistance_ref(const unsigned char* a, const unsigned char* b, int set);
+
+#endif
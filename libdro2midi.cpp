@@ -0,0 +1,1737 @@
+// libdro2midi.cpp - the conversion itself, with all its state held in a
+// ConversionContext (see libdro2midi.hpp)
+#include "libdro2midi.hpp"
+#include "freqtable.h"
+#include "ring.hpp"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <limits.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <thread>
+#include <chrono>
+#include <atomic>
+
+#define READ_TEXT     "r"
+
+#ifdef _MSC_VER
+// Keep MS VC++ happy
+#define strncasecmp _strnicmp
+#define strcasecmp _stricmp
+#define snprintf _snprintf
+#define log2(x) (log(x) / log(2.))
+inline double round( double d )
+{
+return floor( d + 0.5 );
+}
+#endif
+
+const double pitchbend_center = 8192.0;
+
+// MIDI channels to use for these instruments when they are mapped as normal
+// notes.  Probably best not to use 1-10 as these are used by the rest of the
+// OPL mapping code.  Note these are zero-based, so the GM drum channel is
+// channel 9 in this context.
+#define CHAN_BASSDRUM  10 // Bass drum sits on OPL channel 7
+#define CHAN_SNAREDRUM 11 // OPL channel 8 carrier
+#define CHAN_TOMTOM    12 // OPL channel 9 modulator
+#define CHAN_TOPCYMBAL 13 // OPL channel 9 carrier
+#define CHAN_HIHAT     14 // OPL channel 8 modulator
+
+#define FORMAT_IMF  1
+#define FORMAT_DRO  2
+#define FORMAT_RAW  3
+#define FORMAT_DRO2 4
+
+const char* convertresultstr(int result)
+{
+	switch (result) {
+		case CONVERT_OK: return "OK";
+		case CONVERT_CORRUPT: return "corrupt data";
+		case CONVERT_UNKNOWN: return "unknown format";
+		case CONVERT_LIMIT: return "over the time or memory limit";
+		default: return "conversion failed";
+	}
+}
+
+ConversionOptions::ConversionOptions()
+{
+	bRhythm = true;
+	bUsePitchBends = true;
+	bApproximatePitchbends = false;
+	bPerfectMatchesOnly = false;
+	bEnableVolume = true;
+	bWriteSbiInstruments = false;
+	bStdinIsWlf = false;
+	bOptimise = false;
+	bFilterPitchbends = false;
+	iBendWindow = 0;
+	dbBendCents = 0;
+	bAutoConversionVal = false;
+	dbConversionVal = 49716.0;
+	dbTimeLimit = 0;
+	iMemoryLimit = 0;
+	bPipeline = false;
+	input = 0;
+	output = 0;
+	out = stdout;
+	err = stderr;
+}
+
+bool ConversionOptions::setBendFilter(const char* param)
+{
+	// strtoul() would quietly wrap a negative tick count around to a huge one
+	while (isspace((unsigned char)*param)) param++;
+	if (!isdigit((unsigned char)*param)) return false;
+	char* end;
+	errno = 0;
+	unsigned long window = strtoul(param, &end, 10);
+	if ((errno == ERANGE) || (*end != ',')) return false;
+	const char* c = end + 1;
+	double cents = strtod(c, &end);
+	if ((end == c) || (!(cents >= 0))) return false;
+	bFilterPitchbends = true;
+	iBendWindow = window;
+	dbBendCents = cents;
+	return true;
+}
+
+ConversionContext::ConversionContext(const ConversionOptions& options)
+{
+	opt = options;
+	write = 0;
+	//resolution = 384; // 560Hz IMF
+	resolution = 500;   // 1000Hz DRO
+	tempo = 120.0;
+	// Anything convert() doesn't set up starts at zero
+	memset(cPatchName, 0, sizeof(cPatchName));
+	memset(cPercName, 0, sizeof(cPercName));
+	memset(mapchannel, 0, sizeof(mapchannel));
+	memset(curfreq, 0, sizeof(curfreq));
+	memset(curoctave, 0, sizeof(curoctave));
+	memset(keyAlreadyOn, 0, sizeof(keyAlreadyOn));
+	memset(lastkey, 0, sizeof(lastkey));
+	memset(pitchbent, 0, sizeof(pitchbent));
+	memset(transpose, 0, sizeof(transpose));
+	memset(drumnote, 0, sizeof(drumnote));
+	memset(lastprog, 0, sizeof(lastprog));
+	memset(mute, 0, sizeof(mute));
+	memset(matchcache, 0, sizeof(matchcache));
+	lastchannel = 0;
+	rhythmreg = 0;
+	iNotesActive = 0;
+	iPitchbendCount = 0;
+	iTotalNotes = 0;
+	memset(reg, 0, sizeof(reg));
+	iFormat = 0;
+	iSpeed = 0;
+	iInitialSpeed = 0;
+	dbDeadline = 0;
+	memset(dbStageBusy, 0, sizeof(dbStageBusy));
+	memset(dbStageIdle, 0, sizeof(dbStageIdle));
+
+	if (opt.bFilterPitchbends) {
+		midievents.setbendfilter(opt.iBendWindow,
+			(int)ceil(PITCHBEND_ONESEMITONE * opt.dbBendCents / 100.0));
+	}
+	if (opt.bOptimise) midievents.setpasses(EVPASS_ALL);
+	// The GM percussion channel, and the rhythm-mode instruments when they
+	// aren't mapped onto it
+	midievents.setdrumchannels((1 << gm_drumchannel)
+		| (((1 << 5) - 1) << CHAN_BASSDRUM));
+
+	dbConversionVal = opt.dbConversionVal;
+	buildFreqTable();
+}
+
+// Convert the given OPL F-num and octave values into a fractional MIDI note
+// number (for the use of pitchbends) using conversion constant dbConst.  This
+// must match the formula in
+// gen_freqtable.cpp.
+static double calcFreqKey(double dbConst, int freq, int octave)
+{
+	int iFNum = freq;
+	int iBlock = octave;
+	double dbOriginalFreq = dbConst * (double)iFNum * pow(2, (double)(iBlock - 20));
+	return 69.0 + 12.0 * log2(dbOriginalFreq / 440.0);
+}
+
+// Select (or calculate) the table of MIDI keys for dbConversionVal.  The
+// tables for the two standard constants are built in at compile time.
+void ConversionContext::buildFreqTable()
+{
+	if (dbConversionVal == 49716.0) {
+		freqtable = freqtable_49716;
+	} else if (dbConversionVal == 50000.0) {
+		freqtable = freqtable_50000;
+	} else {
+		for (int iBlock = 0; iBlock < 8; iBlock++) {
+			for (int iFNum = 0; iFNum < 1024; iFNum++) {
+				customfreqtable[iBlock][iFNum] = calcFreqKey(dbConversionVal, iFNum, iBlock);
+			}
+		}
+		freqtable = customfreqtable;
+	}
+}
+
+// Range of constants tried by -c auto, on top of the two standard ones
+#define AUTOCONST_MIN  48000
+#define AUTOCONST_MAX  52000
+
+typedef struct {
+	double dbConst;
+	long iBent; // notes that would start with a pitchbend
+	double dbError; // total distance of all notes from the nearest key
+} CONSTSCORE;
+
+// Work out the scores for score[first], score[first + step], ... up to count.
+// Notes are given as (block << 10) | fnum in pair[], and the number of notes
+// started at that frequency in notes[].
+static void scoreConstants(const int* pair, const long* notes, int iPairs,
+	CONSTSCORE* score, int first, int count, int step)
+{
+	for (int s = first; s < count; s += step) {
+		score[s].iBent = 0;
+		score[s].dbError = 0;
+		for (int i = 0; i < iPairs; i++) {
+			// Same as doNoteOnOff() does when a note starts
+			double keyFrac = calcFreqKey(score[s].dbConst, pair[i] & 0x3FF, pair[i] >> 10);
+			int key = (int)round(keyFrac);
+			if (key <= 0) continue;
+			double dbDiff = keyFrac - key;
+			if ((int)(pitchbend_center + (PITCHBEND_ONESEMITONE * dbDiff)) != (int)pitchbend_center) {
+				score[s].iBent += notes[i];
+			}
+			score[s].dbError += notes[i] * fabs(dbDiff);
+		}
+	}
+	return;
+}
+
+// True if a is a better constant to use than b
+inline bool betterScore(const CONSTSCORE& a, const CONSTSCORE& b)
+{
+	if (a.iBent != b.iBent) return a.iBent < b.iBent;
+	return a.dbError < b.dbError;
+}
+
+// Pick the conversion constant that leaves the fewest notes needing a
+// pitchbend when they start (for -c auto.)  The F-num and block of every
+// note-on in the song are counted up, then each candidate is tried against
+// them, split across as many threads as there are cores.  The scores are
+// printed along with the constant chosen.
+double ConversionContext::autoConversionVal(const OPLEVENT* ev, long n)
+{
+	// Count the notes started at each frequency
+	long* notes = new long[8 * 1024];
+	memset(notes, 0, 8 * 1024 * sizeof(long));
+	int freq[9], octave[9];
+	bool keyon[9];
+	for (int c = 0; c < 9; c++) {
+		freq[c] = octave[c] = 0;
+		keyon[c] = false;
+	}
+	long iNotes = 0;
+	for (long i = 0; i < n; i++) {
+		int code = ev[i].reg;
+		int param = ev[i].val;
+		if (code >= 0xa0 && code <= 0xa8) {
+			freq[code - 0xa0] = (freq[code - 0xa0] & 0xF00) + param;
+		} else if (code >= 0xb0 && code <= 0xb8) {
+			int c = code - 0xb0;
+			freq[c] = (freq[c] & 0x0FF) + ((param & 0x03) << 8);
+			octave[c] = (param >> 2) & 7;
+			bool on = (param >> 5) & 1;
+			if (on && !keyon[c]) {
+				notes[(octave[c] << 10) | freq[c]]++;
+				iNotes++;
+			}
+			keyon[c] = on;
+		}
+	}
+	int* pair = new int[8 * 1024];
+	int iPairs = 0;
+	for (int i = 0; i < 8 * 1024; i++) {
+		if (notes[i]) {
+			pair[iPairs] = i;
+			notes[iPairs++] = notes[i];
+		}
+	}
+
+	// The standard constants go first so they win a tie
+	int count = 2 + AUTOCONST_MAX - AUTOCONST_MIN + 1;
+	CONSTSCORE* score = new CONSTSCORE[count];
+	score[0].dbConst = 49716.0;
+	score[1].dbConst = 50000.0;
+	count = 2;
+	for (int i = AUTOCONST_MIN; i <= AUTOCONST_MAX; i++) {
+		if ((i != 49716) && (i != 50000)) score[count++].dbConst = i;
+	}
+
+	int iThreads = std::thread::hardware_concurrency();
+	if (iThreads < 1) iThreads = 1;
+	std::thread* workers = new std::thread[iThreads - 1];
+	for (int t = 1; t < iThreads; t++) {
+		workers[t - 1] = std::thread(scoreConstants, pair, notes, iPairs, score,
+			t, count, iThreads);
+	}
+	scoreConstants(pair, notes, iPairs, score, 0, count, iThreads);
+	for (int t = 1; t < iThreads; t++) workers[t - 1].join();
+	delete[] workers;
+
+	int best = 0;
+	for (int s = 1; s < count; s++) {
+		if (betterScore(score[s], score[best])) best = s;
+	}
+
+	// Show the standard constants, then the closest of the rest
+	fprintf(opt.out, "Tried %d conversion constants on %ld notes using %d thread%s:\n",
+		count, iNotes, iThreads, iThreads == 1 ? "" : "s");
+	for (int s = 0; s < 2; s++) {
+		fprintf(opt.out, "  %.1lf: %ld notes pitchbent, average error %.3lf semitones\n",
+			score[s].dbConst, score[s].iBent, iNotes ? score[s].dbError / iNotes : 0);
+	}
+	bool* shown = new bool[count];
+	memset(shown, 0, count * sizeof(bool));
+	for (int i = 0; i < 5; i++) {
+		int next = -1;
+		for (int s = 2; s < count; s++) {
+			if ((!shown[s]) && ((next < 0) || betterScore(score[s], score[next]))) {
+				next = s;
+			}
+		}
+		if (next < 0) break;
+		shown[next] = true;
+		fprintf(opt.out, "  %.1lf: %ld notes pitchbent, average error %.3lf semitones\n",
+			score[next].dbConst, score[next].iBent,
+			iNotes ? score[next].dbError / iNotes : 0);
+	}
+	double dbConst = score[best].dbConst;
+
+	delete[] shown;
+	delete[] score;
+	delete[] pair;
+	delete[] notes;
+	return dbConst;
+}
+
+/* Channel        1   2   3   4   5   6   7   8   9
+ * Operator 1    00  01  02  08  09  0A  10  11  12  } cells
+ * Operator 2    03  04  05  0B  0C  0D  13  14  15  }
+ */
+// Converts a cell into a channel
+#define GET_CHANNEL(i)  ((((i) / 8) * 3) + (((i) % 8) % 3))
+
+// Converts a cell into 0 (for operator 1) or 1 (for operator 2)
+#define GET_OP(i) (((i) % 8) / 3)
+
+
+#define NO_PATCH_NAMES_MSG "Warning: Unable to open file listing patch names (" \
+	PATCH_NAME_FILE ")\nInstrument names will not be available.\n"
+#define NO_PERC_NAMES_MSG "Warning: Unable to open file listing percussion note " \
+	"names (" PERC_NAME_FILE ")\nPercussion names will not be available.\n"
+#define NO_MAPPING_MSG "Warning: Unable to open instrument mapping file " \
+	MAPPING_FILE ", defaulting to a Grand Piano\nfor all instruments.\n"
+
+// Identify the current instrument files by the size and modification time of
+// each one (or all bits set if it's missing), so a compiled instrument list
+// can be checked against them.
+static void getInstSource(uint64_t *source)
+{
+	const char *files[3] = {MAPPING_FILE, PATCH_NAME_FILE, PERC_NAME_FILE};
+	memset(source, 0, INSTDB_SOURCE * sizeof(uint64_t));
+	for (int i = 0; i < 3; i++) {
+		struct stat st;
+		if (stat(files[i], &st) == 0) {
+			source[i*2] = (uint64_t)st.st_size;
+			source[i*2+1] = (uint64_t)st.st_mtime;
+		} else {
+			source[i*2] = source[i*2+1] = ~(uint64_t)0;
+		}
+	}
+}
+
+// Load the instruments from COMPILED_FILE, if it's there and up to date
+bool ConversionContext::loadCompiledInstruments()
+{
+	int result = instdb.load(COMPILED_FILE, instsource);
+	if (result == INSTDB_STALE) {
+		fprintf(opt.err, "Warning: " COMPILED_FILE " is out of date, reading "
+			MAPPING_FILE " instead.\nRun dro2midi --compile-db to update it.\n");
+	} else if (result == INSTDB_INVALID) {
+		fprintf(opt.err, "Warning: " COMPILED_FILE " is damaged or was not "
+			"compiled by this version of dro2midi, reading " MAPPING_FILE
+			" instead.\nRun dro2midi --compile-db to update it.\n");
+	}
+	if (result != INSTDB_OK) return false;
+
+	// Give the same warnings as if the files had been read
+	if (instsource[2] == ~(uint64_t)0) fprintf(opt.err, NO_PATCH_NAMES_MSG);
+	if (instsource[4] == ~(uint64_t)0) fprintf(opt.err, NO_PERC_NAMES_MSG);
+	if (instsource[0] == ~(uint64_t)0) fprintf(opt.err, NO_MAPPING_MSG);
+	return true;
+}
+
+// Read one value the way sscanf()'s "%02X" would, returning the number of
+// chars used or 0 if there wasn't a number there.
+static int scanhexbyte(const char *p, unsigned int *out)
+{
+	const char *start = p;
+	int width = 2;
+	bool neg = false;
+	if ((*p == '+') || (*p == '-')) {
+		neg = (*p == '-');
+		p++;
+		width--;
+	}
+	unsigned int v = 0;
+	int digits = 0;
+	while ((width > 0) && (isxdigit((unsigned char)*p))) {
+		v = v * 16 + ((*p <= '9') ? (*p - '0') : ((*p | 0x20) - 'a' + 10));
+		p++;
+		width--;
+		digits++;
+		// A leading 0x is allowed (and counts towards the width)
+		if ((digits == 1) && (v == 0) && (width > 0) && ((*p | 0x20) == 'x')) {
+			p++;
+			width--;
+		}
+	}
+	if (!digits) return 0;
+	*out = neg ? -v : v;
+	return p - start;
+}
+
+// Read the registers and options from an instrument line.  This is the same
+// as sscanf(p, "%02X-%02X/...: %s\n", ...) with seps giving the character
+// after each register ("-/-/-/-//-:" for the line above) and returns the
+// number of fields in the same way, but it's a lot quicker when there are
+// thousands of lines to get through.
+static int scaninstr(const char *p, const char *seps, unsigned int *const *regs,
+	char *value)
+{
+	int n = 0;
+	for (;; seps++) {
+		while (isspace((unsigned char)*p)) p++;
+		if (!*p) return n ? n : -1;
+		int len = scanhexbyte(p, regs[n]);
+		if (!len) return n;
+		p += len;
+		n++;
+		if (*p != *seps) return n;
+		p++;
+		if (*seps == ':') break;
+	}
+	while (isspace((unsigned char)*p)) p++;
+	if (!*p) return n;
+	while ((*p) && (!isspace((unsigned char)*p))) *value++ = *p++;
+	*value = '\0';
+	return n + 1;
+}
+
+// Same as sscanf(opt, "<prefix>%d", value) == 1
+static bool scanoption(const char *opt, const char *prefix, int *value)
+{
+	size_t len = strlen(prefix);
+	if (strncmp(opt, prefix, len) != 0) return false;
+	char *end;
+	long v = strtol(opt + len, &end, 10);
+	if (end == opt + len) return false;
+	*value = (int)v;
+	return true;
+}
+
+#define EPRINTF(FMT, ...) fprintf(opt.err, "%s: " FMT, fname, __VA_ARGS__)
+bool ConversionContext::loadInstruments(bool bUseCompiled)
+{
+	getInstSource(instsource);
+	if ((bUseCompiled) && (loadCompiledInstruments())) return true;
+
+	for (int i = 0; i < NUM_MIDI_PATCHES; i++) sprintf(cPatchName[i], "Patch #%d", i+1);
+	for (int i = 0; i < NUM_MIDI_PERC; i++) sprintf(cPercName[i], "Note #%d", i);
+
+	char line[256];
+	const char *fname;
+
+	fname = PATCH_NAME_FILE;
+	FILE* p = fopen(PATCH_NAME_FILE, "r");
+	if (!p) {
+		fprintf(opt.err, NO_PATCH_NAMES_MSG);
+	} else {
+		while (fgets(line, sizeof(line)-1, p)) {
+			int iValue, iLen;
+			char *p = strpbrk(line, "\n\r");
+			if (p) *p = '\0'; // terminate the string at the newline
+			if (sscanf(line, "%d=%n", &iValue, &iLen) == 1) {
+				assert(iValue <= NUM_MIDI_PATCHES);
+				snprintf(cPatchName[iValue-1], INSTR_NAMELEN, "%s [%d]", &line[iLen], iValue);
+			} else if ((line[0] != '#') && (line[0] != '\n')) {
+				EPRINTF("Invalid line: %s\n", line);
+			}
+		}
+		fclose(p);
+	}
+
+	fname = PERC_NAME_FILE;
+	p = fopen(PERC_NAME_FILE, "r");
+	if (!p) {
+		fprintf(opt.err, NO_PERC_NAMES_MSG);
+	} else {
+		while (fgets(line, sizeof(line)-1, p)) {
+			int iValue, iLen;
+			char *p = strpbrk(line, "\n\r");
+			if (p) *p = '\0'; // terminate the string at the newline
+			if (sscanf(line, "%d=%n", &iValue, &iLen) == 1) {
+				assert(iValue <= NUM_MIDI_PERC);
+				snprintf(cPercName[iValue], INSTR_NAMELEN, "%s [%d]", &line[iLen], iValue);
+			} else if ((line[0] != '#') && (line[0] != '\n')) {
+				EPRINTF("Invalid line: %s\n", line);
+			}
+		}
+		fclose(p);
+	}
+
+	fname = MAPPING_FILE;
+	// The mapping file can run to thousands of lines, so rather than going
+	// through stdio and sscanf() it's mapped into memory and picked apart by
+	// hand.  Lines are still copied into line[] in the same size pieces as
+	// fgets() would give, so the line numbers and messages haven't changed.
+	CaptureReader mapping;
+	if (!mapping.open(MAPPING_FILE)) {
+		fprintf(opt.err, NO_MAPPING_MSG);
+		return true;
+	}
+	const char *next = (const char *)mapping.peek();
+	const char *end = next + mapping.size();
+	INSTRINFO in;
+	unsigned int inregs[INSTVEC_LEN]; // registers, as indexed by IV_*
+	RHYTHM_INSTRUMENT eRhythmInstrument;
+  memset(&in, 0, sizeof(in));
+	memset(inregs, 0, sizeof(inregs));
+	in.redirect = -1; // none of these should redirect (but later automatic
+		// instruments will redirect to these ones)
+
+	// Where each register is read into, for each type of line
+	unsigned int *const regsBoth[] = {
+		&inregs[IV_20], &inregs[IV_20+1],
+		&inregs[IV_40], &inregs[IV_40+1],
+		&inregs[IV_60], &inregs[IV_60+1],
+		&inregs[IV_80], &inregs[IV_80+1],
+		&inregs[IV_C0],
+		&inregs[IV_E0], &inregs[IV_E0+1]
+	};
+	unsigned int *const regsModulator[] = {
+		&inregs[IV_20],
+		&inregs[IV_40],
+		&inregs[IV_60],
+		&inregs[IV_80],
+		&inregs[IV_C0],
+		&inregs[IV_E0]
+	};
+	unsigned int *const regsCarrier[] = {
+		&inregs[IV_20+1],
+		&inregs[IV_40+1],
+		&inregs[IV_60+1],
+		&inregs[IV_80+1],
+		&inregs[IV_E0+1]
+	};
+
+	// Loop until we run out of lines in the data file
+	char value[256];
+	char cInstType[3] = "";
+	int iLineNum = 0;
+	while (next < end) {
+		size_t len = end - next;
+		if (len > sizeof(line) - 2) len = sizeof(line) - 2;
+		const char *eol = (const char *)memchr(next, '\n', len);
+		if (eol) len = eol - next + 1;
+		memcpy(line, next, len);
+		line[len] = '\0';
+		next += len;
+		iLineNum++;
+
+		// Ignore blank lines and comments
+		if ((line[0] == '#') || (line[0] == '\r') || (line[0] == '\n')) continue;
+
+		// Figure out what type of rhythm mode instrument (if any) the first two
+		// chars are referring to.  (A line of only whitespace leaves the type
+		// from the line before, and fails below.)
+		const char *c = line;
+		while (isspace((unsigned char)*c)) c++;
+		if (*c) {
+			int i = 0;
+			while ((i < 2) && (c[i]) && (!isspace((unsigned char)c[i]))) {
+				cInstType[i] = c[i];
+				i++;
+			}
+			cInstType[i] = '\0';
+		}
+		if ((cInstType[0] == 'N') && (cInstType[1] == 'O')) eRhythmInstrument = NormalInstrument;
+		else if ((cInstType[0] == 'B') && (cInstType[1] == 'D')) eRhythmInstrument = BassDrum;
+		else if ((cInstType[0] == 'S') && (cInstType[1] == 'D')) eRhythmInstrument = SnareDrum;
+		else if ((cInstType[0] == 'T') && (cInstType[1] == 'T')) eRhythmInstrument = TomTom;
+		else if ((cInstType[0] == 'T') && (cInstType[1] == 'C')) eRhythmInstrument = TopCymbal;
+		else if ((cInstType[0] == 'H') && (cInstType[1] == 'H')) eRhythmInstrument = HiHat;
+		else {
+			EPRINTF("Invalid instrument type \"%s\" on line %d:\n\n  %s\n",
+				cInstType, iLineNum, line);
+			return false;
+		}
+
+		int iNumFields;
+		switch (eRhythmInstrument) {
+			case NormalInstrument:
+			case BassDrum:
+				// Normal instrument or rhythm Bass Drum, read both
+				// operators + connection byte
+				iNumFields = scaninstr(&line[3], "-/-/-/-//-:", regsBoth, value);
+				if (iNumFields != 12) {
+					EPRINTF("Unable to parse line %d: (expected 12 "
+						"fields, got %d)\n\n%s\n", iLineNum, iNumFields, line);
+					return false;
+				}
+				break;
+
+			case TomTom:
+			case HiHat:
+				// This instrument is one operator only, but it does use the connection
+				// byte (probably)
+				iNumFields = scaninstr(&line[3], "/////:", regsModulator, value);
+				if (iNumFields != 7) {
+					EPRINTF("Unable to parse line %d: (expected 7 "
+						"fields, got %d)\n\n%s\n", iLineNum, iNumFields, line);
+					return false;
+				}
+				break;
+
+			case SnareDrum:
+			case TopCymbal:
+				// This instrument does not uses the connection byte, so read in one byte
+				// less.  Also read the values into the other operator.
+				iNumFields = scaninstr(&line[3], "////:", regsCarrier, value);
+				if (iNumFields != 6) {
+					EPRINTF("Unable to parse line %d: (expected 6 "
+						"fields, got %d)\n\n%s\n", iLineNum, iNumFields, line);
+					return false;
+				}
+				break;
+		}
+
+		// Default options
+		in.isdrum = 0;
+		in.prog = 1;
+		in.iTranspose = 0;
+		in.muted = false;
+
+		// If we got this far it's a valid instrument.  value holds the first
+		// word after the colon, which is the only option that's looked at.
+		int iValue;
+		const char *nextopt = value;
+		if (nextopt[0] == '#') {
+			// reached an end of line comment
+		} else if (scanoption(nextopt, "patch=", &iValue)) {
+			// MIDI patch
+			in.isdrum = 0;
+			in.prog = iValue - 1;
+			if ((in.prog < 0) || (in.prog > 127)) {
+				EPRINTF("ERROR: Instrument #%d (line %d) was set to "
+					"patch=%d, but this value must be between 1 and 128 inclusive.\n",
+					instdb.count(), iLineNum, in.prog + 1);
+				return false;
+			}
+		} else if (scanoption(nextopt, "drum=", &iValue)) {
+			// MIDI drum
+			in.isdrum = 1;
+			in.prog = -1;
+			in.note = iValue;
+			if ((in.note < 0) || (in.note > 127)) {
+				EPRINTF("ERROR: Drum instrument #%d (line %d) was set to "
+					"drum=%d, but this value must be between 1 and 128 inclusive.\n",
+					instdb.count(), iLineNum, in.note);
+				return false;
+			}
+		} else if (scanoption(nextopt, "transpose=", &iValue)) {
+			// MIDI drum
+			in.iTranspose = iValue;
+		} else if (strcmp(nextopt, "mute") == 0) {
+			// Mute this instrument
+			in.muted = true;
+		} else {
+			EPRINTF("Unknown instrument option on line %d: %s\n",
+				iLineNum, nextopt);
+			return false;
+		}
+
+		char cInstTypeText[256];
+		switch (eRhythmInstrument) {
+			case NormalInstrument: cInstTypeText[0] = '\0'; break;
+			case BassDrum: strcpy(cInstTypeText, "(OPL BD) "); break;
+			case TomTom: strcpy(cInstTypeText, "(OPL TT) "); break;
+			case HiHat: strcpy(cInstTypeText, "(OPL HH) "); break;
+			case SnareDrum: strcpy(cInstTypeText, "(OPL SD) "); break;
+			case TopCymbal: strcpy(cInstTypeText, "(OPL TC) "); break;
+		}
+		sprintf(in.name, "Inst#%03d %s@ line %3d%s: %s", instdb.count(),
+			cInstTypeText,
+			iLineNum,
+			(in.isdrum) ? " (perc)" : "",
+			(in.isdrum) ? cPercName[in.note] : cPatchName[in.prog]
+		);
+		if (in.iTranspose) {
+			char cTranspose[256];
+			sprintf(cTranspose, " @ %+d semitones", in.iTranspose);
+			strcat(in.name, cTranspose);
+		}
+		if (in.muted) strcat(in.name, " {muted}");
+		//printf("%s\n", in.name);
+
+		// Add instrument
+		unsigned char packed[INSTVEC_LEN];
+		for (int i = 0; i < INSTVEC_LEN; i++) packed[i] = inregs[i];
+		packed[IV_TYPE] = eRhythmInstrument;
+		instdb.add(packed, in);
+  }
+  return true;
+}
+#undef EPRINTF
+
+void ConversionContext::writesbi(const char* filename, int instrno, int chanOPL) {
+	char fname[100];
+	char title[32];
+	snprintf(fname, 100, "%s_%03d.sbi", filename, instrno);
+	FILE* f_sbi = fopen(fname, WRITE_BINARY);
+	if (!f_sbi) {
+		fprintf(opt.err, "Could not open instrument file %s for writing.\n", filename);
+	} else {
+		fwrite("SBI\x1a", sizeof(char), 4, f_sbi);
+		memset(title, 0, 32);
+		snprintf(title, 32, "dro2midi");
+		fwrite(title, sizeof(char), 32, f_sbi);
+		unsigned char instr[16];
+		memset(instr, 0, 16);
+		instr[0] = reg[chanOPL][IV_20];
+		instr[1] = reg[chanOPL][IV_20+1];
+		instr[2] = reg[chanOPL][IV_40];
+		instr[3] = reg[chanOPL][IV_40+1];
+		instr[4] = reg[chanOPL][IV_60];
+		instr[5] = reg[chanOPL][IV_60+1];
+		instr[6] = reg[chanOPL][IV_80];
+		instr[7] = reg[chanOPL][IV_80+1];
+		instr[8] = reg[chanOPL][IV_E0];
+		instr[9] = reg[chanOPL][IV_E0+1];
+		instr[10] = reg[chanOPL][IV_C0];
+		fwrite(instr, sizeof(char), 16, f_sbi);
+		fclose(f_sbi);
+	}
+}
+
+int ConversionContext::findinstr(int chanMIDI)
+{
+	assert((chanMIDI < 9) || ((chanMIDI >= CHAN_BASSDRUM) && (chanMIDI <= CHAN_HIHAT)));
+
+	// Nothing that affects the match has changed since last time.  (If that
+	// was a new instrument, the same registers would now match the redirect
+	// entry added for it, and end up at the same instrument anyway.)
+	if (matchcache[chanMIDI] >= 0) return matchcache[chanMIDI];
+
+	RHYTHM_INSTRUMENT ri;
+	int chanOPL;
+	switch (chanMIDI) {
+		case CHAN_BASSDRUM:  ri = BassDrum;  chanOPL = 6; break;
+		case CHAN_SNAREDRUM: ri = SnareDrum; chanOPL = 7; break;
+		case CHAN_TOMTOM:    ri = TomTom;    chanOPL = 8; break;
+		case CHAN_TOPCYMBAL: ri = TopCymbal; chanOPL = 8; break;
+		case CHAN_HIHAT:     ri = HiHat;     chanOPL = 7; break;
+		default: ri = NormalInstrument; chanOPL = chanMIDI; break;
+	}
+
+	unsigned char query[INSTVEC_LEN];
+	memcpy(query, reg[chanOPL], INSTVEC_LEN);
+	query[IV_TYPE] = ri;
+
+	// Most of the time the instrument will have been seen before
+	int besti = instdb.find(query);
+	long bestdiff = 0;
+	if (besti < 0) {
+		// It's a new one, so find the closest match
+		besti = instdb.nearest(query, &bestdiff);
+	}
+
+	if (besti >= 0) { // could be -1 if no instruments are loaded
+		while (instdb.info(besti).redirect >= 0) { // Could have multiple redirects
+			// This instrument was an automatically generated one to avoid printing
+			// the instrument definition multiple times, so instead of using the auto
+			// one, use the one it originally matched against.
+			besti = instdb.info(besti).redirect;
+		}
+	}
+
+	if (bestdiff != 0) {
+		if (opt.bPerfectMatchesOnly) {
+			// User doesn't want "close enough is good enough" instrument guessing
+			besti = 0;  // use first instrument
+		}
+		// Couldn't find an exact match, print the details
+		switch (ri) {
+			case NormalInstrument:
+			case BassDrum:
+				// Normal instrument or rhythm Bass Drum use both
+				// operators + connection byte
+				fprintf(opt.out, "** New instrument in use on channel %d\n** Copy this into "
+					MAPPING_FILE " to assign it a MIDI patch:\n", chanOPL);
+				fprintf(opt.err, "%s %02X-%02X/%02X-%02X/%02X-%02X/%02X-%02X/%02X/"
+					"%02X-%02X: patch=?\n",
+					((ri == BassDrum) ? "BD" : "NO"),
+					reg[chanOPL][IV_20], reg[chanOPL][IV_20+1],
+					reg[chanOPL][IV_40], reg[chanOPL][IV_40+1],
+					reg[chanOPL][IV_60], reg[chanOPL][IV_60+1],
+					reg[chanOPL][IV_80], reg[chanOPL][IV_80+1],
+					reg[chanOPL][IV_C0],
+					reg[chanOPL][IV_E0], reg[chanOPL][IV_E0+1]
+				);
+				if (opt.bWriteSbiInstruments) {
+					writesbi(opt.output, instdb.count(), chanOPL);
+				}
+				break;
+			case TomTom:
+			case HiHat:
+				// This instrument is one operator only, but it does use the connection
+				// byte (probably)
+				fprintf(opt.out, "** New rhythm instrument in use on OPL channel %d modulator\n"
+					"** Copy this into " MAPPING_FILE " to assign it a MIDI patch:\n",
+					chanOPL);
+				fprintf(opt.err, "%s %02X/%02X/%02X/%02X/%02X/%02X: "
+					"patch=?\n",
+					((ri == TomTom) ? "TT" : "HH"),
+					reg[chanOPL][IV_20],
+					reg[chanOPL][IV_40],
+					reg[chanOPL][IV_60],
+					reg[chanOPL][IV_80],
+					reg[chanOPL][IV_C0],
+					reg[chanOPL][IV_E0]
+				);
+				break;
+			case SnareDrum:
+			case TopCymbal:
+				// This instrument does not uses the connection byte, so read in one
+				// byte less.  Also read the values into the other operator.
+				// This instrument is one operator only, but it does use the connection
+				// byte (probably)
+				fprintf(opt.out, "** New rhythm instrument in use on OPL channel %d carrier\n"
+					"** Copy this into " MAPPING_FILE " to assign it a MIDI patch:\n",
+					chanOPL);
+				fprintf(opt.err, "%s %02X/%02X/%02X/%02X/%02X: "
+					"patch=?\n",
+					((ri == SnareDrum) ? "SD" : "TC"),
+					reg[chanOPL][IV_20+1],
+					reg[chanOPL][IV_40+1],
+					reg[chanOPL][IV_60+1],
+					reg[chanOPL][IV_80+1],
+					reg[chanOPL][IV_E0+1]
+				);
+				break;
+		}
+
+		fprintf(opt.out, ">> Using similar match: %s\n",
+			(besti >= 0) ? instdb.info(besti).name : "");
+		// Save this unknown instrument as a known one, so the same registers don't get printed again
+//		reg[channel].prog = instr[besti].prog;  // but keep the same patch that we've already assigned to the instrument, so it doesn't drop back to a piano for the rest of the song
+		// Maybe ^ isn't necessary if we're redirecting?
+		INSTRINFO info;
+		memset(&info, 0, sizeof(info));
+		if (besti >= 0) {
+			info.redirect = besti;  // Next time this instrument is matched, use the original one instead
+		} else {
+			info.redirect = -1;  // Will only happen when no instruments are loaded
+		}
+		instdb.add(query, info);
+	}
+	matchcache[chanMIDI] = besti;
+	return besti;
+}
+
+// Forget the instruments matched on any MIDI channel that uses this OPL
+// channel's registers.
+void ConversionContext::resetmatch(int chanOPL)
+{
+	matchcache[chanOPL] = -1;
+	switch (chanOPL) {
+		case 6: matchcache[CHAN_BASSDRUM] = -1; break;
+		case 7: matchcache[CHAN_SNAREDRUM] = matchcache[CHAN_HIHAT] = -1; break;
+		case 8: matchcache[CHAN_TOMTOM] = matchcache[CHAN_TOPCYMBAL] = -1; break;
+	}
+}
+
+// Function for processing OPL note on and off events, and generating MIDI
+// events in response.  This function is also called when the pitch changes
+// while a note is currently being played, causing it to generate MIDI
+// pitchbends (if enabled) instead.
+// Normally chanOPL and chanMIDI will be the same, except for rhythm mode
+// instruments, which uses chanOPL for pitch and instrument patches, but
+// chanMIDI for instrument mapping and note on/off events (since there will be
+// two instrument maps and notes for a single OPL channel.)
+void ConversionContext::doNoteOnOff(bool bKeyOn, int chanOPL, int chanMIDI)
+{
+	double keyFrac = freq2key(curfreq[chanOPL], curoctave[chanOPL]);
+	int key = (int)round(keyFrac);
+	if ((key > 0) && (bKeyOn)) {
+		// This is set to true to forcibly stop a MIDI keyon being generated for
+		// this note.  This is done when a pitchbend is deemed as having done the
+		// job properly.
+		bool bKeyonAgain = true;
+
+		if (keyAlreadyOn[chanMIDI]) {
+			// There's already a note playing on this channel, just worry about the pitch of that
+
+			if (mapchannel[chanMIDI] != gm_drumchannel) {
+				// We're using a normal instrument here
+
+				if (opt.bUsePitchBends) {
+						// It's the same note, but the pitch is off just slightly, use a pitchbend
+						//double dbDiff = fabs(keyFrac - key); // should be between -0.9999 and 0.9999
+						double dbDiff = keyFrac - (double)(lastkey[chanMIDI] - transpose[chanMIDI]); // hopefully between -PITCHBEND_RANGE and PITCHBEND_RANGE
+
+						if (dbDiff > PITCHBEND_RANGE) {
+							fprintf(opt.err, "Warning: This song wanted to pitchbend by %.2f notes, but the maximum is %.1f\n", dbDiff, PITCHBEND_RANGE);
+
+							// Turn this note off
+							midievents.noteoff(mapchannel[chanMIDI], lastkey[chanMIDI]);
+							iNotesActive--;
+							lastkey[chanMIDI] = -1;
+							keyAlreadyOn[chanMIDI] = false;
+							// leave bKeyonAgain as true, so that a noteon will be played instead
+						} else {
+							int iNewBend = (int)(pitchbend_center + (PITCHBEND_ONESEMITONE * dbDiff));
+							if (iNewBend != pitchbent[chanMIDI]) {
+								//printf("pitchbend to %d/%.2lf (center + %d) (%.2lf "
+								//	"semitones)\n", iNewBend, (double)pitchbend_center*2,
+								//	(int)(iNewBend - pitchbend_center), (double)dbDiff);
+								midievents.pitchbend(mapchannel[chanMIDI], iNewBend);
+//								iPitchbendCount++;
+								pitchbent[chanMIDI] = iNewBend;
+							}
+							// This pitchbend has done the job, don't play a noteon
+							bKeyonAgain = false;
+						}
+				} else {
+					// We're not using pitchbends, so just switch off the note if it's different (the next one will play below)
+					if ((opt.bApproximatePitchbends) && (key != (lastkey[chanMIDI] - transpose[chanMIDI]))) {
+						midievents.noteoff(mapchannel[chanMIDI], lastkey[chanMIDI]);
+						iNotesActive--;
+						lastkey[chanMIDI] = -1;
+						keyAlreadyOn[chanMIDI] = false;
+						//bKeyonAgain = true;
+					} else {
+						// Same note, different pitch, just pretend like it's not there
+						bKeyonAgain = false;
+					}
+				}
+			} else {
+				// This has mapped to a percussive MIDI note, so no pitchbends (or
+				// we'll bend all the percussive notes on the MIDI percussion channel.)
+				// But we don't want to play the note again, 'cos it's already on, so
+				// just ignore the keyon event.
+				// We'll also end up here if the instrument parameters are changed
+				// while the instrument is sounding, e.g. to change the characteristics
+				// of a hihat without sounding a new note.  This won't be converted.
+				bKeyonAgain = false;
+			}
+		} // else this is a percussive instrument
+
+		//} else {
+		//if ((!bDontKeyonAgain) && ((!keyAlreadyOn[channel]) || (opt.bUsePitchBends))) {  // If *now* there's no note playing... (or we're using pitchbends, i.e. a portamento has been set up)
+		if (bKeyonAgain) {  // If *now* there's no note playing... (or we're using pitchbends, i.e. a portamento has been set up)
+			// See if we need to update anything
+
+			// See if the instrument needs to change
+			int i = findinstr(chanMIDI);
+			if (
+				(i >= 0) && (
+					(instdb.info(i).prog != lastprog[chanMIDI]) ||
+					(
+						(instdb.info(i).isdrum) &&
+						(drumnote[chanMIDI] != instdb.info(i).note)
+					) || (
+						// Same instrument mapping, but different mute setting?
+						(instdb.info(i).muted != mute[chanMIDI])
+					)
+				)
+			) {
+				fprintf(opt.out, "// Ch%02d <- %s\n", chanMIDI, instdb.info(i).name);
+				if (!instdb.info(i).isdrum) {
+					// Normal instrument (not MIDI percussion)
+					assert(instdb.info(i).prog >= 0);
+
+					if (mapchannel[chanMIDI] == gm_drumchannel) {
+						// This was playing drums, now we're back to normal notes
+
+						// make sure this sets things back to what they were in the init
+						// section in main()
+						mapchannel[chanMIDI] = chanMIDI;
+						drumnote[chanMIDI] = -1; // NOTE: This drumnote won't be reset if the drum instrument was muted!  (As it then wouldn't have been assigned to gm_drumchannel)
+					}
+
+					transpose[chanMIDI] = instdb.info(i).iTranspose;
+					midievents.program(mapchannel[chanMIDI], lastprog[chanMIDI] = instdb.info(i).prog);
+				} else {
+					// This new instrument is a drum
+					assert(instdb.info(i).prog == -1);
+
+					/*if (instdb.info(i).muted) {
+						// This instrument is muted, which means whichever channel we
+						// assign it to will become muted.  We can't therefore assign it to
+						// the drum channel as we normally would, otherwise all the MIDI
+						// percussion will become muted.  So we assign it to its normal
+						// channel instead, like we would with a non-percussion instrument.
+						mapchannel[chanMIDI] = chanMIDI;
+					} else {
+						mapchannel[chanMIDI] = gm_drumchannel;
+					}*/
+					mapchannel[chanMIDI] = gm_drumchannel;
+					drumnote[chanMIDI] = instdb.info(i).note;
+					lastprog[chanMIDI] = instdb.info(i).prog;
+					// drums don't use transpose values
+				}
+				mute[chanMIDI] = instdb.info(i).muted;
+			}
+
+			// Play the note
+			//if ((opt.bUsePitchBends) && (!keyAlreadyOn[channel])) {
+			if ((opt.bUsePitchBends) && (mapchannel[chanMIDI] != gm_drumchannel)) { // If pitchbends are enabled and this isn't a percussion instrument
+				double dbDiff = keyFrac - key; // should be between -0.9999 and 0.9999
+				assert(dbDiff < PITCHBEND_RANGE); // not really necessary...
+
+				int iNewBend = (int)(pitchbend_center + (PITCHBEND_ONESEMITONE * dbDiff));
+				if (iNewBend != pitchbent[chanMIDI]) {
+					//printf("new note at pitchbend %d\n", iNewBend);
+					midievents.pitchbend(mapchannel[chanMIDI], iNewBend); // pitchbends are between 0x0000L and 0x2000L
+//					iPitchbendCount++;
+					pitchbent[chanMIDI] = iNewBend;
+				}
+			}
+
+			int level;
+			if (!mute[chanMIDI]) {
+				if (opt.bEnableVolume) {
+					level = reg[chanOPL][IV_40+1] & 0x3f;
+					if (level > 0x30) level = 0x30; // don't allow fully silent notes
+				} else level = 0; // 0 == loudest
+			} else {
+				level = 0x3f; // silent
+			}
+
+			if (mapchannel[chanMIDI] != gm_drumchannel) {
+				// Normal note
+				lastkey[chanMIDI] = key + transpose[chanMIDI];
+			} else {
+				// Percussion
+				//write->noteon(gm_drumchannel, drumnote[chanMIDI], (0x3f - level) << 1);
+				lastkey[chanMIDI] = drumnote[chanMIDI];
+			}
+
+			midievents.noteon(mapchannel[chanMIDI], lastkey[chanMIDI], (0x3f - level) << 1);
+			//printf("note on chan %d, mute is %s\n", chanMIDI, mute[chanMIDI] ? "true" : "false");
+			iNotesActive++;
+			iTotalNotes++;
+
+			// If this note went on with a pitchbend active on the channel, count it
+			if (pitchbent[chanMIDI] != pitchbend_center) iPitchbendCount++;
+
+			keyAlreadyOn[chanMIDI] = true;
+
+		} // if (not muted)
+
+	} else {
+		// There's no note currently playing on this channel, so if we've still got
+		// one switch it off.
+		if (lastkey[chanMIDI] != -1) {
+			midievents.noteoff(mapchannel[chanMIDI], lastkey[chanMIDI]);
+			iNotesActive--;
+			lastkey[chanMIDI] = -1;
+			keyAlreadyOn[chanMIDI] = false;
+		}
+	}
+
+	return;
+}
+
+static const char* dro2hwtypestr(unsigned hwtype) {
+	switch(hwtype) {
+	case 0: return "OPL2";
+	case 1: return "OPL2 dual";
+	case 2: return "OPL3";
+	default: return "UNKNOWN";
+	}
+}
+
+// Convert a batch of OPL register writes into MIDI events
+void ConversionContext::applyevents(const OPLEVENT* ev, int n)
+{
+	for (int i = 0; i < n; i++) {
+		// Write any delay (as this needs to come *before* the next note)
+		if (ev[i].ticks) midievents.time(ev[i].ticks);
+
+		int code = ev[i].reg;
+		int param = ev[i].val;
+		if (code >= 0xa0 && code <= 0xa8) { // set freq bits 0-7
+			lastchannel = code-0xa0;
+			curfreq[lastchannel] = (curfreq[lastchannel] & 0xF00) + (param & 0xff);
+			if (keyAlreadyOn[lastchannel]) {
+				param = 0x20; // bare noteon for code below
+				doNoteOnOff(true, lastchannel, lastchannel);
+			}
+			continue;
+		} else if (code >= 0xB0 && code <= 0xB8) { // set freq bits 8-9 and octave and on/off
+			lastchannel = code - 0xb0;
+			curfreq[lastchannel] = (curfreq[lastchannel] & 0x0FF) + ((param & 0x03)<<8);
+			// save octave so we know what it is if we run 0xA0-0xA8 regs change code
+			// next (which doesn't have the octave)
+			curoctave[lastchannel] = (param >> 2) & 7;
+
+			int keyon = (param >> 5) & 1;
+			doNoteOnOff(keyon, lastchannel, lastchannel);
+		} else if ((code == 0xBD) && (opt.bRhythm)) {
+			if ((param ^ rhythmreg) & 0x20) {
+				// Rhythm mode switched on or off
+				for (int c = 0; c < 16; c++) matchcache[c] = -1;
+			}
+			rhythmreg = param;
+			if ((param >> 5) & 1) {
+				// Bass Drum
+				doNoteOnOff((param >> 4) & 1, lastchannel, CHAN_BASSDRUM);
+				doNoteOnOff((param >> 3) & 1, lastchannel, CHAN_SNAREDRUM);
+				doNoteOnOff((param >> 2) & 1, lastchannel, CHAN_TOMTOM);
+				doNoteOnOff((param >> 1) & 1, lastchannel, CHAN_TOPCYMBAL);
+				doNoteOnOff( param       & 1, lastchannel, CHAN_HIHAT);
+			}
+		} else if (code >= 0x20 && code <= 0x35) {
+			lastchannel = GET_CHANNEL(code-0x20);
+			int op = GET_OP(code-0x20);
+			if (reg[lastchannel][IV_20+op] != param) resetmatch(lastchannel);
+			reg[lastchannel][IV_20+op] = param;
+		} else if (code >= 0x40 && code <= 0x55) {
+			lastchannel = GET_CHANNEL(code-0x40);
+			int op = GET_OP(code-0x40);
+			// The carrier level is only the note volume, and isn't compared when
+			// matching instruments
+			if ((op == 0) && (reg[lastchannel][IV_40+op] != param)) {
+				resetmatch(lastchannel);
+			}
+			reg[lastchannel][IV_40+op] = param;
+		} else if (code >= 0x60 && code <= 0x75) {
+			lastchannel = GET_CHANNEL(code-0x60);
+			int op = GET_OP(code-0x60);
+			if (reg[lastchannel][IV_60+op] != param) resetmatch(lastchannel);
+			reg[lastchannel][IV_60+op] = param;
+		} else if (code >= 0x80 && code <= 0x95) {
+			lastchannel = GET_CHANNEL(code-0x80);
+			int op = GET_OP(code-0x80);
+			if (reg[lastchannel][IV_80+op] != param) resetmatch(lastchannel);
+			reg[lastchannel][IV_80+op] = param;
+		} else if (code >= 0xc0 && code <= 0xc8) {
+			lastchannel = code-0xc0;
+			if (reg[lastchannel][IV_C0] != param) resetmatch(lastchannel);
+			reg[lastchannel][IV_C0] = param;
+		} else if (code >= 0xe0 && code <= 0xF5) {
+			lastchannel = GET_CHANNEL(code-0xe0);
+			int op = GET_OP(code-0xe0);
+			if (reg[lastchannel][IV_E0+op] != param) resetmatch(lastchannel);
+			reg[lastchannel][IV_E0+op] = param;
+		}
+	}
+	// Write out the events for every tick that has finished
+	midievents.flush(write);
+
+	return;
+}
+
+bool ConversionContext::compileInstruments()
+{
+	return instdb.save(COMPILED_FILE, instsource);
+}
+
+double now()
+{
+	return std::chrono::duration<double>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Check the conversion is still within the limits in opt, with iExtra bytes
+// (the song and the MIDI data written so far) in use on top of the
+// instruments and the MIDI events waiting to be written.  Returns true
+// (after saying why) if it should give up.
+bool ConversionContext::overlimit(unsigned long iExtra)
+{
+	if ((opt.dbTimeLimit > 0) && (now() > dbDeadline)) {
+		fprintf(opt.err, "Conversion didn't finish within %.1lf seconds, giving up\n",
+			opt.dbTimeLimit);
+		return true;
+	}
+	if (opt.iMemoryLimit) {
+		unsigned long iUsed = iExtra + instdb.memused(false) + midievents.memused();
+		if (iUsed > opt.iMemoryLimit) {
+			fprintf(opt.err, "Conversion needed more than %luKB of memory, giving "
+				"up\n", (opt.iMemoryLimit + 1023) / 1024);
+			return true;
+		}
+	}
+	return false;
+}
+
+// Write the start of the MIDI file to write, and set every channel up ready
+// for the first register write
+void ConversionContext::startsong()
+{
+	int c;
+	resolution = iInitialSpeed / 2;
+  write->head(/* version */ 0, /* track count updated later */0, resolution);
+
+  write->track();
+  write->tempo((long)(60000000.0 / tempo));
+  write->tact(4,4,24,8);
+
+  for (c = 0; c < 10; c++) {
+    mapchannel[c] = c;
+    write->resetctrlrs(mapchannel[c], 0);  // Reset All Controllers (Ensures default settings upon every playback).
+    write->volume(mapchannel[c], 127);
+    write->balance(mapchannel[c], 64);  // Usually called 'Pan'.
+    write->expression(mapchannel[c], 127);  // Similar to 'Volume', but this is primarily used for volume damping.
+  }
+
+  for (c = 0; c <= 8; c++) {
+    lastprog[c] = -1;
+		curoctave[c] = 0;
+  }
+  for (c = 0; c < 16; c++) matchcache[c] = -1;
+
+
+  for (c = 0; c < 9; c++) {
+    curfreq[c] = 0;
+    mapchannel[c] = c;  // This can get reset when playing a drum and then a normal instrument on a channel - see instrument-change code below
+		keyAlreadyOn[c] = false;
+		lastkey[c] = -1; // last MIDI key pressed on this channel
+		pitchbent[c] = (int)pitchbend_center;
+		transpose[c] = 0;
+		drumnote[c] = 0; // probably not necessary...
+		mute[c] = false;
+
+		if (opt.bUsePitchBends) {
+			write->control(mapchannel[c], 100, 0);  // RPN LSB for "Pitch Bend Sensitivity"
+			write->control(mapchannel[c], 101, 0);  // RPN MSB for "Pitch Bend Sensitivity"
+			write->control(mapchannel[c], 6, (int)PITCHBEND_RANGE); // Data for Pitch Bend Sensitivity (in semitones) - controller 38 can be used for cents in addition
+			write->control(mapchannel[c], 100, 0x7F);  // RPN LSB for "Finished"
+			write->control(mapchannel[c], 101, 0x7F);  // RPN MSB for "Finished"
+		}
+//		write->pitchbend(mapchannel[c], pitchbend_center);
+  }
+  // Rhythm-mode only channels
+  for (c = 10; c < 15; c++) {
+		keyAlreadyOn[c] = false;
+    mapchannel[c] = c; // as above, this will be changed later but must be
+			// eventually set back to this value here (or the instrument will jump
+			// channels unexpectedly.)
+		pitchbent[c] = (int)pitchbend_center;
+		lastkey[c] = -1; // last MIDI key pressed on this channel
+		transpose[c] = 0;
+		drumnote[c] = 0; // probably not necessary...
+		mute[c] = false;
+  }
+}
+
+// Write out everything left once the song is over
+void ConversionContext::endsong()
+{
+	midievents.flush(write, true);
+
+  for (int c = 0; c < 10; c++) {
+       mapchannel[c] = c;
+       write->allnotesoff(mapchannel[c], 0);  // All Notes Off (Ensures that even incomplete Notes will be switched-off per each MIDI channel at the end-of-playback).
+  }
+}
+
+void ConversionContext::begin(MidiWrite* dest, int iClock)
+{
+	iFormat = FORMAT_DRO2;
+	iInitialSpeed = iSpeed = iClock;
+	fprintf(opt.out, "Using conversion constant of %.1lf\n", dbConversionVal);
+	write = dest;
+	startsong();
+}
+
+bool ConversionContext::feed(const OPLEVENT* ev, int n)
+{
+	applyevents(ev, n);
+	if (midievents.failed()) {
+		fprintf(opt.err, "out of memory\n");
+		return false;
+	}
+	// Nothing more is known to be coming at the current tick, so rather than
+	// wait for the next delay, write out its events straight away
+	midievents.flush(write, true);
+	return true;
+}
+
+void ConversionContext::end()
+{
+	endsong();
+}
+
+// Register writes and MIDI events handed between the stages of the pipeline
+// at a time, and the number of each kept in flight
+#define PIPE_BATCH  512
+#define PIPE_SLOTS  16
+
+// Register writes from the decode stage, along with anything the decoder
+// printed while decoding them (which has to come out before their events)
+typedef struct
+{
+	int n; // number of events, or 0 at the end of the song or -1 if corrupt
+	char* out;
+	char* err;
+	OPLEVENT ev[PIPE_BATCH];
+} DECODEDBATCH;
+
+// MIDI events for the write stage, as they came out of MidiEventList::flush()
+typedef struct
+{
+	int n; // number of events, or 0 at the end of the song
+	MIDIEVENT ev[PIPE_BATCH];
+} MIDIBATCH;
+
+// State shared by the stages of runpipeline()
+struct PIPELINE
+{
+	// Decode stage
+	CaptureDecoder* decoder; // NULL to take the events from songevents
+	const OPLEVENT* songevents;
+	long iSongEvents;
+	FILE* out; // decoder's messages, until they're passed on
+	FILE* err;
+	long outpos, errpos; // how much of out and err has been passed on
+	std::atomic<bool> stop; // set when the conversion gives up
+	double dbDecodeTime;
+
+	// Convert stage
+	SpscRing* decoded;
+	SpscRing* midi;
+	MIDIBATCH* batch; // being filled in by pipesink(), or NULL
+
+	// Write stage
+	MidiWrite* write;
+	std::atomic<long> midisize; // bytes written so far
+	double dbWriteTime;
+};
+
+// Anything written to f since *pos, as a string to be freed by the caller, or
+// NULL if there's nothing new
+static char* takelog(FILE* f, long* pos)
+{
+	if (!f) return 0;
+	fflush(f);
+	long end = ftell(f);
+	if (end <= *pos) return 0;
+	char* text = (char*)malloc(end - *pos + 1);
+	if (text) {
+		fseek(f, *pos, SEEK_SET);
+		text[fread(text, 1, end - *pos, f)] = '\0';
+	}
+	fseek(f, end, SEEK_SET);
+	*pos = end;
+	return text;
+}
+
+// First stage: decode the capture into batches of register writes, ending
+// with one of 0 events (or -1 if it's corrupt)
+static void decodestage(PIPELINE* p)
+{
+	double start = now();
+	long next = 0;
+	int n;
+	do {
+		DECODEDBATCH* b = (DECODEDBATCH*)p->decoded->claim();
+		if (p->stop.load()) {
+			n = 0;
+			b->out = b->err = 0;
+		} else if (p->decoder) {
+			n = p->decoder->decode(b->ev, PIPE_BATCH);
+			b->out = takelog(p->out, &p->outpos);
+			b->err = (p->err != p->out) ? takelog(p->err, &p->errpos) : 0;
+		} else {
+			n = (int)(p->iSongEvents - next < PIPE_BATCH ? p->iSongEvents - next : PIPE_BATCH);
+			memcpy(b->ev, p->songevents + next, n * sizeof(OPLEVENT));
+			next += n;
+			b->out = b->err = 0;
+		}
+		b->n = n;
+		p->decoded->publish();
+	} while (n > 0);
+	p->dbDecodeTime = now() - start;
+}
+
+// Hand the events flushed out of the MidiEventList on to the write stage
+static void pipesink(void* context, const MIDIEVENT* ev, int n)
+{
+	PIPELINE* p = (PIPELINE*)context;
+	while (n) {
+		if (!p->batch) {
+			p->batch = (MIDIBATCH*)p->midi->claim();
+			p->batch->n = 0;
+		}
+		int count = PIPE_BATCH - p->batch->n;
+		if (count > n) count = n;
+		memcpy(p->batch->ev + p->batch->n, ev, count * sizeof(MIDIEVENT));
+		p->batch->n += count;
+		ev += count;
+		n -= count;
+		if (p->batch->n == PIPE_BATCH) {
+			p->midi->publish();
+			p->batch = 0;
+		}
+	}
+}
+
+// Last stage: encode the MIDI events into the file, until the empty batch
+// that marks the end of the song
+static void writestage(PIPELINE* p)
+{
+	double start = now();
+	MIDIBATCH* b;
+	while ((b = (MIDIBATCH*)p->midi->next())->n) {
+		int i = 0;
+		while (i < b->n) {
+			if (b->ev[i].code == 0) {
+				p->write->time(b->ev[i].ticks);
+				i++;
+				continue;
+			}
+			int run = i;
+			while ((run < b->n) && b->ev[run].code) run++;
+			p->write->emit(b->ev + i, run - i);
+			i = run;
+		}
+		p->midisize.store(p->write->getsize());
+		p->midi->release();
+	}
+	p->dbWriteTime = now() - start;
+}
+
+// Convert the song with each stage on its own thread: decoding the capture
+// (or, for -c auto, reading back the already decoded songevents), turning
+// the register writes into MIDI events on this thread, and encoding those
+// into write.  Messages still come out in the same order as in a serial
+// conversion.  Returns one of the CONVERT_* values.
+int ConversionContext::runpipeline(CaptureDecoder* decoder,
+	const OPLEVENT* songevents, long iSongEvents)
+{
+	SpscRing decoded(PIPE_SLOTS, sizeof(DECODEDBATCH));
+	SpscRing midi(PIPE_SLOTS, sizeof(MIDIBATCH));
+	PIPELINE p;
+	p.decoder = decoder;
+	p.songevents = songevents;
+	p.iSongEvents = iSongEvents;
+	p.out = p.err = 0;
+	p.outpos = p.errpos = 0;
+	p.stop.store(false);
+	p.dbDecodeTime = p.dbWriteTime = 0;
+	p.decoded = &decoded;
+	p.midi = &midi;
+	p.batch = 0;
+	p.write = write;
+	p.midisize.store(write->getsize());
+	if (!decoded.ok() || !midi.ok()) {
+		fprintf(opt.err, "out of memory\n");
+		return CONVERT_ERROR;
+	}
+	if (decoder) {
+		// Hold on to the decoder's messages until the events before them have
+		// been converted.  If there's nowhere to keep them they're printed
+		// straight away, a little early.
+		p.out = tmpfile();
+		p.err = (opt.err == opt.out) ? p.out : tmpfile();
+		decoder->setlog(p.out ? p.out : opt.out, p.err ? p.err : opt.err);
+	}
+	midievents.setsink(pipesink, &p);
+
+	double start = now();
+	std::thread decodethread(decodestage, &p);
+	std::thread writethread(writestage, &p);
+	int result = CONVERT_OK;
+	unsigned long iRings = decoded.memused() + midi.memused();
+	int n;
+	do {
+		DECODEDBATCH* b = (DECODEDBATCH*)decoded.next();
+		n = b->n;
+		if (result == CONVERT_OK) {
+			if (b->out) fputs(b->out, opt.out);
+			if (b->err) fputs(b->err, opt.err);
+			if (n > 0) applyevents(b->ev, n);
+		}
+		free(b->out);
+		free(b->err);
+		decoded.release();
+		if (n < 0) result = CONVERT_CORRUPT;
+		if ((n > 0) && (result == CONVERT_OK) && midievents.failed()) {
+			result = CONVERT_ERROR;
+			p.stop.store(true);
+		}
+		if ((n > 0) && (result == CONVERT_OK)
+			&& overlimit(iRings + p.midisize.load())) {
+			// Let the decode stage finish, and throw away what it's already done
+			result = CONVERT_LIMIT;
+			p.stop.store(true);
+		}
+	} while (n > 0);
+
+	// Pass on the last few events, then mark the end of the song
+	if (p.batch) midi.publish();
+	MIDIBATCH* last = (MIDIBATCH*)midi.claim();
+	last->n = 0;
+	midi.publish();
+	decodethread.join();
+	writethread.join();
+	double dbConvertTime = now() - start;
+	midievents.setsink(0, 0);
+
+	if (decoder) {
+		decoder->setlog(opt.out, opt.err);
+		if (p.out) fclose(p.out);
+		if (p.err && p.err != p.out) fclose(p.err);
+	}
+
+	dbStageIdle[0] = decoded.producerwait();
+	dbStageIdle[1] = decoded.consumerwait() + midi.producerwait();
+	dbStageIdle[2] = midi.consumerwait();
+	dbStageBusy[0] = p.dbDecodeTime - dbStageIdle[0];
+	dbStageBusy[1] = dbConvertTime - dbStageIdle[1];
+	dbStageBusy[2] = p.dbWriteTime - dbStageIdle[2];
+	for (int i = 0; i < PIPE_STAGES; i++)
+		if (dbStageBusy[i] < 0) dbStageBusy[i] = 0;
+	return result;
+}
+
+int ConversionContext::convert(CaptureReader& in, MidiWrite* dest)
+{
+	bool bInputStdin = (!opt.input) || (strcmp(opt.input, "-") == 0);
+	dbDeadline = now() + opt.dbTimeLimit;
+
+	unsigned long imflen = 0;
+	DRO2HEADER dro2hdr;
+
+	unsigned char cSig[9];
+	in.seek(0);
+	in.read(cSig, 8);
+	cSig[8] = 0;
+	iSpeed = 0;
+
+	if (strcmp((char *)cSig, "DBRAWOPL") == 0) {
+		iFormat = FORMAT_DRO;
+		unsigned long version = in.readUINT32LE();
+		if (version == 0x10000) {
+			fprintf(opt.out, "Input file is in DOSBox DRO v1.0 format.\n");
+		} else if (version == 0x2) {
+			fprintf(opt.out, "Input file is in DOSBox DRO v2.0 format.\n");
+			iFormat = FORMAT_DRO2;
+		} else {
+			fprintf(opt.out, "Input file is in DOSBox DRO format, but an unknown version!\n");
+			return CONVERT_UNKNOWN;
+		}
+		iInitialSpeed = 1000;
+		// filepos at this point is 12, pointing at main DRO header.
+
+		if(iFormat == FORMAT_DRO) {
+			in.seek(16); // seek to "length in bytes" field
+			imflen = in.readUINT32LE();
+		} else {
+			dro2hdr.iLengthPairs = in.readUINT32LE();
+			dro2hdr.iLengthMS = in.readUINT32LE();
+			in.read(&dro2hdr.iHardwareType, 6);
+			if(dro2hdr.iCodemapLength >= 128) {
+				fprintf(opt.err, "invalid setting %u for iCodemapLength!\n", (unsigned) dro2hdr.iCodemapLength);
+				return CONVERT_CORRUPT;
+			}
+			in.read(dro2hdr.iCodemap, dro2hdr.iCodemapLength);
+			imflen = dro2hdr.iLengthPairs * 2;
+			fprintf(opt.out, ">>> === DROv2 header info === <<<\n");
+			fprintf(opt.out, ">>> iLengthPairs\t%u\n", (unsigned) dro2hdr.iLengthPairs);
+			fprintf(opt.out, ">>> iLengthMS\t\t%u\n", (unsigned) dro2hdr.iLengthMS);
+			fprintf(opt.out, ">>> iHardwareType\t%u (%s)\n", (unsigned) dro2hdr.iHardwareType, dro2hwtypestr(dro2hdr.iHardwareType));
+			fprintf(opt.out, ">>> iFormat\t\t%u\n", (unsigned) dro2hdr.iFormat);
+			fprintf(opt.out, ">>> iCompression\t%u\n", (unsigned) dro2hdr.iCompression);
+			fprintf(opt.out, ">>> iShortDelayCode\t%u\n", (unsigned) dro2hdr.iShortDelayCode);
+			fprintf(opt.out, ">>> iLongDelayCode\t%u\n", (unsigned) dro2hdr.iLongDelayCode);
+			fprintf(opt.out, ">>> iCodemapLength\t%u\n", (unsigned) dro2hdr.iCodemapLength);
+			if(dro2hdr.iCompression) {
+				fprintf(opt.out, "unsupported DRO2 compression type.\n");
+				return CONVERT_CORRUPT;
+			}
+		}
+
+	} else if (strcmp((char *)cSig, "RAWADATA") == 0) {
+		iFormat = FORMAT_RAW;
+		fprintf(opt.out, "Input file is in Rdos RAW format.\n");
+
+		// Read until EOF (0xFFFF is really the end but we'll check that during conversion)
+		imflen = in.isstream() ? ULONG_MAX : in.size();
+
+		in.seek(8); // seek to "initial clock speed" field
+		iInitialSpeed = 1000;
+		int iClockSpeed = in.readUINT16LE();
+		if ((iClockSpeed == 0) || (iClockSpeed == 0xFFFF)) {
+			iSpeed = (int)18.2; // default to 18.2Hz...well, 18Hz thanks to rounding
+		} else {
+			iSpeed = (int)(1193180.0 / iClockSpeed);
+		}
+	} else {
+		iFormat = FORMAT_IMF;
+		if ((cSig[0] == 0) && (cSig[1] == 0)) {
+			fprintf(opt.out, "Input file appears to be in IMF type-0 format.\n");
+			// The length of a stream isn't known until it ends, so read until EOF
+			imflen = in.isstream() ? ULONG_MAX : in.size();
+			in.seek(0);
+		} else {
+			fprintf(opt.out, "Input file appears to be in IMF type-1 format.\n");
+			imflen = cSig[0] + (cSig[1] << 8);
+			in.seek(2); // seek to start of actual OPL data
+		}
+		if (bInputStdin) {
+			if (opt.bStdinIsWlf) {
+				fprintf(opt.out, "Reading from stdin - using 700Hz speed (.wlf)\n");
+				iInitialSpeed = 700;
+			} else {
+				fprintf(opt.out, "Reading from stdin - using 560Hz speed (.imf, use -w if this "
+					"is too slow)\n");
+				iInitialSpeed = 560;
+			}
+		} else if (strcasecmp(&opt.input[strlen(opt.input)-3], "imf") == 0) {
+			fprintf(opt.out, "File extension is .imf - using 560Hz speed (rename to .wlf if "
+				"this is too slow)\n");
+			iInitialSpeed = 560;
+		} else if (strcasecmp(&opt.input[strlen(opt.input)-3], "wlf") == 0) {
+			fprintf(opt.out, "File extension is .wlf - using 700Hz speed (rename to .imf if "
+				"this is too fast)\n");
+			iInitialSpeed = 700;
+		} else {
+			fprintf(opt.out, "Unknown file extension - must be .imf or .wlf\n");
+			return CONVERT_UNKNOWN;
+		}
+	}
+	CaptureDecoder* decoder;
+	switch (iFormat) {
+		case FORMAT_IMF: decoder = new ImfDecoder(in, imflen); break;
+		case FORMAT_DRO: decoder = new DroDecoder(in, imflen); break;
+		case FORMAT_DRO2: decoder = new Dro2Decoder(in, dro2hdr); break;
+		case FORMAT_RAW:
+			decoder = new RawDecoder(in, imflen, iInitialSpeed, iSpeed);
+			break;
+		default: return CONVERT_UNKNOWN; // should never happen
+	}
+	decoder->setlog(opt.out, opt.err);
+
+	// For -c auto the whole song is decoded first, so every note can be looked
+	// at before choosing the constant, and then converted from memory
+	OPLEVENT* songevents = 0;
+	long iSongEvents = 0;
+	int iNumEvents = 0;
+	if (opt.bAutoConversionVal) {
+		long iSize = 0;
+		do {
+			if (iSize - iSongEvents < DECODE_BATCH) {
+				iSize = iSize ? iSize * 2 : DECODE_BATCH * 16;
+				OPLEVENT* grown = (OPLEVENT*)realloc(songevents, iSize * sizeof(OPLEVENT));
+				if (!grown) {
+					fprintf(opt.err, "out of memory\n");
+					free(songevents);
+					delete decoder;
+					return CONVERT_ERROR;
+				}
+				songevents = grown;
+			}
+			iNumEvents = decoder->decode(songevents + iSongEvents, DECODE_BATCH);
+			if (iNumEvents > 0) iSongEvents += iNumEvents;
+			if (overlimit(iSize * sizeof(OPLEVENT))) {
+				free(songevents);
+				delete decoder;
+				return CONVERT_LIMIT;
+			}
+		} while (iNumEvents > 0);
+		dbConversionVal = autoConversionVal(songevents, iSongEvents);
+		buildFreqTable();
+	}
+	fprintf(opt.out, "Using conversion constant of %.1lf\n", dbConversionVal);
+
+  write = dest;
+	if (iSpeed == 0) {
+		iSpeed = iInitialSpeed;
+	}
+	startsong();
+
+	bool bLimit = false; // gave up part way through
+	int result = CONVERT_OK;
+	if (opt.bPipeline) {
+		result = runpipeline(opt.bAutoConversionVal ? 0 : decoder, songevents,
+			iSongEvents);
+		free(songevents);
+	} else if (opt.bAutoConversionVal) {
+		for (long i = 0; i < iSongEvents; i += DECODE_BATCH) {
+			applyevents(songevents + i,
+				(int)(iSongEvents - i < DECODE_BATCH ? iSongEvents - i : DECODE_BATCH));
+			if (midievents.failed()) break;
+			if (overlimit(iSongEvents * sizeof(OPLEVENT) + write->getsize())) {
+				bLimit = true;
+				break;
+			}
+		}
+		free(songevents);
+	} else {
+		OPLEVENT* events = new OPLEVENT[DECODE_BATCH];
+		while ((iNumEvents = decoder->decode(events, DECODE_BATCH)) > 0) {
+			applyevents(events, iNumEvents);
+			if (midievents.failed()) break;
+			if (overlimit(DECODE_BATCH * sizeof(OPLEVENT) + write->getsize())) {
+				bLimit = true;
+				break;
+			}
+		}
+		delete[] events;
+	}
+	delete decoder;
+	if (midievents.failed()) {
+		fprintf(opt.err, "out of memory\n");
+		return CONVERT_ERROR;
+	}
+	if (bLimit) return CONVERT_LIMIT;
+	if (iNumEvents < 0) return CONVERT_CORRUPT;
+	if (result != CONVERT_OK) return result;
+	endsong();
+
+	return CONVERT_OK;
+}
+
+int ConversionContext::convert(const void* data, unsigned long len,
+	unsigned char** midi, unsigned long* midilen)
+{
+	CaptureReader in;
+	in.open(data, len);
+	MidiWrite dest((const char*)0);
+	int result = convert(in, &dest);
+	if (result != CONVERT_OK) return result;
+	if (!dest.finish()) {
+		// Only happens if part of the file didn't fit in memory
+		fprintf(opt.err, "out of memory\n");
+		return CONVERT_ERROR;
+	}
+
+	*midilen = dest.getsize();
+	*midi = (unsigned char*)malloc(*midilen ? *midilen : 1);
+	if (!*midi) {
+		fprintf(opt.err, "out of memory\n");
+		return CONVERT_ERROR;
+	}
+	memcpy(*midi, dest.getdata(), *midilen);
+	return CONVERT_OK;
+}
@@ -0,0 +1,229 @@
+#ifndef __LIBDRO2MIDI__
+#define __LIBDRO2MIDI__
+
+#include "midiio.hpp"
+#include "capture.hpp"
+#include "decoder.hpp"
+#include "instdb.hpp"
+#include "eventlist.hpp"
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define MAPPING_FILE      "inst.txt"
+#define COMPILED_FILE     "inst.db"  // MAPPING_FILE etc. compiled with --compile-db
+
+#define PATCH_NAME_FILE   "patch.txt"
+#define PERC_NAME_FILE    "drum.txt"
+#define NUM_MIDI_PATCHES  128  // 128 MIDI instruments
+#define NUM_MIDI_PERC     128  // 46 MIDI percussive notes (channel 10), but 128 possible notes
+#define INSTR_NAMELEN      32  // Maximum length of an instrument name
+
+//#define PITCHBEND_RANGE 12.0   // 12 == pitchbends can go up to a full octave
+#define PITCHBEND_RANGE 24.0   // 24 == pitchbends can go up two full octaves
+#define PITCHBEND_ONESEMITONE  (8192.0 / PITCHBEND_RANGE)
+
+// Results of ConversionContext::convert(), which are also dro2midi's exit
+// codes
+#define CONVERT_OK       0
+#define CONVERT_ERROR    1  // out of memory, or the output couldn't be written
+#define CONVERT_CORRUPT  2  // the song data is corrupt
+#define CONVERT_UNKNOWN  3  // not a format (or IMF speed) that can be converted
+#define CONVERT_LIMIT    4  // gave up after going over the time or memory limit
+
+// Threads a conversion is split across with ConversionOptions::bPipeline:
+// decoding the capture, converting the register writes into MIDI events, and
+// encoding those into the MIDI file
+#define PIPE_STAGES  3
+
+// Short description of one of the CONVERT_* values
+const char* convertresultstr(int result);
+
+// Seconds since some fixed point, from a clock that never goes backwards, for
+// deadlines and timing
+double now();
+
+// Everything that can be changed about a conversion.  The defaults are the
+// same as running dro2midi without any options.
+struct ConversionOptions
+{
+  ConversionOptions();
+
+  // Turn on the pitchbend filter with the <ticks>,<cents> parameter of -b.
+  // Returns false, leaving the options unchanged, if it isn't in that form
+  // or either value is negative.
+  bool setBendFilter(const char* param);
+
+  bool bRhythm; // convert rhythm mode instruments (-r)
+  bool bUsePitchBends; // use pitch bends to better match MIDI note frequency with the OPL frequency (-p)
+  bool bApproximatePitchbends; // if pitchbends are disabled, should we approximate them by playing the nearest note when the pitch changes?
+  bool bPerfectMatchesOnly;  // if true, only match perfect instruments
+  bool bEnableVolume; // enable note velocity based on OPL instrument volume
+  bool bWriteSbiInstruments; // write detected instruments to .SBI files
+  bool bStdinIsWlf; // IMF data read from stdin is at 700Hz rather than 560Hz (-w)
+  bool bOptimise; // tidy up the MIDI events before they're written (-o)
+  bool bFilterPitchbends; // coalesce and drop small pitchbends (-b)
+  unsigned long iBendWindow; // ticks a pitchbend can be replaced within (-b)
+  double dbBendCents; // smallest pitchbend change kept (-b)
+  bool bAutoConversionVal; // pick the conversion constant from the song (-c auto)
+  double dbConversionVal; // constant used otherwise (-c)
+  double dbTimeLimit; // seconds convert() may take, or 0 for no limit (-t)
+  unsigned long iMemoryLimit; // bytes convert() may use for the song, its
+    // instruments and the MIDI data, or 0 for no limit (-m)
+  bool bPipeline; // run each of the PIPE_STAGES on its own thread (--pipeline)
+
+  const char* input; // name of the capture, used to tell .imf from .wlf (NULL
+    // or "-" if it's coming from stdin)
+  const char* output; // name of the MIDI file, which the .sbi files are named
+    // after
+
+  FILE* out; // status messages (stdout by default)
+  FILE* err; // warnings and errors (stderr by default)
+};
+
+// All the state for converting one capture.  Nothing is shared between
+// contexts, so separate conversions can run on separate threads.
+//
+// Call loadInstruments() (or useInstruments()) first, then convert().  A
+// context is only good for one conversion, since the instruments found in the
+// song are added to its instrument list as it goes.
+class ConversionContext
+{
+public:
+  ConversionContext(const ConversionOptions& options);
+
+  // Read the instrument mapping (from COMPILED_FILE if it's up to date,
+  // unless bUseCompiled is false.)  Returns false on a fatal error in the
+  // mapping file.
+  bool loadInstruments(bool bUseCompiled = true);
+
+  // Use instruments already loaded by another context, instead of calling
+  // loadInstruments().  Instruments found in the song are still only added
+  // to this context, so any number of contexts can share the same list at
+  // once, as long as the one it belongs to isn't used to convert anything
+  // (or deleted) in the meantime.
+  void useInstruments(const InstrumentDB& shared) { instdb.setbase(&shared); }
+
+  // Save the loaded instruments into COMPILED_FILE.  Returns false (with
+  // errno set) on error.
+  bool compileInstruments();
+
+  // Convert the capture in into a MIDI file, written to dest.  dest is left
+  // for the caller to finish() (or not, if the conversion failed.)  Returns
+  // one of the CONVERT_* values.
+  int convert(CaptureReader& in, MidiWrite* dest);
+
+  // Convert the len bytes of capture at data.  The MIDI file is returned in
+  // *midi, allocated with malloc() for the caller to free, and its length in
+  // *midilen.  Returns one of the CONVERT_* values, and *midi is only set if
+  // it's CONVERT_OK.
+  int convert(const void* data, unsigned long len, unsigned char** midi,
+    unsigned long* midilen);
+
+  // Convert a song as it's played, for captures that are still being made.
+  // begin() writes the start of the MIDI file to dest, at iClock ticks per
+  // second (the units of OPLEVENT::ticks, e.g. 1000 for DRO timing), then
+  // each call to feed() converts the next register writes, and end() closes
+  // off the song.  Once feed() returns, every MIDI event for the writes it
+  // was given has been passed to dest.  -c auto can't be used (there's no
+  // song to look at in advance) and the time and memory limits are ignored.
+  // feed() returns false (after saying so) if it ran out of memory, which
+  // leaves the song unfinished.
+  void begin(MidiWrite* dest, int iClock);
+  bool feed(const OPLEVENT* ev, int n);
+  void end();
+
+  // Results of the conversion
+  int totalnotes() { return iTotalNotes; }
+  int pitchbentnotes() { return iPitchbendCount; }
+  int activenotes() { return iNotesActive; }
+  double conversionval() { return dbConversionVal; }
+  // Seconds each of the PIPE_STAGES spent working, and waiting on the stages
+  // either side of it (only with bPipeline)
+  double stagebusy(int stage) { return dbStageBusy[stage]; }
+  double stageidle(int stage) { return dbStageIdle[stage]; }
+  InstrumentDB& instruments() { return instdb; }
+  MidiEventList& events() { return midievents; }
+
+protected:
+  ConversionOptions opt;
+
+  char cPatchName[NUM_MIDI_PATCHES][INSTR_NAMELEN];
+  char cPercName[NUM_MIDI_PERC][INSTR_NAMELEN];
+
+  MidiWrite* write;
+  MidiEventList midievents; // MIDI events waiting to be written to write
+
+  int resolution;
+  float tempo;
+
+  // Arrays of [9] refer to OPL channels, arrays of [16] also refer to OPL
+  // channels but use fake channels (11-15) for rhythm mode instruments (but
+  // only for elements like keyon and instrument mapping that can happen
+  // independently of the OPL channel in use.  Things like OPL channel pitch
+  // which affect both rhythm mode instruments using that channel are not
+  // stored separately, i.e. they're in the [9] array.)
+  int mapchannel[16];
+  int curfreq[9];
+  int curoctave[9]; // we need to remember the octave, so that when registers
+    // 0xA0-0xA8 are changed (to change note frequency) we can still pass the
+    // octave to the note conversion function (as the octave is otherwise only
+    // available when setting registers 0xB0-0xB8.)
+  bool keyAlreadyOn[16];
+  int lastkey[16]; // last MIDI key pressed on this channel
+  int pitchbent[16];
+  int transpose[16]; // used for instruments with mapped transpose values
+  int drumnote[16]; // note to play on MIDI channel 10 if Adlib channel has a
+    // percussive instrument assigned to it
+  int lastprog[16]; // last program/patch set on the MIDI channel
+  bool mute[16]; // true if the instrument on this channel is currently muted
+  int lastchannel; // OPL channel of the last register written (rhythm mode
+    // notes are played using whichever channel this is)
+  int matchcache[16]; // instrument findinstr() last returned for this channel,
+    // or -1 if the channel's registers have changed since
+  int rhythmreg; // last value written to 0xBD
+
+  // Statistics
+  int iNotesActive;
+  int iPitchbendCount;
+  int iTotalNotes;
+
+  // Current registers of each channel, packed the same way as the instruments
+  // they're matched against (see instvec.hpp.)
+  unsigned char reg[9][INSTVEC_LEN];
+
+  InstrumentDB instdb; // known instruments
+  uint64_t instsource[INSTDB_SOURCE]; // identifies the files instdb was loaded from
+
+  int iFormat; // input format
+  int iSpeed; // clock speed (in Hz)
+  int iInitialSpeed; // first iSpeed value written to MIDI header
+
+  double dbConversionVal;
+  double dbDeadline; // time (see now() in libdro2midi.cpp) convert() has to
+    // finish by if there's a time limit
+  double dbStageBusy[PIPE_STAGES];
+  double dbStageIdle[PIPE_STAGES];
+
+  // MIDI key for every OPL block and F-num at the current conversion
+  // constant, indexed as freqtable[block][fnum].  See buildFreqTable().
+  const double (*freqtable)[1024];
+  double customfreqtable[8][1024]; // used when the constant isn't a standard one
+
+  void buildFreqTable();
+  double freq2key(int freq, int octave) { return freqtable[octave][freq]; }
+  double autoConversionVal(const OPLEVENT* ev, long n);
+  bool loadCompiledInstruments();
+  void writesbi(const char* filename, int instrno, int chanOPL);
+  int findinstr(int chanMIDI);
+  void resetmatch(int chanOPL);
+  void doNoteOnOff(bool bKeyOn, int chanOPL, int chanMIDI);
+  void applyevents(const OPLEVENT* ev, int n);
+  void startsong();
+  void endsong();
+  bool overlimit(unsigned long iExtra);
+  int runpipeline(CaptureDecoder* decoder, const OPLEVENT* songevents,
+    long iSongEvents);
+};
+
+#endif
@@ -0,0 +1,305 @@
+// live.cpp - conversion of a capture as it's being made
+#include "live.hpp"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#define read _read
+#else
+#include <unistd.h>
+#endif
+
+// DRO v2 header up to the codemap: signature, version, pair count, length in
+// milliseconds and the six single byte fields
+#define DRO2_FIXEDHEADER  26
+
+// Bytes of MIDI file header and track header before the first event
+#define MIDI_TRACKSTART   22
+
+// Read from fd until buf holds at least len bytes (of size), returning false
+// at the end of the input.  *have is the number of bytes in buf.
+static bool readatleast(int fd, unsigned char* buf, int size, int* have,
+  int len)
+{
+  while (*have < len)
+  {
+    int n = read(fd, buf + *have, size - *have);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    *have += n;
+  }
+  return true;
+}
+
+// Strip the delta times, meta events and file structure from the len bytes
+// of standard MIDI file events in midi, and write the rest to out as a plain
+// stream of MIDI messages.  *status holds the running status between calls,
+// and every message is written with its status byte.
+static void writeraw(const unsigned char* midi, long len, int* status,
+  FILE* out)
+{
+  long p = 0;
+  while (p < len)
+  {
+    while (p < len && (midi[p++] & 0x80))
+      ; // delta time
+    if (p >= len)
+      break;
+    int code = midi[p];
+    if (code == 0xFF || code == 0xF0 || code == 0xF7)
+    {
+      p++;
+      if (code == 0xFF)
+        p++; // meta event type
+      unsigned long datalen = 0;
+      while (p < len)
+      {
+        datalen = (datalen << 7) | (midi[p] & 0x7F);
+        if (!(midi[p++] & 0x80))
+          break;
+      }
+      if (code == 0xF0)
+      {
+        fputc(0xF0, out);
+        fwrite(midi + p, 1, datalen, out);
+      }
+      p += datalen;
+      continue;
+    }
+    if (code & 0x80)
+    {
+      *status = code;
+      p++;
+    }
+    fputc(*status, out);
+    int datalen = ((*status & 0xE0) == 0xC0) ? 1 : 2;
+    fwrite(midi + p, 1, datalen, out);
+    p += datalen;
+  }
+}
+
+// Send everything write has produced since position *written to out (see
+// writeraw() for bRaw)
+static void sendmidi(MidiWrite* write, long* written, bool bRaw, int* status,
+  FILE* out)
+{
+  long len = write->getsize() - *written;
+  if (bRaw)
+    writeraw(write->getdata(*written), len, status, out);
+  else
+    fwrite(write->getdata(*written), 1, len, out);
+  *written = write->getsize();
+}
+
+int runlive(const ConversionOptions& options, const char* input,
+  const char* output, bool bRaw)
+{
+  ConversionOptions opt = options;
+  opt.input = input;
+  opt.output = output;
+
+  FILE* in = stdin;
+  if (strcmp(input, "-") != 0)
+    in = fopen(input, "rb");
+  if (!in)
+  {
+    perror(input);
+    return CONVERT_ERROR;
+  }
+#ifdef _WIN32
+  _setmode(_fileno(in), _O_BINARY);
+#endif
+  bool bOutputStdout = strcmp(output, "-") == 0;
+  if (bOutputStdout)
+  {
+    // Keep the status messages out of the MIDI data
+    opt.out = stderr;
+  }
+
+  ConversionContext ctx(opt);
+  if (!ctx.loadInstruments())
+    return CONVERT_ERROR;
+
+  // Wait for the header, which is read the same way as in convert()
+  int fd = fileno(in);
+  unsigned char buf[LIVE_CHUNK];
+  int have = 0;
+  DRO2HEADER hdr;
+  fprintf(opt.out, "Waiting for DOSBox DRO v2.0 data...\n");
+  fflush(opt.out);
+  if (!readatleast(fd, buf, LIVE_CHUNK, &have, DRO2_FIXEDHEADER)
+    || memcmp(buf, "DBRAWOPL\x02\0\0\0", 12) != 0)
+  {
+    fprintf(opt.err, "Live conversion needs DOSBox DRO v2.0 data\n");
+    return CONVERT_UNKNOWN;
+  }
+  CaptureReader head;
+  head.open(buf + 12, have - 12);
+  hdr.iLengthPairs = head.readUINT32LE();
+  hdr.iLengthMS = head.readUINT32LE();
+  head.read(&hdr.iHardwareType, 6);
+  if (hdr.iCodemapLength >= 128)
+  {
+    fprintf(opt.err, "invalid setting %u for iCodemapLength!\n",
+      (unsigned)hdr.iCodemapLength);
+    return CONVERT_CORRUPT;
+  }
+  if (hdr.iCompression)
+  {
+    fprintf(opt.out, "unsupported DRO2 compression type.\n");
+    return CONVERT_CORRUPT;
+  }
+  int start = DRO2_FIXEDHEADER + hdr.iCodemapLength;
+  if (!readatleast(fd, buf, LIVE_CHUNK, &have, start))
+  {
+    fprintf(opt.err, "DRO header is incomplete\n");
+    return CONVERT_CORRUPT;
+  }
+  memcpy(hdr.iCodemap, buf + DRO2_FIXEDHEADER, hdr.iCodemapLength);
+  have -= start;
+  memmove(buf, buf + start, have);
+
+  // The output isn't created until there's a song to write to it
+  FILE* out = bOutputStdout ? detachstdout() : fopen(output, "wb");
+  if (!out)
+  {
+    perror(output);
+    return CONVERT_ERROR;
+  }
+
+  MidiWrite write((const char*)0);
+  ctx.begin(&write, 1000);
+  fprintf(opt.out, "Converting as the song plays%s\n",
+    bRaw ? " (raw MIDI output)" : "");
+  fflush(opt.out);
+
+  long written = 0; // bytes of write's data already sent to out
+  int status = 0;
+  if (bRaw)
+    written = MIDI_TRACKSTART;
+  sendmidi(&write, &written, bRaw, &status, out);
+  write.discard(MIDI_TRACKSTART);
+  fflush(out);
+
+  OPLEVENT* events = new OPLEVENT[DECODE_BATCH];
+  unsigned long latency[LIVE_BUCKETS];
+  memset(latency, 0, sizeof(latency));
+  unsigned long batches = 0;
+  double total = 0, worst = 0;
+  int result = CONVERT_OK;
+  // Whatever came in with the header is converted before waiting for more.
+  // Everything after the first byte read is already waiting, so the time is
+  // taken from when each read finishes.
+  double received = now();
+  for (;;)
+  {
+    // Decode the complete pairs, carrying an odd byte over to the next read.
+    // Any delay at the end comes out as a write to register 0, so nothing is
+    // lost between reads.
+    hdr.iLengthPairs = have / 2;
+    CaptureReader pairs;
+    pairs.open(buf, hdr.iLengthPairs * 2);
+    Dro2Decoder decoder(pairs, hdr);
+    decoder.setlog(opt.out, opt.err);
+    int iNumEvents;
+    while ((iNumEvents = decoder.decode(events, DECODE_BATCH)) > 0)
+      if (!ctx.feed(events, iNumEvents))
+        break;
+    if (iNumEvents < 0)
+    {
+      result = CONVERT_CORRUPT;
+      break;
+    }
+    if (iNumEvents > 0 || write.failed())
+    {
+      result = CONVERT_ERROR;
+      break;
+    }
+    if (have & 1)
+      buf[0] = buf[have - 1];
+    have &= 1;
+
+    if (write.getsize() > written)
+    {
+      // Nothing but the header is needed again, so a long session doesn't
+      // keep the whole song in memory
+      sendmidi(&write, &written, bRaw, &status, out);
+      write.discard(MIDI_TRACKSTART);
+      fflush(out);
+      double secs = now() - received;
+      int bucket = (int)(secs * 1000000.0 / LIVE_BUCKET_US);
+      latency[bucket < LIVE_BUCKETS ? bucket : LIVE_BUCKETS - 1]++;
+      batches++;
+      total += secs;
+      if (secs > worst)
+        worst = secs;
+    }
+
+    int n;
+    do
+      n = read(fd, buf + have, LIVE_CHUNK - have);
+    while (n < 0 && errno == EINTR);
+    if (n <= 0)
+      break;
+    received = now();
+    have += n;
+  }
+  delete[] events;
+
+  ctx.end();
+  // This only fills in the header, as the file isn't going anywhere
+  if (!write.finish() && result == CONVERT_OK)
+  {
+    fprintf(opt.err, "out of memory\n");
+    result = CONVERT_ERROR;
+  }
+  sendmidi(&write, &written, bRaw, &status, out);
+  if (!bRaw)
+  {
+    if (fseek(out, 0, SEEK_SET) == 0)
+      fwrite(write.getdata(), 1, MIDI_TRACKSTART, out);
+    else
+      fprintf(opt.err, "Warning: The output can't be rewound, so the MIDI "
+        "file's header hasn't been finished\n");
+  }
+  if (fclose(out) != 0)
+  {
+    perror(output);
+    result = CONVERT_ERROR;
+  }
+  if (in != stdin)
+    fclose(in);
+  // Don't leave a half converted file behind
+  if ((result != CONVERT_OK) && (!bOutputStdout))
+    remove(output);
+
+  fprintf(opt.out, "\nLive conversion %s.  Wrote %s\n\n"
+    "  Total pitchbent notes: %d\n  Total notes: %d\n",
+    result == CONVERT_OK ? "complete" : "stopped",
+    bOutputStdout ? "to standard output" : output,
+    ctx.pitchbentnotes(), ctx.totalnotes());
+  if (opt.bFilterPitchbends)
+    fprintf(opt.out, "  Pitchbends dropped: %lu of %lu\n",
+      ctx.events().droppedbends(), ctx.events().bends());
+  if (opt.bOptimise || opt.bFilterPitchbends)
+    fprintf(opt.out, "  MIDI events optimised out: %lu\n", ctx.events().dropped());
+  if (batches)
+  {
+    unsigned long count = 0, target = (batches * 99 + 99) / 100;
+    int p99 = 0;
+    while (p99 < LIVE_BUCKETS - 1 && (count += latency[p99]) < target)
+      p99++;
+    fprintf(opt.out, "  Latency from register write to MIDI event, over %lu "
+      "batches:\n    average %.3fms, 99%% within %.2fms, worst %.3fms\n",
+      batches, total * 1000.0 / batches,
+      (p99 + 1) * LIVE_BUCKET_US / 1000.0, worst * 1000.0);
+  }
+  fprintf(opt.out, "\n");
+  return result;
+}
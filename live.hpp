@@ -0,0 +1,26 @@
+#ifndef __LIVE__
+#define __LIVE__
+
+#include "libdro2midi.hpp"
+
+// Most bytes read from the input at a time in live mode
+#define LIVE_CHUNK  4096
+
+// Latency histogram buckets, each LIVE_BUCKET_US microseconds wide (anything
+// slower goes in the last one)
+#define LIVE_BUCKETS    1000
+#define LIVE_BUCKET_US  10
+
+// Convert a DOSBox DRO v2 capture while it's still being written to input (a
+// pipe, FIFO or - for stdin), handing each register write to the conversion
+// as soon as it's read.  The MIDI data goes to output as it's produced,
+// either as a standard MIDI file whose header is filled in when the input
+// ends (which needs output to be a regular file), or if bRaw is set as the
+// plain stream of MIDI messages a synthesiser expects, with no timing.  The
+// time taken to get from reading each batch of register writes to writing
+// out its MIDI events is shown at the end.  Returns one of the CONVERT_*
+// values.
+int runlive(const ConversionOptions& opt, const char* input,
+  const char* output, bool bRaw);
+
+#endif
@@ -9,15 +9,13 @@
 
 static const char* copyright = "midiio v1.4 (c) 1995 by Günter Nagler";
 
-int compress = 1;
-
 #define NOTREALISTIC_PAUSE 0x1000000UL
 
 // common sysex events
-unsigned char sysex_gmreset[] = { 0xF0, 0x05, 0x7E, 0x7F, 0x09, 0x01, 0xF7 };
-unsigned char sysex_gsreset[] = { 0xF0, 0x0A, 0x41, 0x10, 0x42, 0x12, 0x40, 0x00, 0x7F, 0x00, 0x41, 0xF7 };
-unsigned char sysex_gsexit[] =  { 0xF0, 0x0A, 0x41, 0x10, 0x42, 0x12, 0x40, 0x00, 0x7F, 0x7F, 0x42, 0xF7 };
-unsigned char sysex_xgreset[] = { 0xF0, 0x08, 0x43, 0x10, 0x4C, 0x00, 0x00, 0x7E, 0x00, 0xF7 };
+const unsigned char sysex_gmreset[] = { 0xF0, 0x05, 0x7E, 0x7F, 0x09, 0x01, 0xF7 };
+const unsigned char sysex_gsreset[] = { 0xF0, 0x0A, 0x41, 0x10, 0x42, 0x12, 0x40, 0x00, 0x7F, 0x00, 0x41, 0xF7 };
+const unsigned char sysex_gsexit[] =  { 0xF0, 0x0A, 0x41, 0x10, 0x42, 0x12, 0x40, 0x00, 0x7F, 0x7F, 0x42, 0xF7 };
+const unsigned char sysex_xgreset[] = { 0xF0, 0x08, 0x43, 0x10, 0x4C, 0x00, 0x00, 0x7E, 0x00, 0xF7 };
 
 static int issysex(const unsigned char* sysex, const unsigned char* sysdata, int syslen)
 {
@@ -1216,32 +1214,87 @@ FILE* MidiRead::getf()
 
 // class MidiWrite
 
+// Write val as a variable length quantity of at most four bytes (anything
+// above 28 bits is dropped) and return the end of it.  All four bytes are
+// always stored, so there must be room for them.
+static inline unsigned char* encodedelta(unsigned char* p, unsigned long val)
+{
+  int len = 1 + (val >= 0x80) + (val >= 0x4000) + (val >= 0x200000);
+  unsigned long w = (val & 0x7F) | ((val << 1) & 0x7F00)
+    | ((val << 2) & 0x7F0000) | ((val << 3) & 0x7F000000) | 0x80808000;
+  w <<= 8 * (4 - len);
+  p[0] = (unsigned char)(w >> 24);
+  p[1] = (unsigned char)(w >> 16);
+  p[2] = (unsigned char)(w >> 8);
+  p[3] = (unsigned char)w;
+  return p + len;
+}
+
 const char* MidiWrite::copyright()
 {
   return (const char*)::copyright;
 }
 
-MidiWrite::MidiWrite(const char* filename)
+MidiWrite::MidiWrite(const char* filename, FILE* f)
 {
+  init();
   midiname_ = filename;
-  if (midiname_)
+  if (f)
+  {
+    f_ = f;
+    shouldclose_ = 0;
+  }
+  else if (midiname_)
+  {
     f_ = fopen(midiname_, WRITE_BINARY);
-  else
-    f_ = 0;
+    // The file goes out in a single fwrite(), there's no point copying it
+    // through a stdio buffer as well
+    if (f_)
+      setvbuf(f_, 0, _IONBF, 0);
+  }
+}
+
+MidiWrite::MidiWrite(MidiSink sink, void* context)
+{
+  init();
+  sink_ = sink;
+  sinkcontext_ = context;
+}
+
+void MidiWrite::init()
+{
+  midiname_ = 0;
+  f_ = 0;
+  shouldclose_ = 1;
+  finished_ = 0;
+  failed_ = 0;
+  sink_ = 0;
+  sinkcontext_ = 0;
+  bufsize_ = MIDI_BUFSIZE;
+  buf_ = (unsigned char*)malloc(bufsize_);
   trackpos_ = -1;
   curpos_ = 0;
+  keep_ = base_ = 0;
   trackchannel_ = -1;
 
-  bufpos_ = 0;
-  buflen_ = 0;
   filesize_ = 0;
   trackcount_ = 0;
   curtime_ = curdelta_ = 0;
   lastcode_ = -1;
+  compress_ = 1;
   clicks_ = 0;
 }
 
 MidiWrite::~MidiWrite()
+{
+  if (!finished_)
+    finish();
+  if (f_ && shouldclose_)
+    fclose(f_);
+  free(buf_);
+}
+
+bool MidiWrite::finish()
 {
   if (trackcount_ > 0)
   {
@@ -1250,9 +1303,23 @@ MidiWrite::~MidiWrite()
   }
   if (trackpos_ > 0)
     endtrack();
-  flush();
-  if (f_)
-    fclose(f_);
+  finished_ = 1;
+  if (failed_)
+    return false; // the file is missing whatever didn't fit
+
+  bool ok = true;
+  if (filesize_ > 0 && buf_)
+  {
+    if (sink_)
+      ok = sink_(sinkcontext_, buf_, bufpos(filesize_)) != 0;
+    else if (f_)
+      ok = fwrite(buf_, bufpos(filesize_), 1, f_) == 1;
+  }
+  if (f_ && !shouldclose_)
+    ok = (fflush(f_) == 0) && ok;
+  if (!ok)
+    error("write error (maybe disk full)");
+  return ok;
 }
 
 void MidiWrite::head(int version, int tracks, unsigned clicksperquarter)
@@ -1297,6 +1364,52 @@ void MidiWrite::event(int what, int len, const unsigned char* data)
   put(len, data);
 }
 
+void MidiWrite::emit(const MIDIEVENT* ev, int n)
+{
+  // Each event is at most a four byte delta, a status byte and two data
+  // bytes
+  if (n <= 0 || !reserve((long)n * 7))
+    return;
+  unsigned char* start = buf_ + bufpos(curpos_);
+  unsigned char* p = start;
+  unsigned long delta = curdelta_;
+  int last = lastcode_;
+  for (int i = 0; i < n; i++)
+  {
+    unsigned long ticks = ev[i].ticks;
+    if (ticks >= NOTREALISTIC_PAUSE)
+      warning("generating unrealistic large pause");
+    curtime_ += ticks;
+    p = encodedelta(p, delta + ticks);
+    delta = 0;
+
+    int code = ev[i].code;
+    assert(code >= 0x80 && code < 0xF0);
+    if ((code & 0xF0) == 0x80 && ev[i].data[1] == 0 && (last & 0xF0) == 0x90)
+      code |= 0x10; // as in noteoff()
+    *p = (unsigned char)code;
+    p += !(compress_ && code == last && code <= 0x9f);
+    last = code;
+
+    p[0] = ev[i].data[0];
+    p[1] = ev[i].data[1];
+    p += 2 - ((code & 0xE0) == 0xC0);
+  }
+  curdelta_ = delta;
+  lastcode_ = last;
+  curpos_ += p - start;
+  if (curpos_ > filesize_)
+    filesize_ = curpos_;
+}
+
+void MidiWrite::discard(long keep)
+{
+  assert(curpos_ == filesize_ && keep <= bufpos(filesize_)
+    && (keep_ == 0 || keep == keep_));
+  keep_ = keep;
+  base_ = filesize_;
+}
+
 void MidiWrite::prefixchannel(unsigned char channel)
 {
   meta(0x20, 1, &channel);
@@ -1675,7 +1788,7 @@ int put;
 
   assert(code >= 0x80);
 
-  if (compress)
+  if (compress_)
     put = !(code == lastcode_ && code <= 0x9f);
   else
     put = 1;
@@ -1684,10 +1797,9 @@ int put;
   lastcode_ = code;
 }
 
-static unsigned char c[4];
-
 void MidiWrite::putword(unsigned val)
 {
+  unsigned char c[2];
   c[1] = (unsigned char)(val & 0xff); val >>= 8;
   c[0] = (unsigned char)(val & 0xff);
   put(2, c);
@@ -1695,6 +1807,7 @@ void MidiWrite::putword(unsigned val)
 
 void MidiWrite::puttri(unsigned long val)
 {
+  unsigned char c[3];
   c[2] = (unsigned char)(val & 0xff); val >>= 8;
   c[1] = (unsigned char)(val & 0xff); val >>= 8;
   c[0] = (unsigned char)(val & 0xff);
@@ -1703,6 +1816,7 @@ void MidiWrite::puttri(unsigned long val)
 
 void MidiWrite::putlong(unsigned long val)
 {
+  unsigned char c[4];
   c[3] = (unsigned char)(val & 0xff); val >>= 8;
   c[2] = (unsigned char)(val & 0xff); val >>= 8;
   c[1] = (unsigned char)(val & 0xff); val >>= 8;
@@ -1712,19 +1826,8 @@ void MidiWrite::putlong(unsigned long val)
 
 void MidiWrite::putdelta(unsigned long val)
 {
-  int i = 0, j = 3;
-  while (i < 4)
-  {
-    c[j] = val & 0x7F;
-    if (j < 3)
-      c[j] |= 0x80;
-    val >>= 7;
-    i++;
-    if (!val)
-      break;
-    j--;
-  }
-  put(i, c+j);
+  unsigned char c[4];
+  put((int)(encodedelta(c, val) - c), c);
 }
 
 void MidiWrite::puttime()
@@ -1733,30 +1836,40 @@ void MidiWrite::puttime()
   curdelta_ = 0;
 }
 
-void MidiWrite::flush()
+bool MidiWrite::reserve(long len)
 {
-  if (buflen_ > 0)
+  // Once something has been dropped, everything after it is too, so the
+  // file can't come out with events missing from the middle
+  if (buf_ == 0 || failed_)
   {
-    fseek(f_, curpos_ - bufpos_, SEEK_SET);
-    if (fwrite(buf_, buflen_, 1, f_) != 1)
-      error("write error (maybe disk full)");
-    assert(ftell(f_) == curpos_ - bufpos_ + buflen_);
-    bufpos_ = buflen_ = 0;
+    failed_ = 1;
+    return false;
   }
+  if (bufsize_ - bufpos(curpos_) < len)
+  {
+    long newsize = bufsize_ * 2;
+    while (newsize - bufpos(curpos_) < len)
+      newsize *= 2;
+    unsigned char* newbuf = (unsigned char*)realloc(buf_, newsize);
+    if (!newbuf)
+    {
+      error("out of memory");
+      failed_ = 1;
+      return false;
+    }
+    buf_ = newbuf;
+    bufsize_ = newsize;
+  }
+  return true;
 }
 
 void MidiWrite::put(int len, const unsigned char* c)
 {
   if (len <= 0)
     return;
-  if (c == 0 || len > sizeof(buf_))
+  if (c == 0 || !reserve(len))
     return;
-  if (sizeof(buf_) - bufpos_ < len)
-    flush();
-  memcpy(buf_+bufpos_, c, len);
-  bufpos_+=len;
-  if (bufpos_ > buflen_)
-    buflen_ = bufpos_;
+  memcpy(buf_+bufpos(curpos_), c, len);
   curpos_+= len;
   if (curpos_ > filesize_)
     filesize_ = curpos_;
@@ -1764,16 +1877,7 @@ void MidiWrite::put(int len, const unsigned char* c)
 
 void MidiWrite::seek(long pos)
 {
-  assert(pos >= 0 && pos <= filesize_);
-  if (curpos_ == pos)
-    return;
-  if (pos >= curpos_-bufpos_ && pos <= curpos_-bufpos_+buflen_)
-  {
-    bufpos_ = (int)(pos - (curpos_-bufpos_));
-    curpos_ = pos;
-    return;
-  }
-  flush();
+  assert(pos >= 0 && pos <= filesize_ && (pos < keep_ || pos >= base_));
   curpos_ = pos;
 }
 
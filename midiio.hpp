@@ -217,16 +217,58 @@ protected:
   unsigned char curdeltalen_; // number of bytes read by recent getdelta() call
 };
 
+// A channel event (status 0x80 - 0xEF) for MidiWrite::emit()
+typedef struct
+{
+  unsigned long ticks;   // delay since the previous event
+  unsigned char code;    // status byte, including the channel
+  unsigned char data[2]; // data bytes (only data[0] for 0xC0 and 0xD0)
+} MIDIEVENT;
+
+// Receives the finished midi file from a MidiWrite.  Returns zero if the
+// data couldn't be written.
+typedef int (*MidiSink)(void* context, const unsigned char* data, long len);
+
 class MidiWrite
 {
 public:
   static const char* copyright();
 
-  MidiWrite(const char* filename);
+  // The whole file is built up in memory, with the track lengths and count
+  // filled in as they become known, and written out in one go by finish().
+  // If f is given the output goes there instead of to filename, and if
+  // neither is given it's only kept in memory (see getdata().)
+  MidiWrite(const char* filename, FILE* f = 0);
+  // Hand the finished file to sink instead of writing it anywhere
+  MidiWrite(MidiSink sink, void* context);
   virtual ~MidiWrite();
 
   FILE* getf();
 
+  // Close the last track, then write the file out (or pass it to the sink.)
+  // This is done by the destructor if it hasn't been called already.  Returns
+  // false if the file couldn't be written, or if anything was lost earlier
+  // for lack of memory (in which case nothing is written.)
+  bool finish();
+
+  // Whether anything has been lost for lack of memory, leaving the file
+  // incomplete
+  bool failed() { return failed_ != 0; }
+
+  // The file as built so far (or the complete file once finish() has been
+  // called.)  Only valid until the next write or the MidiWrite is deleted.
+  const unsigned char* getdata() { return buf_; }
+  long getsize() { return filesize_; }
+  // The file from position pos onwards, which mustn't have been discarded
+  const unsigned char* getdata(long pos) { return buf_ + bufpos(pos); }
+
+  // Free the memory used by everything written so far except the first keep
+  // bytes (the headers, which are still filled in by finish()), once it's
+  // been sent somewhere else.  Positions carry on from where they were, and
+  // only the part after the discarded data can be written to afterwards, so
+  // getdata() and finish() give the headers followed by the rest.
+  void discard(long keep);
+
   long getcurpos() { return curpos_; }
   long getcurtime() { return curtime_; }
   void cleardelta();
@@ -237,6 +279,13 @@ public:
 
   void event(int what, int len, const unsigned char* data);
 
+  // Write a batch of channel events.  The result is exactly what calling
+  // time() and then the matching method (noteon(), program() etc.) for each
+  // one would give, including running status and a note off with zero
+  // velocity becoming a note on, but the bytes are encoded straight into
+  // the output buffer.
+  void emit(const MIDIEVENT* ev, int n);
+
   void text(int what, int len, const unsigned char* txt);
   void meta(int what, int len, const unsigned char* data); // 0xff ....
   virtual void prefixchannel(unsigned char channel);
@@ -306,21 +355,37 @@ public:
 
   int unitsperquarter();
 
+  // Whether repeated note on/off codes are left out (running status), which
+  // is the default
+  void setcompress(int compress) { compress_ = compress; }
+
 protected:
   const char *midiname_;
   FILE* f_;
   long trackpos_, curpos_, filesize_;
   int trackchannel_, trackcount_, lastcode_, endtrack_;
+  int compress_;
 
-  unsigned char buf_[MIDI_BUFSIZE];
-  int bufpos_, buflen_;
+  unsigned char shouldclose_; // 0=no, otherwise=yes
+  unsigned char finished_; // 1=finish() has been called
+  unsigned char failed_; // 1=a write was dropped for lack of memory
+  MidiSink sink_;
+  void* sinkcontext_;
+  unsigned char* buf_; // the whole file, filesize_ bytes long (less any
+                       // discard()ed part)
+  long bufsize_;
+  long keep_, base_; // file positions from keep_ up to base_ were discarded
+
+  // Offset into buf_ of file position pos
+  long bufpos(long pos) { return pos < keep_ ? pos : pos - base_ + keep_; }
 
   unsigned long curdelta_;
   unsigned long curtime_;
 
   int clicks_;
 
-  void flush();
+  void init();
+  bool reserve(long len); // make room for len more bytes at curpos_
 };
 
 
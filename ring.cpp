@@ -0,0 +1,88 @@
+// ring.cpp - lock-free single producer, single consumer queue
+#include "ring.hpp"
+#include "libdro2midi.hpp"
+#include <stdlib.h>
+#include <assert.h>
+#include <thread>
+#include <chrono>
+
+// Wait a little longer each time round, so a short wait doesn't give up the
+// processor but a long one doesn't burn it either
+static void backoff(int spins)
+{
+  if (spins < 64)
+    return;
+  if (spins < 1024)
+    std::this_thread::yield();
+  else
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+}
+
+SpscRing::SpscRing(int slots, size_t recordsize)
+{
+  assert(slots > 0 && (slots & (slots - 1)) == 0);
+  data_ = (unsigned char*)malloc(slots * recordsize);
+  size_ = recordsize;
+  mask_ = slots - 1;
+  head_.store(0);
+  tail_.store(0);
+  tailcache_ = headcache_ = 0;
+  producerwait_ = consumerwait_ = 0;
+}
+
+SpscRing::~SpscRing()
+{
+  free(data_);
+}
+
+void* SpscRing::claim()
+{
+  unsigned long head = head_.load(std::memory_order_relaxed);
+  if (head - tailcache_ > mask_)
+  {
+    tailcache_ = tail_.load(std::memory_order_acquire);
+    if (head - tailcache_ > mask_)
+    {
+      double start = now();
+      for (int spins = 0; head - tailcache_ > mask_; spins++)
+      {
+        backoff(spins);
+        tailcache_ = tail_.load(std::memory_order_acquire);
+      }
+      producerwait_ += now() - start;
+    }
+  }
+  return data_ + (head & mask_) * size_;
+}
+
+void SpscRing::publish()
+{
+  head_.store(head_.load(std::memory_order_relaxed) + 1,
+    std::memory_order_release);
+}
+
+void* SpscRing::next()
+{
+  unsigned long tail = tail_.load(std::memory_order_relaxed);
+  if (tail == headcache_)
+  {
+    headcache_ = head_.load(std::memory_order_acquire);
+    if (tail == headcache_)
+    {
+      double start = now();
+      for (int spins = 0; tail == headcache_; spins++)
+      {
+        backoff(spins);
+        headcache_ = head_.load(std::memory_order_acquire);
+      }
+      consumerwait_ += now() - start;
+    }
+  }
+  return data_ + (tail & mask_) * size_;
+}
+
+void SpscRing::release()
+{
+  tail_.store(tail_.load(std::memory_order_relaxed) + 1,
+    std::memory_order_release);
+}
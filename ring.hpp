@@ -0,0 +1,63 @@
+#ifndef __RING__
+#define __RING__
+
+#include <stddef.h>
+#include <atomic>
+
+// Bytes kept between the members written by each side, so the producer and
+// consumer don't keep taking the same cache line off each other
+#define RING_PAD  64
+
+// A bounded queue of fixed-size records between exactly one producer thread
+// and one consumer thread, without any locks.  Records are filled in and read
+// in place: the producer claim()s a free slot, fills it and publish()es it,
+// and the consumer takes the next one with next() and release()s it once
+// it's done with it.
+//
+// Either side waits (spinning, then yielding, then sleeping) when there's
+// nothing it can do, and the time spent waiting is added up so a stage of a
+// pipeline can tell how much of its time was spent idle.
+class SpscRing
+{
+public:
+  // slots must be a power of two
+  SpscRing(int slots, size_t recordsize);
+  ~SpscRing();
+
+  // False if there wasn't enough memory for the records
+  bool ok() { return data_ != 0; }
+
+  // Producer: wait for a free slot
+  void* claim();
+  void publish();
+
+  // Consumer: wait for the next published record
+  void* next();
+  void release();
+
+  // Seconds each side has spent waiting
+  double producerwait() { return producerwait_; }
+  double consumerwait() { return consumerwait_; }
+
+  // Bytes allocated for the records
+  size_t memused() { return (mask_ + 1) * size_; }
+
+protected:
+  unsigned char* data_;
+  size_t size_;
+  unsigned long mask_;
+
+  char pad0_[RING_PAD];
+  std::atomic<unsigned long> head_; // records published so far
+  unsigned long tailcache_; // tail_ as last seen by the producer
+  double producerwait_;
+
+  char pad1_[RING_PAD];
+  std::atomic<unsigned long> tail_; // records released so far
+  unsigned long headcache_; // head_ as last seen by the consumer
+  double consumerwait_;
+
+  char pad2_[RING_PAD];
+};
+
+#endif
@@ -0,0 +1,547 @@
+// server.cpp - conversion server listening on a Unix domain socket
+#include "server.hpp"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <ctype.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+static volatile sig_atomic_t stopping = 0;
+
+static void onsignal(int)
+{
+  stopping = 1;
+}
+
+// Apply the options from a request line (everything after the name) to opt.
+// Returns false, with the problem written to log, if there's one it doesn't
+// understand.
+static bool parseoptions(char* p, ConversionOptions* opt, FILE* log)
+{
+  const char* seps = " \t";
+  char* save;
+  for (char* o = strtok_r(p, seps, &save); o; o = strtok_r(0, seps, &save))
+  {
+    if (strcmp(o, "-p") == 0)
+      opt->bUsePitchBends = false;
+    else if (strcmp(o, "-a") == 0)
+      opt->bApproximatePitchbends = true;
+    else if (strcmp(o, "-r") == 0)
+      opt->bRhythm = false;
+    else if (strcmp(o, "-i") == 0)
+      opt->bPerfectMatchesOnly = true;
+    else if (strcmp(o, "-v") == 0)
+      opt->bEnableVolume = false;
+    else if (strcmp(o, "-o") == 0)
+      opt->bOptimise = true;
+    else if (strcmp(o, "-b") == 0)
+    {
+      char* v = strtok_r(0, seps, &save);
+      if (!v || !opt->setBendFilter(v))
+      {
+        fprintf(log, "-b requires a parameter in the form <ticks>,<cents>\n");
+        return false;
+      }
+    }
+    else if (strcmp(o, "-c") == 0)
+    {
+      char* v = strtok_r(0, seps, &save);
+      if (!v)
+      {
+        fprintf(log, "-c requires a parameter\n");
+        return false;
+      }
+      if (strcmp(v, "alt") == 0)
+        opt->dbConversionVal = 50000.0;
+      else if (strcmp(v, "auto") == 0)
+        opt->bAutoConversionVal = true;
+      else if ((opt->dbConversionVal = strtod(v, NULL)) <= 0)
+      {
+        fprintf(log, "-c requires a positive parameter\n");
+        return false;
+      }
+    }
+    else
+    {
+      fprintf(log, "invalid option %s\n", o);
+      return false;
+    }
+  }
+  if (opt->bUsePitchBends && opt->bApproximatePitchbends)
+  {
+    fprintf(log, "Pitchbends can only be approximated (-a) if proper MIDI "
+      "pitchbends are disabled (-p)\n");
+    return false;
+  }
+  return true;
+}
+
+// Results of ConversionServer::readall()
+#define READ_OK       0
+#define READ_TIMEOUT  1  // the deadline passed first
+#define READ_CLOSED   2  // the client closed the connection (or it failed)
+
+class ConversionServer
+{
+public:
+  ConversionServer(const ConversionOptions& opt, const InstrumentDB& shared);
+
+  void add(int fd);
+  void stop();
+  void worker();
+  void summary(double secs);
+
+protected:
+  const ConversionOptions& opt_;
+  const InstrumentDB& shared_;
+
+  std::mutex lock_;  // held for everything below, and while printing
+  std::condition_variable ready_;
+  std::deque<int> waiting_;  // connections not yet picked up by a worker
+  bool stop_;
+  unsigned long started_, requests_, failed_;
+  double busy_;
+
+  bool wait(int fd, short events, double deadline);
+  int readall(int fd, char* buf, unsigned long len, double deadline,
+    unsigned long* got);
+  bool writeall(int fd, const void* buf, unsigned long len, double deadline);
+  int convert(int fd, char* line, char* extra, unsigned long extralen,
+    double deadline, FILE* log, unsigned char** midi, unsigned long* midilen);
+  void handle(int fd, unsigned long id);
+};
+
+ConversionServer::ConversionServer(const ConversionOptions& opt,
+  const InstrumentDB& shared)
+  : opt_(opt), shared_(shared)
+{
+  stop_ = false;
+  started_ = requests_ = failed_ = 0;
+  busy_ = 0;
+}
+
+// Queue a new connection for the next free worker
+void ConversionServer::add(int fd)
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  waiting_.push_back(fd);
+  ready_.notify_one();
+}
+
+// Let the workers finish once there are no connections left
+void ConversionServer::stop()
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  stop_ = true;
+  ready_.notify_all();
+}
+
+// Wait until fd is ready for events, or deadline (if non-zero) passes
+bool ConversionServer::wait(int fd, short events, double deadline)
+{
+  for (;;)
+  {
+    int timeout = -1;
+    if (deadline > 0)
+    {
+      double left = deadline - now();
+      if (left <= 0)
+        return false;
+      timeout = (int)(left * 1000) + 1;
+    }
+    struct pollfd p;
+    p.fd = fd;
+    p.events = events;
+    p.revents = 0;
+    int r = poll(&p, 1, timeout);
+    if (r > 0)
+      return true;
+    if (r == 0 || errno != EINTR)
+      return false;
+  }
+}
+
+// Read len bytes into buf, returning one of the READ_* values with the
+// number of bytes read in got
+int ConversionServer::readall(int fd, char* buf, unsigned long len,
+  double deadline, unsigned long* got)
+{
+  *got = 0;
+  while (*got < len)
+  {
+    if (!wait(fd, POLLIN, deadline))
+      return READ_TIMEOUT;
+    ssize_t n = recv(fd, buf + *got, len - *got, 0);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return READ_CLOSED;
+    *got += n;
+  }
+  return READ_OK;
+}
+
+bool ConversionServer::writeall(int fd, const void* buf, unsigned long len,
+  double deadline)
+{
+  const char* p = (const char*)buf;
+  while (len > 0)
+  {
+    if (!wait(fd, POLLOUT, deadline))
+      return false;
+    ssize_t n = send(fd, p, len, 0);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    p += n;
+    len -= n;
+  }
+  return true;
+}
+
+// Read the rest of the request whose first line is line (with extralen bytes
+// of the capture already read into extra) and convert it.  Anything that goes
+// wrong is written to log.
+int ConversionServer::convert(int fd, char* line, char* extra,
+  unsigned long extralen, double deadline, FILE* log, unsigned char** midi,
+  unsigned long* midilen)
+{
+  char* p;
+  char* options;
+  unsigned long len = strtoul(line, &p, 10);
+  const char* name = strtok_r(p, " \t", &options);
+  if (p == line || !name)
+  {
+    fprintf(log, "request must start with \"<length> <name>\"\n");
+    return CONVERT_ERROR;
+  }
+  ConversionOptions opt = opt_;
+  if (!parseoptions(options, &opt, log))
+    return CONVERT_ERROR;
+  opt.input = name;
+  opt.output = 0;
+  opt.bWriteSbiInstruments = false;
+  opt.out = opt.err = log;
+
+  unsigned long maxlen = opt.iMemoryLimit ? opt.iMemoryLimit : SERVER_MAXINPUT;
+  if (len > maxlen)
+  {
+    fprintf(log, "Capture is bigger than the limit of %luKB\n",
+      (maxlen + 1023) / 1024);
+    return CONVERT_LIMIT;
+  }
+  if (extralen > len)
+  {
+    fprintf(log, "more data sent than the length given\n");
+    return CONVERT_ERROR;
+  }
+  char* data = (char*)malloc(len ? len : 1);
+  if (!data)
+  {
+    fprintf(log, "out of memory\n");
+    return CONVERT_ERROR;
+  }
+  memcpy(data, extra, extralen);
+  unsigned long got;
+  int status = readall(fd, data + extralen, len - extralen, deadline, &got);
+  if (status != READ_OK)
+  {
+    free(data);
+    if (status == READ_TIMEOUT)
+    {
+      fprintf(log, "The whole capture wasn't received in time\n");
+      return CONVERT_LIMIT;
+    }
+    // The limits had nothing to do with it, the client stopped sending
+    fprintf(log, "The capture was cut short: only %lu of the %lu bytes given "
+      "were received\n", extralen + got, len);
+    return CONVERT_CORRUPT;
+  }
+
+  // Whatever time is left after receiving the capture is what the
+  // conversion can have
+  if (deadline > 0)
+  {
+    opt.dbTimeLimit = deadline - now();
+    if (opt.dbTimeLimit <= 0)
+    {
+      fprintf(log, "Conversion didn't finish within %.1lf seconds, giving up\n",
+        opt_.dbTimeLimit);
+      free(data);
+      return CONVERT_LIMIT;
+    }
+  }
+  ConversionContext* ctx = new ConversionContext(opt);
+  ctx->useInstruments(shared_);
+  int result = ctx->convert(data, len, midi, midilen);
+  delete ctx;
+  free(data);
+  return result;
+}
+
+// Read a request from fd, convert it and send back the result.  id is only
+// used to tell requests apart in the status messages.
+void ConversionServer::handle(int fd, unsigned long id)
+{
+  double start = now();
+  double deadline = opt_.dbTimeLimit > 0 ? start + opt_.dbTimeLimit : 0;
+
+  char* logbuf = 0;
+  size_t loglen = 0;
+  FILE* log = open_memstream(&logbuf, &loglen);
+  unsigned char* midi = 0;
+  unsigned long midilen = 0;
+  int result = CONVERT_ERROR;
+  bool received = false;
+
+  // The request line, and possibly the start of the capture after it
+  char line[SERVER_MAXLINE + 1];
+  // Copy of the request line for the status line, as convert() splits line
+  // up while parsing it
+  char request[SERVER_MAXLINE + 1];
+  unsigned long got = 0;
+  char* nl = 0;
+  while (!nl && got < SERVER_MAXLINE && wait(fd, POLLIN, deadline))
+  {
+    ssize_t n = recv(fd, line + got, SERVER_MAXLINE - got, 0);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      break;
+    got += n;
+    nl = (char*)memchr(line, '\n', got);
+  }
+  if (!log)
+  {
+    result = CONVERT_ERROR;
+  }
+  else if (!nl)
+  {
+    if (got >= SERVER_MAXLINE)
+      fprintf(log, "request line too long\n");
+    else
+      fprintf(log, "no request received\n");
+  }
+  else
+  {
+    received = true;
+    *nl = '\0';
+    if (nl > line && nl[-1] == '\r')
+      nl[-1] = '\0';
+    // Anything could have been sent, so keep control characters (and
+    // anything that isn't ASCII) off the terminal
+    int i;
+    for (i = 0; line[i]; i++)
+      request[i] = isprint((unsigned char)line[i]) ? line[i] : '?';
+    request[i] = '\0';
+    result = convert(fd, line, nl + 1, got - (nl + 1 - line), deadline, log,
+      &midi, &midilen);
+  }
+  if (log)
+    fclose(log); // logbuf and loglen are now filled in
+  if (result != CONVERT_OK)
+    midilen = 0;
+
+  char head[64];
+  int headlen = snprintf(head, sizeof(head), "%d %lu %lu\n", result, midilen,
+    (unsigned long)loglen);
+  double replydeadline = opt_.dbTimeLimit > 0 ? now() + opt_.dbTimeLimit : 0;
+  bool sent = writeall(fd, head, headlen, replydeadline)
+    && writeall(fd, midi, midilen, replydeadline)
+    && writeall(fd, logbuf, loglen, replydeadline);
+
+  // If the request was refused before all of it was read, closing the socket
+  // with data still waiting would reset the connection and could lose the
+  // reply, so give the client a moment to finish sending
+  shutdown(fd, SHUT_WR);
+  double draindeadline = now() + 1.0;
+  char drain[4096];
+  while (wait(fd, POLLIN, draindeadline) && recv(fd, drain, sizeof(drain), 0) > 0)
+    ;
+  close(fd);
+  double secs = now() - start;
+
+  std::lock_guard<std::mutex> lock(lock_);
+  requests_++;
+  busy_ += secs;
+  if (result != CONVERT_OK || !sent)
+    failed_++;
+  printf("#%lu ", id);
+  if (received)
+    printf("%s ", request);
+  if (result == CONVERT_OK)
+    printf("-> %luKB MIDI", (midilen + 1023) / 1024);
+  else
+    printf("-> %s", convertresultstr(result));
+  printf(" in %.3fs%s\n", secs, sent ? "" : " (reply not sent)");
+  fflush(stdout);
+  free(midi);
+  free(logbuf);
+}
+
+void ConversionServer::worker()
+{
+  for (;;)
+  {
+    int fd;
+    unsigned long id;
+    {
+      std::unique_lock<std::mutex> lock(lock_);
+      while (waiting_.empty() && !stop_)
+        ready_.wait(lock);
+      if (waiting_.empty())
+        return;
+      fd = waiting_.front();
+      waiting_.pop_front();
+      id = ++started_;
+    }
+    handle(fd, id);
+  }
+}
+
+void ConversionServer::summary(double secs)
+{
+  printf("\nServer stopped after %.1fs.  Handled %lu requests (%lu failed)",
+    secs, requests_, failed_);
+  if (requests_)
+    printf(", taking %.1fms each on average", busy_ * 1000.0 / requests_);
+  printf("\n");
+}
+
+static void runworker(ConversionServer* server)
+{
+  server->worker();
+}
+
+// Create the listening socket at path, replacing it if it's left over from a
+// server that's no longer running.  Returns -1 on error.
+static int listento(const char* path)
+{
+  struct sockaddr_un addr;
+  if (strlen(path) >= sizeof(addr.sun_path))
+  {
+    fprintf(stderr, "%s: socket path too long\n", path);
+    return -1;
+  }
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, path);
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0)
+  {
+    perror("socket");
+    return -1;
+  }
+  int r = bind(fd, (struct sockaddr*)&addr, sizeof(addr));
+  if (r != 0 && errno == EADDRINUSE)
+  {
+    int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+    bool live = probe >= 0 &&
+      connect(probe, (struct sockaddr*)&addr, sizeof(addr)) == 0;
+    if (probe >= 0)
+      close(probe);
+    if (live)
+    {
+      fprintf(stderr, "%s: another server is already listening\n", path);
+      close(fd);
+      return -1;
+    }
+    unlink(path);
+    r = bind(fd, (struct sockaddr*)&addr, sizeof(addr));
+  }
+  if (r != 0 || listen(fd, 64) != 0)
+  {
+    perror(path);
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+int runserver(const char* path, const ConversionOptions& opt, int threads)
+{
+  ConversionContext shared(opt);
+  if (!shared.loadInstruments())
+    return 1;
+
+  int fd = listento(path);
+  if (fd < 0)
+    return 1;
+
+  signal(SIGPIPE, SIG_IGN);
+  struct sigaction sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = onsignal;
+  sigaction(SIGINT, &sa, 0);
+  sigaction(SIGTERM, &sa, 0);
+
+  if (threads < 1)
+    threads = std::thread::hardware_concurrency();
+  if (threads < 1)
+    threads = 1;
+  printf("Listening on %s with %d thread%s", path, threads,
+    threads == 1 ? "" : "s");
+  if (opt.dbTimeLimit > 0)
+    printf(", %.1fs", opt.dbTimeLimit);
+  else
+    printf(", no time limit");
+  if (opt.iMemoryLimit)
+    printf(" and %luKB", (opt.iMemoryLimit + 1023) / 1024);
+  else
+    printf(" and no memory limit");
+  printf(" per request\n");
+  fflush(stdout);
+
+  double start = now();
+  ConversionServer server(opt, shared.instruments());
+  std::thread* workers = new std::thread[threads];
+  for (int t = 0; t < threads; t++)
+    workers[t] = std::thread(runworker, &server);
+
+  // Poll rather than block in accept(), so a signal is noticed whichever
+  // thread it's delivered to
+  while (!stopping)
+  {
+    struct pollfd p;
+    p.fd = fd;
+    p.events = POLLIN;
+    p.revents = 0;
+    if (poll(&p, 1, 250) <= 0)
+      continue;
+    int client = accept(fd, 0, 0);
+    if (client >= 0)
+      server.add(client);
+  }
+  close(fd);
+  unlink(path);
+
+  server.stop();
+  for (int t = 0; t < threads; t++)
+    workers[t].join();
+  delete[] workers;
+  server.summary(now() - start);
+  return 0;
+}
+
+#else
+
+int runserver(const char* path, const ConversionOptions& opt, int threads)
+{
+  fprintf(stderr, "--server is only available on Unix-like systems\n");
+  return 1;
+}
+
+#endif
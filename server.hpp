@@ -0,0 +1,38 @@
+#ifndef __SERVER__
+#define __SERVER__
+
+#include "libdro2midi.hpp"
+
+// Limits for each request when none are given (see usage())
+#define SERVER_TIMELIMIT  10.0
+#define SERVER_MEMLIMIT   (64UL * 1024 * 1024)
+
+// Largest capture accepted by the server when there's no memory limit
+#define SERVER_MAXINPUT   SERVER_MEMLIMIT
+
+// Longest request line (see runserver())
+#define SERVER_MAXLINE    1024
+
+// Listen for conversion requests on the Unix domain socket at path, until
+// interrupted (SIGINT or SIGTERM.)  The instruments are loaded once, and
+// threads connections are handled at a time, each converting with opt
+// (including its time and memory limits, which are applied to every request
+// separately.)
+//
+// Each connection carries one request: a line of text
+//
+//   <length> <name> [options...]
+//
+// followed by length bytes of capture.  name is only used for its extension,
+// which matters for IMF files, and the options are any of -p -a -r -i -v -o
+// -b <ticks>,<cents> and -c alt|auto|<num>, added to those in opt.  The reply
+// is the line
+//
+//   <result> <MIDI length> <message length>
+//
+// where result is one of the CONVERT_* values, followed by the MIDI file
+// (if result is CONVERT_OK) and then the conversion's messages.  Returns 1
+// if the server couldn't be started, otherwise 0 once it's stopped.
+int runserver(const char* path, const ConversionOptions& opt, int threads);
+
+#endif
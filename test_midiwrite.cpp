@@ -0,0 +1,171 @@
+//
+// test_midiwrite.cpp
+//
+// Stress test for MidiWrite being safe to use on several threads at once.
+// Hundreds of MIDI files (notes, pitchbends, tempo changes, sysex, several
+// tracks, with and without running status) are written one at a time to get
+// a reference copy of each, then written again from many threads at once,
+// and every file must come out exactly the same as its reference.
+//
+//   $ make test_midiwrite && ./test_midiwrite [files] [threads] [rounds]
+//
+// Exits with 0 if every file matched.
+//
+
+#include "midiio.hpp"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <thread>
+#include <atomic>
+#include <vector>
+
+// Default size of the test
+#define TEST_FILES    400
+#define TEST_THREADS  32
+#define TEST_ROUNDS   5
+
+// A finished file, as handed over by MidiWrite::finish()
+typedef struct
+{
+  unsigned char* data;
+  long len;
+} OUTPUT;
+
+static int keepoutput(void* context, const unsigned char* data, long len)
+{
+  OUTPUT* out = (OUTPUT*)context;
+  out->data = (unsigned char*)malloc(len);
+  if (!out->data)
+    return 0;
+  memcpy(out->data, data, len);
+  out->len = len;
+  return 1;
+}
+
+// Simple generator so each file's contents depend only on its number, not on
+// which thread writes it
+static unsigned long nextrand(unsigned long* seed)
+{
+  *seed = *seed * 1103515245UL + 12345UL;
+  return (*seed >> 16) & 0x7FFF;
+}
+
+// Write test file number n to out
+static bool writefile(int n, OUTPUT* out)
+{
+  unsigned long seed = n * 7919UL + 1;
+  out->data = 0;
+  out->len = 0;
+  MidiWrite write(keepoutput, out);
+  write.setcompress(n & 1);
+  int tracks = 1 + n % 3;
+  write.head(tracks > 1 ? 1 : 0, 0, 192);
+  for (int t = 0; t < tracks; t++)
+  {
+    write.track();
+    write.tempo(400000 + nextrand(&seed) * 10);
+    int events = 200 + (int)(nextrand(&seed) % 2000);
+    for (int e = 0; e < events; e++)
+    {
+      int channel = (int)(nextrand(&seed) % 16);
+      unsigned long r = nextrand(&seed);
+      // Mostly short delays, with the odd one needing all four bytes
+      write.time((r & 0x700) ? r % 32 : r * 500);
+      switch (nextrand(&seed) % 10)
+      {
+        case 0:
+          write.pitchbend(channel, (int)(nextrand(&seed) % 0x4000));
+          break;
+        case 1:
+          write.program(channel, (int)(nextrand(&seed) % 128));
+          break;
+        case 2:
+          write.control(channel, 7, (int)(nextrand(&seed) % 128));
+          break;
+        case 3:
+        {
+          unsigned char sysex[64];
+          int len = 1 + (int)(nextrand(&seed) % sizeof(sysex));
+          for (int i = 0; i < len; i++)
+            sysex[i] = (unsigned char)(nextrand(&seed) & 0x7F);
+          sysex[len - 1] = 0xF7;
+          write.sysex(len, sysex);
+          break;
+        }
+        case 4:
+          write.tempo(300000 + nextrand(&seed) * 20);
+          break;
+        case 5:
+        case 6:
+          write.noteoff(channel, (int)(nextrand(&seed) % 128));
+          break;
+        default:
+          write.noteon(channel, (int)(nextrand(&seed) % 128),
+            1 + (int)(nextrand(&seed) % 127));
+          break;
+      }
+    }
+  }
+  return write.finish();
+}
+
+int main(int argc, char** argv)
+{
+  int files = (argc > 1) ? atoi(argv[1]) : TEST_FILES;
+  int threads = (argc > 2) ? atoi(argv[2]) : TEST_THREADS;
+  int rounds = (argc > 3) ? atoi(argv[3]) : TEST_ROUNDS;
+  if ((files <= 0) || (threads <= 0) || (rounds <= 0))
+  {
+    fprintf(stderr, "Usage: test_midiwrite [files] [threads] [rounds]\n");
+    return 1;
+  }
+
+  std::vector<OUTPUT> ref(files);
+  for (int n = 0; n < files; n++)
+  {
+    if (!writefile(n, &ref[n]))
+    {
+      fprintf(stderr, "couldn't write reference file %d\n", n);
+      return 1;
+    }
+  }
+
+  int failures = 0;
+  for (int round = 0; round < rounds; round++)
+  {
+    std::vector<OUTPUT> out(files);
+    std::atomic<int> next(0);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++)
+    {
+      pool.push_back(std::thread([&]() {
+        int n;
+        while ((n = next++) < files)
+          writefile(n, &out[n]);
+      }));
+    }
+    for (size_t t = 0; t < pool.size(); t++)
+      pool[t].join();
+
+    int bad = 0;
+    for (int n = 0; n < files; n++)
+    {
+      if ((out[n].len != ref[n].len)
+        || (memcmp(out[n].data, ref[n].data, ref[n].len) != 0))
+      {
+        fprintf(stderr, "round %d: file %d differs from the reference\n",
+          round + 1, n);
+        bad++;
+      }
+      free(out[n].data);
+    }
+    printf("Round %d: %d of %d files written on %d threads matched\n",
+      round + 1, files - bad, files, threads);
+    failures += bad;
+  }
+
+  for (int n = 0; n < files; n++)
+    free(ref[n].data);
+  return failures ? 1 : 0;
+}